@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import sys
+import time
+import argparse
+
+import numpy as np
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp.tools import decomp
+
+parser = argparse.ArgumentParser(description='time the k space part of the Ewald sum')
+parser.add_argument('N', type=int, nargs='*', default=[10000, 100000, 1000000],
+                    help='numbers of charges')
+parser.add_argument('--density', type=float, default=0.5)
+parser.add_argument('--kmax', type=int, default=8)
+parser.add_argument('--alpha', type=float, default=1.0)
+parser.add_argument('--repeat', type=int, default=3)
+args = parser.parse_args()
+
+rc = 3.0
+skin = 0.3
+
+def bench(N):
+    L = (N / args.density) ** (1.0 / 3.0)
+    box = (L, L, L)
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG()
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    rng = np.random.RandomState(42)
+    pos = rng.uniform(0.0, L, (N, 3))
+    for i0 in range(0, N, 100000):
+        props = [(i, espressopp.Real3D(*pos[i]), 1.0 - 2.0 * (i % 2))
+                 for i in range(i0, min(i0 + 100000, N))]
+        system.storage.addParticles(props, 'id', 'pos', 'q')
+        system.storage.decompose()
+
+    pot = espressopp.interaction.CoulombKSpaceEwald(system, 1.0, args.alpha, args.kmax)
+    inter = espressopp.interaction.CellListCoulombKSpaceEwald(system.storage, pot)
+    system.addInteraction(inter)
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.0
+
+    # the first call allocates the exponent arrays
+    inter.computeEnergy()
+    t0 = time.time()
+    for _ in range(args.repeat):
+        inter.computeEnergy()
+    t1 = time.time()
+    for _ in range(args.repeat):
+        integrator.run(1)
+    t2 = time.time()
+    return L, (t1 - t0) / args.repeat, (t2 - t1) / args.repeat
+
+sys.stdout.write('kmax = %d, alpha = %g, density = %g, CPUs = %d\n' %
+                 (args.kmax, args.alpha, args.density, MPI.COMM_WORLD.size))
+sys.stdout.write('%10s %10s %14s %14s\n' % ('N', 'L', 'energy [s]', 'force [s]'))
+for N in args.N:
+    L, te, tf = bench(N)
+    sys.stdout.write('%10d %10.2f %14.4f %14.4f\n' % (N, L, te, tf))
@@ -152,6 +152,22 @@ public:
         }
     }
 
+    /** contiguous block of n values of type T, read in one piece; the pointer is
+        valid until the next receive */
+    template <class T>
+    const T* readBlock(int n)
+    {
+        const T* tbuf = (const T*)(buf + pos);
+        pos += n * sizeof(T);
+        if (pos > usedSize)
+        {
+            fprintf(stderr, "%d: read block at pos %d: size %d insufficient\n", comm.rank(), pos,
+                    usedSize);
+            exit(-1);
+        }
+        return tbuf;
+    }
+
     template <class T>
     void read(std::vector<T>& v)
     {
@@ -194,6 +210,16 @@ public:
         // printf("%d: received size = %d from %d\n", comm.rank(), size, sender);
     }
 
+    /** non-blocking receive of a message of known maximal size, without the
+        blocking probe of irecv(sender, tag) */
+    mpi::request irecv(longint sender, int tag, int size)
+    {
+        if (size > capacity) allocate(size);
+        usedSize = size;
+        pos = 0;
+        return comm.irecv(sender, tag, buf, capacity);
+    }
+
     mpi::request irecv(longint sender, int tag)
     {
         // blocking test for the incomming message
@@ -261,6 +287,19 @@ public:
         }
     }
 
+    /** reserve a contiguous block of n values of type T to be filled by the caller;
+        the pointer is valid until the next write */
+    template <class T>
+    T* writeBlock(int n)
+    {
+        int size = n * sizeof(T);
+        extend(pos + size);
+        T* tbuf = (T*)(buf + pos);
+        pos += size;
+        usedSize = pos;
+        return tbuf;
+    }
+
     template <class T>
     void write(std::vector<T> const& v)
     {
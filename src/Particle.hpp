@@ -178,6 +178,8 @@ struct ParticleLocal
     bool dummy1;
     bool dummy2;
     bool dummy3;
+    // position at the last rebuild of the Verlet lists, not communicated
+    Real3D lastPos;
 
 private:
     friend class boost::serialization::access;
@@ -219,6 +221,7 @@ struct Particle
         p.fm = 0.0;
         m.vradius = 0.0;
         l.ghost = false;
+        l.lastPos = 0.0;
         p.lambda = 0.0;
         p.varmass = 0.0;
         p.drift = 0.0;
@@ -283,11 +286,23 @@ struct Particle
     Real3D getModepos() const { return r.modepos; }
     void setModepos(const Real3D& mp) { r.modepos = mp; }
 
+    // Position at the last rebuild of the Verlet lists
+    Real3D& lastPosition() { return l.lastPos; }
+    const Real3D& lastPosition() const { return l.lastPos; }
+
     // All Forces
 
     ParticleForce& particleForce() { return f; }
     const ParticleForce& particleForce() const { return f; }
 
+    // All momenta and local data, e.g. for the ghost communication
+
+    ParticleMomentum& particleMomentum() { return m; }
+    const ParticleMomentum& particleMomentum() const { return m; }
+
+    ParticleLocal& particleLocal() { return l; }
+    const ParticleLocal& particleLocal() const { return l; }
+
     // Force
 
     Real3D& force() { return f.f; }
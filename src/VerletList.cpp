@@ -31,6 +31,9 @@
 #include "storage/Storage.hpp"
 #include "bc/BC.hpp"
 #include "iterator/CellListAllPairsIterator.hpp"
+#include "esutil/Threads.hpp"
+
+#include <algorithm>
 
 namespace espressopp
 {
@@ -57,6 +60,7 @@ VerletList::VerletList(
     cutsq = cutVerlet * cutVerlet;
     builds = 0;
     max_type = 0;
+    numRealPairs = 0;
 
     resetTimers();
     if (rebuildVL) rebuild();  // not called if exclutions are provided
@@ -93,9 +97,13 @@ void VerletList::rebuild()
     cutsq = cutVerlet * cutVerlet;
 
     vlPairs.clear();
+    vlSlots.clear();
 
     if (useBuffers)
     {
+        // slots are only needed if the force loop runs on several threads
+        useSlots = esutil::getMaxThreads() > 1;
+        if (useSlots) buildSlots();
         rebuildUsingBuffers(exList.size(), useSOA);
     }
     else
@@ -111,6 +119,16 @@ void VerletList::rebuild()
         }
     }
 
+    // pairs of two real particles first, for the force computation during the ghost update
+    numRealPairs = 0;
+    if (getSystem()->storage->overlapsGhostUpdate() && !hasPairSlots())
+    {
+        PairList::iterator ghostPairs =
+            std::stable_partition(vlPairs.begin(), vlPairs.end(), [](const ParticlePair& pair)
+                                  { return !pair.first->ghost() && !pair.second->ghost(); });
+        numRealPairs = ghostPairs - vlPairs.begin();
+    }
+
     builds++;
     timeRebuild += timer.getElapsedTime() - currTime;
     LOG4ESPP_DEBUG(theLogger, "rebuilt VerletList (count=" << builds << "), cutsq = " << cutsq
@@ -173,19 +191,30 @@ void VerletList::_rebuildUsingBuffers()
         }
     }
 
-    // fill buffer
-    size_t ip = 0;
+    // slots may have been switched on later so check size of c_slot separately
+    const Cell* firstCell = getSystem()->storage->getFirstCell();
+    if (useSlots && c_reserve > c_slot.size())
+    {
+        c_slot.resize(2 * c_reserve);
+    }
+
+    // fill buffer, every cell writes its own range [c_range[icell-1], c_range[icell])
+    ESPP_OMP(omp parallel for schedule(static))
     for (size_t icell = 0; icell < numRealCells; icell++)
     {
-        size_t end = c_range[icell];
+        size_t ip = (icell > 0) ? c_range[icell - 1] : 0;
         for (NeighborCellInfo& nc : realCells[icell]->neighborCells)
         {
             if (!nc.useForAllPairs)
             {
-                for (Particle& p : nc.cell->particles)
+                const int cellOffset = useSlots ? cellSlotOffset[nc.cell - firstCell] : 0;
+                const ParticleList& ncParticles = nc.cell->particles;
+                for (size_t i = 0; i < ncParticles.size(); i++)
                 {
+                    Particle& p = nc.cell->particles[i];
                     c_p[ip] = &p;
                     if (USE_EXCLUSION_LIST) c_id[ip] = p.id();
+                    if (useSlots) c_slot[ip] = cellOffset + i;
                     c_type[ip] = p.type();
                     if (USE_SOA)
                     {
@@ -202,78 +231,150 @@ void VerletList::_rebuildUsingBuffers()
                 }
             }
         }
-        if (ip != end) std::runtime_error("Range mismatch.");
     }
 
-    // rebuild neighbor list
-    size_t start = 0;
-    for (size_t icell = 0; icell < numRealCells; icell++)
+    // rebuild neighbor list, every thread collects the pairs of a contiguous block of cells
+    // such that concatenating them in thread order gives the same list as a serial rebuild
+    // the runtime may hand out fewer threads than requested, so all slots are cleared up front;
+    // otherwise the slot of a missing thread would still hold the pairs of the last rebuild
+    const int numThreads = esutil::getMaxThreads();
+    threadPairs.resize(numThreads);
+    threadSlots.resize(numThreads);
+    for (int tid = 0; tid < numThreads; tid++)
     {
-        size_t end = c_range[icell];
-        ParticleList& particles = realCells[icell]->particles;
-        size_t numParticles = particles.size();
-        for (size_t p1 = 0; p1 < numParticles; p1++)
-        {
-            Particle& part1 = particles[p1];
+        threadPairs[tid].clear();
+        threadSlots[tid].clear();
+    }
+    size_t maxType = max_type;
 
-            // self-loop
-            for (size_t p2 = p1 + 1; p2 < numParticles; p2++)
-            {
-                Particle& part2 = particles[p2];
-                checkPair(part1, part2);
-            }
+    ESPP_OMP(omp parallel num_threads(numThreads) reduction(max : maxType))
+    {
+        const int tid = esutil::getThreadNum();
+        PairList& pairs = (numThreads > 1) ? threadPairs[tid] : vlPairs;
+        std::vector<int>& slots = (numThreads > 1) ? threadSlots[tid] : vlSlots;
 
-            Real3D p1_pos;
-            real x1, y1, z1;
-            if (USE_SOA)
-            {
-                const Real3D& pos = part1.position();
-                x1 = pos[0];
-                y1 = pos[1];
-                z1 = pos[2];
-            }
-            else
-            {
-                p1_pos = part1.position();
-            }
-            size_t id1;
-            if (USE_EXCLUSION_LIST)
+        ESPP_OMP(omp for schedule(static))
+        for (size_t icell = 0; icell < numRealCells; icell++)
+        {
+            size_t start = (icell > 0) ? c_range[icell - 1] : 0;
+            size_t end = c_range[icell];
+            ParticleList& particles = realCells[icell]->particles;
+            size_t numParticles = particles.size();
+            const int cellOffset = useSlots ? cellSlotOffset[realCells[icell] - firstCell] : 0;
+            for (size_t p1 = 0; p1 < numParticles; p1++)
             {
-                id1 = part1.id();
-            }
-            const size_t type1 = part1.type();
+                Particle& part1 = particles[p1];
 
-            // neighbor-loop
-            for (size_t p2 = start; p2 < end; p2++)
-            {
-                real distsq;
+                Real3D p1_pos;
+                real x1, y1, z1;
                 if (USE_SOA)
                 {
-                    real dist_x = x1 - c_x[p2];
-                    real dist_y = y1 - c_y[p2];
-                    real dist_z = z1 - c_z[p2];
-                    distsq = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
+                    const Real3D& pos = part1.position();
+                    x1 = pos[0];
+                    y1 = pos[1];
+                    z1 = pos[2];
                 }
                 else
                 {
-                    Real3D d = p1_pos - c_pos[p2];
-                    distsq = d.sqr();
+                    p1_pos = part1.position();
                 }
-
-                if (distsq > cutsq) continue;
-
+                size_t id1;
                 if (USE_EXCLUSION_LIST)
                 {
-                    size_t const& id2 = c_id[p2];
-                    if (exList.count(std::make_pair(id1, id2)) == 1) continue;
-                    if (exList.count(std::make_pair(id2, id1)) == 1) continue;
+                    id1 = part1.id();
                 }
+                const size_t type1 = part1.type();
 
-                max_type = std::max(max_type, std::max(type1, c_type[p2]));
-                vlPairs.add(&part1, c_p[p2]);
+                // self-loop
+                for (size_t p2 = p1 + 1; p2 < numParticles; p2++)
+                {
+                    Particle& part2 = particles[p2];
+                    Real3D d = part1.position() - part2.position();
+                    if (d.sqr() > cutsq) continue;
+
+                    // see if it's in the exclusion list (both directions)
+                    if (exList.count(std::make_pair(part1.id(), part2.id())) == 1) continue;
+                    if (exList.count(std::make_pair(part2.id(), part1.id())) == 1) continue;
+
+                    maxType = std::max(maxType, std::max(type1, part2.type()));
+                    pairs.add(part1, part2);
+                    if (useSlots)
+                    {
+                        slots.push_back(cellOffset + p1);
+                        slots.push_back(cellOffset + p2);
+                    }
+                }
+
+                // neighbor-loop
+                for (size_t p2 = start; p2 < end; p2++)
+                {
+                    real distsq;
+                    if (USE_SOA)
+                    {
+                        real dist_x = x1 - c_x[p2];
+                        real dist_y = y1 - c_y[p2];
+                        real dist_z = z1 - c_z[p2];
+                        distsq = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
+                    }
+                    else
+                    {
+                        Real3D d = p1_pos - c_pos[p2];
+                        distsq = d.sqr();
+                    }
+
+                    if (distsq > cutsq) continue;
+
+                    if (USE_EXCLUSION_LIST)
+                    {
+                        size_t const& id2 = c_id[p2];
+                        if (exList.count(std::make_pair(id1, id2)) == 1) continue;
+                        if (exList.count(std::make_pair(id2, id1)) == 1) continue;
+                    }
+
+                    maxType = std::max(maxType, std::max(type1, c_type[p2]));
+                    pairs.add(&part1, c_p[p2]);
+                    if (useSlots)
+                    {
+                        slots.push_back(cellOffset + p1);
+                        slots.push_back(c_slot[p2]);
+                    }
+                }
             }
         }
-        start = end;
+    }
+    max_type = maxType;
+
+    if (numThreads > 1)
+    {
+        size_t numPairs = 0;
+        for (const PairList& pairs : threadPairs) numPairs += pairs.size();
+        vlPairs.reserve(numPairs);
+        if (useSlots) vlSlots.reserve(2 * numPairs);
+        for (int tid = 0; tid < numThreads; tid++)
+        {
+            vlPairs.insert(vlPairs.end(), threadPairs[tid].begin(), threadPairs[tid].end());
+            vlSlots.insert(vlSlots.end(), threadSlots[tid].begin(), threadSlots[tid].end());
+        }
+    }
+}
+
+/*-------------------------------------------------------------*/
+
+void VerletList::buildSlots()
+{
+    // slots number all local particles cell by cell, in the order of the cells in the storage
+    const CellList& localCells = getSystem()->storage->getLocalCells();
+    const size_t numLocalCells = localCells.size();
+
+    cellSlotOffset.resize(numLocalCells);
+    slotParticles.clear();
+    for (size_t icell = 0; icell < numLocalCells; icell++)
+    {
+        cellSlotOffset[icell] = slotParticles.size();
+        for (Particle& p : localCells[icell]->particles)
+        {
+            slotParticles.push_back(&p);
+        }
     }
 }
 
@@ -86,6 +86,11 @@ public:
     /** Add pairs to exclusion list */
     bool exclude(longint pid1, longint pid2);
 
+    /** Get the number of pairs without ghosts at the front of the pair list. They
+        are only sorted to the front if the storage overlaps the ghost update with
+        the force computation, otherwise 0. */
+    size_t getNumRealPairs() const { return numRealPairs; }
+
     /** Get the number of times the Verlet list has been rebuilt */
     int getBuilds() const { return builds; }
 
@@ -96,6 +101,17 @@ public:
 
     void loadTimers(real* t);
 
+    /** Check whether per-pair particle slots are available for the current pair list.
+        They are only built by the buffered rebuild when more than one thread is used. */
+    bool hasPairSlots() const { return useSlots && vlSlots.size() == 2 * vlPairs.size(); }
+
+    /** Slots of the particles of pair i are stored at 2*i and 2*i+1. A slot is the
+        index of the particle in getSlotParticles(). */
+    const std::vector<int>& getPairSlots() const { return vlSlots; }
+
+    /** All local (real and ghost) particles, ordered by slot. */
+    const std::vector<Particle*>& getSlotParticles() const { return slotParticles; }
+
     /** Register this class so it can be used from Python. */
     static void registerPython();
 
@@ -104,6 +120,7 @@ protected:
     std::vector<Real3D> c_pos;
     std::vector<Particle*> c_p;
     std::vector<size_t> c_id, c_type;
+    std::vector<int> c_slot;
 
     inline void rebuildUsingBuffers(bool useExList, bool useSOA)
     {
@@ -130,7 +147,18 @@ protected:
     bool useSOA = false;
 
     void checkPair(Particle& pt1, Particle& pt2);
+    void buildSlots();
     PairList vlPairs;
+    size_t numRealPairs;
+
+    // per-pair particle slots for the threaded force loop
+    bool useSlots = false;
+    std::vector<int> vlSlots;
+    std::vector<Particle*> slotParticles;
+    std::vector<int> cellSlotOffset;
+    // per-thread pair lists used while rebuilding in parallel
+    std::vector<PairList> threadPairs;
+    std::vector<std::vector<int> > threadSlots;
     boost::unordered_set<std::pair<longint, longint> > exList;  // exclusion list
 
     size_t max_type;
@@ -21,6 +21,7 @@
 */
 
 #include "Autocorrelation.hpp"
+#include "CorrelationFFT.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "esutil/Error.hpp"
 #include "mpi.h"
@@ -60,6 +61,37 @@ void Autocorrelation::pushValue(Real3D value) { valueList.push_back(value); }
 void Autocorrelation::gather(Real3D value) { pushValue(value); }
 
 python::list Autocorrelation::compute()
+{
+    if (!useFFT) return computeDirect();
+
+    unsigned int M = getListSize();
+
+    System& system = getSystemRef();
+
+    // all CPUs store the same values, the correlation is computed by the root alone
+    // with FFTs in O(M log M)
+    python::list pyli;
+
+    if (system.comm->rank() == 0 && M > 0)
+    {
+        CorrelationFFT correlation(M);
+        vector<real> series(M), Z(M, 0.0);
+        for (int d = 0; d < 3; d++)
+        {
+            for (unsigned int n = 0; n < M; n++) series[n] = valueList[n][d];
+            correlation.addProducts(series.data(), Z.data());
+        }
+
+        real coef = 3.0;  // only if value is Real3D
+
+        for (unsigned int m = 0; m < M; m++) pyli.append(Z[m] / ((real)(M - m) * coef));
+    }
+
+    return pyli;
+}
+
+// the direct O(M^2) sums over the time origins, the lags are distributed over the CPUs
+python::list Autocorrelation::computeDirect()
 {
     auto M = getListSize();
 
@@ -179,6 +211,7 @@ void Autocorrelation::registerPython()
         .def("all", &Autocorrelation::all)
         .def("clear", &Autocorrelation::clear)
         .def("compute", &Autocorrelation::compute)
+        .add_property("useFFT", &Autocorrelation::getUseFFT, &Autocorrelation::setUseFFT)
 
         ;
 }
@@ -49,7 +49,7 @@ class Autocorrelation : public SystemAccess
 {
 public:
     // Constructor, allow for unlimited snapshots.
-    Autocorrelation(std::shared_ptr<System> system) : SystemAccess(system) {}
+    Autocorrelation(std::shared_ptr<System> system) : SystemAccess(system), useFFT(true) {}
     ~Autocorrelation() { valueList.clear(); }
 
     // get number of available snapshots. Returns the size of ValueList
@@ -69,10 +69,17 @@ public:
 
     python::list compute();
 
+    // compute the sums over time origins with FFTs, O(M log M) instead of O(M^2)
+    void setUseFFT(bool _useFFT) { useFFT = _useFFT; }
+    bool getUseFFT() { return useFFT; }
+
     static void registerPython();
 
 private:
     void pushValue(Real3D);
+    python::list computeDirect();
+
+    bool useFFT;
 
     // the list of snapshots
     vector<Real3D> valueList;
@@ -42,6 +42,11 @@ espressopp.analysis.Autocorrelation
                 :param value:
                 :type value:
                 :rtype:
+
+.. attribute:: espressopp.analysis.Autocorrelation.useFFT
+
+                compute() sums over the time origins with FFTs, O(M log M) in the
+                number of values M instead of O(M^2) (default: True)
 """
 from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -68,5 +73,5 @@ if pmi.isController:
           cls =  'espressopp.analysis.AutocorrelationLocal',
           pmicall = [ "gather", "clear", "compute" ],
           localcall = ["__getitem__", "all"],
-          pmiproperty = ["size"]
+          pmiproperty = ["size", "useFFT"]
         )
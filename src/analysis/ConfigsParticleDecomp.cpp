@@ -93,7 +93,8 @@ void ConfigsParticleDecomp::gather()
         }
     }
 
-    ConfigurationPtr config = std::make_shared<Configuration>();
+    // the particles of this CPU, collected in id order before they are stored
+    map<size_t, Real3D> mine;
     for (int rank_i = 0; rank_i < nprocs; rank_i++)
     {
         map<size_t, Real3D> conf;
@@ -133,11 +134,16 @@ void ConfigsParticleDecomp::gather()
         for (map<size_t, Real3D>::iterator itr = conf.begin(); itr != conf.end(); ++itr)
         {
             size_t id = itr->first;
-            Real3D p = itr->second;
-            if (idToCpu[id] == myrank) config->set(id, p[0], p[1], p[2]);
+            if (idToCpu[id] == myrank) mine[id] = itr->second;
         }
     }
 
+    ConfigurationPtr config = std::make_shared<Configuration>();
+    for (map<size_t, Real3D>::iterator itr = mine.begin(); itr != mine.end(); ++itr)
+    {
+        Real3D p = itr->second;
+        config->set(itr->first, p[0], p[1], p[2]);
+    }
     pushConfig(config);
 }
 
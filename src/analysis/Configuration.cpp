@@ -22,7 +22,9 @@
 
 #include "python.hpp"
 #include "Configuration.hpp"
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <stdexcept>
 #include "Real3D.hpp"
 
@@ -50,10 +52,43 @@ Configuration::Configuration()
 
 Configuration::~Configuration() {}
 
+std::vector<size_t> Configuration::idOrder(const std::vector<longint>& ids)
+{
+    std::vector<size_t> order(ids.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&ids](size_t a, size_t b) { return ids[a] < ids[b]; });
+    return order;
+}
+
+size_t Configuration::find(size_t id) const
+{
+    auto it = std::lower_bound(ids.begin(), ids.end(), id);
+    return it != ids.end() && *it == id ? it - ids.begin() : ids.size();
+}
+
+size_t Configuration::add(size_t id)
+{
+    // filled in ascending id order, so appending is the usual case
+    size_t i = ids.size();
+    if (!ids.empty() && id <= ids.back())
+    {
+        i = std::lower_bound(ids.begin(), ids.end(), id) - ids.begin();
+        if (ids[i] == id) return i;
+    }
+    ids.insert(ids.begin() + i, id);
+    if (gatherPos) coordinates.insert(coordinates.begin() + i, Real3D(0, 0, 0));
+    if (gatherVel) velocities.insert(velocities.begin() + i, Real3D(0, 0, 0));
+    if (gatherForce) forces.insert(forces.begin() + i, Real3D(0, 0, 0));
+    if (gatherRadius) radii.insert(radii.begin() + i, 0);
+    return i;
+}
+
 void Configuration::set(size_t index, real x, real y, real z)
 {
     if (gatherPos)
-        coordinates[index] = Real3D(x, y, z);
+    {
+        coordinates[add(index)] = Real3D(x, y, z);
+    }
     else
     {
         std::cout << "Error: This configuration does not store coordinates" << std::endl;
@@ -63,7 +98,9 @@ void Configuration::set(size_t index, real x, real y, real z)
 void Configuration::setCoordinates(size_t index, Real3D _pos)
 {
     if (gatherPos)
-        coordinates[index] = _pos;
+    {
+        coordinates[add(index)] = _pos;
+    }
     else
     {
         std::cout << "Error: This configuration does not store coordinates" << std::endl;
@@ -73,7 +110,9 @@ void Configuration::setCoordinates(size_t index, Real3D _pos)
 void Configuration::setVelocities(size_t index, Real3D _vel)
 {
     if (gatherVel)
-        velocities[index] = _vel;
+    {
+        velocities[add(index)] = _vel;
+    }
     else
     {
         std::cout << "Error: This configuration does not store velocities" << std::endl;
@@ -83,7 +122,9 @@ void Configuration::setVelocities(size_t index, Real3D _vel)
 void Configuration::setForces(size_t index, Real3D _forces)
 {
     if (gatherForce)
-        forces[index] = _forces;
+    {
+        forces[add(index)] = _forces;
+    }
     else
     {
         std::cout << "Error: This configuration does not store forces" << std::endl;
@@ -93,7 +134,9 @@ void Configuration::setForces(size_t index, Real3D _forces)
 void Configuration::setRadius(size_t index, real _radius)
 {
     if (gatherRadius)
-        radii[index] = _radius;
+    {
+        radii[add(index)] = _radius;
+    }
     else
     {
         std::cout << "Error: This configuration does not store radii" << std::endl;
@@ -103,7 +146,10 @@ void Configuration::setRadius(size_t index, real _radius)
 Real3D Configuration::getCoordinates(size_t index)
 {
     if (gatherPos)
-        return coordinates[index];
+    {
+        size_t i = find(index);
+        return i < ids.size() ? coordinates[i] : Real3D(0, 0, 0);
+    }
     else
     {
         std::cout << "Error: This configuration has no information about coordinates" << std::endl;
@@ -114,7 +160,10 @@ Real3D Configuration::getCoordinates(size_t index)
 Real3D Configuration::getVelocities(size_t index)
 {
     if (gatherVel)
-        return velocities[index];
+    {
+        size_t i = find(index);
+        return i < ids.size() ? velocities[i] : Real3D(0, 0, 0);
+    }
     else
     {
         std::cout << "Error: This configuration has no information about velocities" << std::endl;
@@ -125,7 +174,10 @@ Real3D Configuration::getVelocities(size_t index)
 Real3D Configuration::getForces(size_t index)
 {
     if (gatherForce)
-        return forces[index];
+    {
+        size_t i = find(index);
+        return i < ids.size() ? forces[i] : Real3D(0, 0, 0);
+    }
     else
     {
         std::cout << "Error: This configuration has no information about forces" << std::endl;
@@ -136,7 +188,10 @@ Real3D Configuration::getForces(size_t index)
 real Configuration::getRadius(size_t index)
 {
     if (gatherRadius)
-        return radii[index];
+    {
+        size_t i = find(index);
+        return i < ids.size() ? radii[i] : 0;
+    }
     else
     {
         std::cout << "Error: This configuration has no information about radii" << std::endl;
@@ -144,40 +199,13 @@ real Configuration::getRadius(size_t index)
     }
 }
 
-size_t Configuration::getSize()
-{
-    size_t sizePos = coordinates.size();
-    size_t sizeVel = velocities.size();
-    size_t sizeForce = forces.size();
-    size_t sizeRadius = radii.size();
-
-    if (sizePos > 0) return sizePos;
-    if (sizeVel > 0) return sizeVel;
-    if (sizeForce > 0) return sizeForce;
-    if (sizeRadius > 0) return sizeRadius;
-
-    return 0;
-}
+size_t Configuration::getSize() { return ids.size(); }
 
 boost::python::list Configuration::getIds()
 {
-    boost::python::list ids;
-
-    size_t sizePos = coordinates.size();
-    size_t sizeVel = velocities.size();
-    size_t sizeForce = forces.size();
-    size_t sizeRadius = radii.size();
-
-    if (sizePos > 0)
-        for (auto m : coordinates) ids.append(m.first);
-    else if (sizeVel > 0)
-        for (auto m : velocities) ids.append(m.first);
-    else if (sizeForce > 0)
-        for (auto m : forces) ids.append(m.first);
-    else if (sizeRadius > 0)
-        for (auto m : radii) ids.append(m.first);
-
-    return ids;
+    boost::python::list result;
+    for (size_t id : ids) result.append(id);
+    return result;
 }
 
 /*
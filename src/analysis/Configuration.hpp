@@ -26,7 +26,7 @@
 
 #include "types.hpp"
 #include "SystemAccess.hpp"
-#include <map>
+#include <vector>
 
 namespace espressopp
 {
@@ -50,7 +50,13 @@ private:
 };
 */
 
-/** Class that stores particle positions for later analysis. */
+/** Class that stores particle positions for later analysis.
+
+    The ids are kept sorted in one array and the properties in dense arrays of
+    the same order, so the memory grows with the number of particles and not
+    with the largest id. A lookup is a binary search, and the ids are visited
+    in ascending order.
+*/
 class Configuration
 {
 public:
@@ -68,14 +74,23 @@ public:
     void setVelocities(size_t id, Real3D _vel);
     void setForces(size_t id, Real3D _forces);
     void setRadius(size_t id, real _rad);
+
+    /** Indices of the given ids in ascending id order. Filling a configuration in
+        this order only appends to the arrays. */
+    static std::vector<size_t> idOrder(const std::vector<longint>& ids);
+
     static void registerPython();
     // class ConfigurationIterator getIterator();
 private:
+    size_t find(size_t id) const;  // position of id, ids.size() if absent
+    size_t add(size_t id);         // position of id, inserted if absent
+
     bool gatherPos, gatherVel, gatherForce, gatherRadius;
-    std::map<size_t, Real3D> coordinates;
-    std::map<size_t, Real3D> velocities;
-    std::map<size_t, Real3D> forces;
-    std::map<size_t, real> radii;
+    std::vector<size_t> ids;
+    std::vector<Real3D> coordinates;
+    std::vector<Real3D> velocities;
+    std::vector<Real3D> forces;
+    std::vector<real> radii;
 };
 }  // namespace analysis
 }  // namespace espressopp
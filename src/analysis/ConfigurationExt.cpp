@@ -24,7 +24,9 @@
 
 #include "python.hpp"
 #include "ConfigurationExt.hpp"
+#include <algorithm>
 #include <cmath>
+#include <sstream>
 #include <stdexcept>
 #include "Real3D.hpp"
 
@@ -38,25 +40,57 @@ namespace espressopp
 namespace analysis
 {
 ConfigurationExt::ConfigurationExt()  // int nParticles
+    : dimension(0)
 {
     // this->nParticles = nParticles;
 }
 
 ConfigurationExt::~ConfigurationExt() {}
 
-// FIXME
-// passing std::vector by value is very slow and should be avoided
-// however, passing reference is dangerous, since the original object might not survive until the
-// end of this class how should I use const here?
 void ConfigurationExt::set(size_t index, RealND vec)
 {
-    particleProperties[index].setDimension(vec.getDimension());
-    particleProperties[index] = vec;
-    // coordinates[index] = Real3D(x, y, z);
-    // velocities[index] = Real3D(vx, vy, vz);
+    set(index, vec.getDimension() ? &vec[0] : nullptr, vec.getDimension());
 }
 
-RealND ConfigurationExt::getProperties(size_t index) { return particleProperties[index]; }
+void ConfigurationExt::set(size_t index, const real* vec, int dim)
+{
+    if (ids.empty()) dimension = dim;
+    if (dim != dimension)
+    {
+        std::ostringstream msg;
+        msg << "ConfigurationExt stores " << dimension << " properties per particle, got " << dim;
+        throw std::runtime_error(msg.str());
+    }
+
+    // filled in ascending id order, so appending is the usual case
+    size_t i = ids.size();
+    if (!ids.empty() && index <= ids.back())
+    {
+        i = std::lower_bound(ids.begin(), ids.end(), index) - ids.begin();
+    }
+    if (i == ids.size() || ids[i] != index)
+    {
+        ids.insert(ids.begin() + i, index);
+        particleProperties.insert(particleProperties.begin() + i * dimension, dimension, 0.0);
+    }
+    std::copy(vec, vec + dim, particleProperties.begin() + i * dimension);
+}
+
+size_t ConfigurationExt::find(size_t id) const
+{
+    auto it = std::lower_bound(ids.begin(), ids.end(), id);
+    return it != ids.end() && *it == id ? it - ids.begin() : ids.size();
+}
+
+RealND ConfigurationExt::getProperties(size_t index)
+{
+    size_t i = find(index);
+    if (i == ids.size()) return RealND();
+
+    RealND props(dimension);
+    for (int k = 0; k < dimension; k++) props[k] = particleProperties[i * dimension + k];
+    return props;
+}
 /*
 Real3D ConfigurationExt::getCoordinates(size_t index)
 {
@@ -76,40 +110,36 @@ size_t ConfigurationExt::getSize()
 
 ConfigurationExtIterator ConfigurationExt::getIterator()
 {
-    return ConfigurationExtIterator(particleProperties);
-    // return ConfigurationExtIterator(coordinates);
+    return ConfigurationExtIterator(*this);
 }
 
-// ConfigurationExtIterator::ConfigurationExtIterator(std::map<size_t, Real3D>& coordinates)
-ConfigurationExtIterator::ConfigurationExtIterator(std::map<size_t, RealND>& particleProperties)
+ConfigurationExtIterator::ConfigurationExtIterator(const ConfigurationExt& _conf)
+    : conf(_conf), it(0)
 {
-    it = particleProperties.begin();
-    end = particleProperties.end();
-    // it = coordinates.begin();
-    // end = coordinates.end();
 }
 
 size_t ConfigurationExtIterator::currentId()
 {
-    if (it == end)
+    if (it >= conf.ids.size())
     {
         PyErr_SetString(PyExc_StopIteration, "No more data.");
         boost::python::throw_error_already_set();
     }
 
-    size_t id = (*it).first;
-    return id;
+    return conf.ids[it];
 }
 
 RealND ConfigurationExtIterator::currentProperties()
 {
-    if (it == end)
+    if (it >= conf.ids.size())
     {
         PyErr_SetString(PyExc_StopIteration, "No more data.");
         boost::python::throw_error_already_set();
     }
 
-    RealND props = (*it).second;
+    RealND props(conf.dimension);
+    for (int k = 0; k < conf.dimension; k++)
+        props[k] = conf.particleProperties[it * conf.dimension + k];
     return props;
 }
 
@@ -117,28 +147,15 @@ void ConfigurationExtIterator::incrementIterator() { it++; }
 
 size_t ConfigurationExtIterator::nextId()
 {
-    if (it == end)
-    {
-        PyErr_SetString(PyExc_StopIteration, "No more data.");
-        boost::python::throw_error_already_set();
-    }
-
-    size_t id = (*it).first;
-    it++;
+    size_t id = currentId();
+    incrementIterator();
     return id;
 }
 
-// bad performance - or the compiler is smart
 const RealND ConfigurationExtIterator::nextProperties()
 {
-    if (it == end)
-    {
-        PyErr_SetString(PyExc_StopIteration, "No more data.");
-        boost::python::throw_error_already_set();
-    }
-
-    RealND props = (*it).second;
-    it++;
+    RealND props = currentProperties();
+    incrementIterator();
     return props;
 }
 /*
@@ -28,7 +28,7 @@
 
 #include "SystemAccess.hpp"
 #include "RealND.hpp"
-#include <map>
+#include <vector>
 
 namespace espressopp
 {
@@ -41,8 +41,7 @@ typedef std::shared_ptr<class ConfigurationExt> ConfigurationExtPtr;
 class ConfigurationExtIterator
 {
 public:
-    ConfigurationExtIterator(std::map<size_t, RealND>& coordinates);
-    // ConfigurationExtIterator(std::map<size_t, Real3D>& coordinates);
+    ConfigurationExtIterator(const class ConfigurationExt& conf);
 
     size_t currentId();
     RealND currentProperties();
@@ -57,13 +56,15 @@ public:
     // Real3D nextVelocities();
 
 private:
-    std::map<size_t, RealND>::iterator it;
-    std::map<size_t, RealND>::iterator end;
-    // std::map<size_t, Real3D>::iterator it;
-    // std::map<size_t, Real3D>::iterator end;
+    const class ConfigurationExt& conf;
+    size_t it;  // position in the sorted ids
 };
 
-/** Class that stores particle positions for later analysis. */
+/** Class that stores particle positions for later analysis.
+
+    The properties of all particles have the same dimension and are stored
+    contiguously in one array, in the order of the sorted ids of the particles.
+*/
 
 class ConfigurationExt
 {
@@ -76,10 +77,12 @@ public:
     // Real3D getCoordinates(size_t id);
     // Real3D getVelocities(size_t id);
 
-    inline size_t getSize() { return particleProperties.size(); }
+    inline size_t getSize() { return ids.size(); }
     // size_t getSize();
 
     void set(size_t id, RealND vec);
+    /** Set the dim properties of a particle from a plain array. */
+    void set(size_t id, const real* vec, int dim);
     // void set(size_t id, real x, real y, real z, real vx, real vy, real vz);
 
     // int nParticles;     // number of particles of the configuration
@@ -89,9 +92,13 @@ public:
     class ConfigurationExtIterator getIterator();
 
 private:
-    std::map<size_t, RealND> particleProperties;
-    //      std::map<size_t, Real3D> coordinates;
-    //      std::map<size_t, Real3D> velocities;
+    friend class ConfigurationExtIterator;
+
+    size_t find(size_t id) const;  // position of id, ids.size() if absent
+
+    int dimension;  // number of properties per particle, fixed by the first set()
+    std::vector<size_t> ids;
+    std::vector<real> particleProperties;
 };
 
 }  // namespace analysis
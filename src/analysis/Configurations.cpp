@@ -26,13 +26,11 @@
 #include "storage/Storage.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "bc/BC.hpp"
-#include "mpi.h"
+#include "esutil/Collectives.hpp"
 #include <cmath>
 
 using namespace espressopp;
 
-#define DEFAULT_TAG 71
-
 namespace espressopp
 {
 namespace analysis
@@ -109,37 +107,22 @@ void Configurations::gather()
 {
     System& system = getSystemRef();
 
-    // determine number of local particles and total particles
+    // fill the buffers with my values, the enabled properties of a particle are
+    // stored one after the other
 
+    int stride = (gatherPos ? 3 : 0) + (gatherVel ? 3 : 0) + (gatherForce ? 3 : 0) +
+                 (gatherRadius ? 1 : 0);
     int myN = system.storage->getNRealParticles();
-    int maxN;    // maximal number of particles one processor has
-    int totalN;  // totlal number of particles all processors have
-
-    boost::mpi::all_reduce(*system.comm, myN, maxN, boost::mpi::maximum<int>());
-    boost::mpi::all_reduce(*system.comm, myN, totalN, std::plus<int>());
-
-    LOG4ESPP_INFO(logger,
-                  "#Partices: me = " << myN << ", max = " << maxN << ", totalN = " << totalN);
-
-    int* ids = new int[maxN];  // buffer for gather
-    Real3D* coordinates = nullptr;
-    Real3D* velocities = nullptr;
-    Real3D* forces = nullptr;
-    real* radii = nullptr;
-
-    if (gatherPos) coordinates = new Real3D[maxN];  // buffer for gather
-    if (gatherVel) velocities = new Real3D[maxN];   // buffer for gather
-    if (gatherForce) forces = new Real3D[maxN];     // buffer for gather
-    if (gatherRadius) radii = new real[maxN];       // buffer for gather
-
-    // fill the buffer with my values
+    std::vector<longint> ids;
+    std::vector<real> props;
+    ids.reserve(myN);
+    props.reserve(stride * myN);
 
     CellList realCells = system.storage->getRealCells();
 
-    int i = 0;
     for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
     {
-        ids[i] = cit->id();
+        ids.push_back(cit->id());
         if (gatherPos)
         {
             Real3D pos = cit->position();
@@ -151,165 +134,58 @@ void Configurations::gather()
                 else
                     system.bc->unfoldPosition(pos, img);
             }
-            coordinates[i] = pos;
+            props.insert(props.end(), pos.get(), pos.get() + 3);
         }
-        if (gatherVel) velocities[i] = cit->velocity();
-        if (gatherForce) forces[i] = cit->force();
-        if (gatherRadius) radii[i] = cit->radius();
-        i++;
+        if (gatherVel) props.insert(props.end(), cit->velocity().get(), cit->velocity().get() + 3);
+        if (gatherForce) props.insert(props.end(), cit->force().get(), cit->force().get() + 3);
+        if (gatherRadius) props.push_back(cit->radius());
     }
 
-    if (i != myN)
+    if (int(ids.size()) != myN)
     {
         LOG4ESPP_ERROR(logger, "mismatch for number of local particles");
     }
 
-    // each proc sends its data to master process
+    // the master process collects the data of all processors in rank order
+
+    std::vector<longint> allIds;
+    std::vector<real> allProps;
+    esutil::Collectives::gatherv(*system.comm, ids, allIds, 0);
+    esutil::Collectives::gatherv(*system.comm, props, allProps, 0);
 
     if (system.comm->rank() == 0)
     {
-        ConfigurationPtr config = std::make_shared<Configuration>(gatherPos, gatherVel, gatherForce,
-                                                                  gatherRadius);  // totalN
-
-        // root process collects data from all processors and sets it
+        LOG4ESPP_INFO(logger, "add " << allIds.size() << " particles");
 
-        int nproc = system.comm->size();
+        ConfigurationPtr config =
+            std::make_shared<Configuration>(gatherPos, gatherVel, gatherForce, gatherRadius);
 
-        for (int iproc = 0; iproc < nproc; iproc++)
+        for (size_t i : Configuration::idOrder(allIds))
         {
-            int nother;
-            if (iproc)
+            size_t index = allIds[i];
+            const real* p = &allProps[stride * i];
+            if (gatherPos)
             {
-                int nIds, nVals;  // number of received values
-                boost::mpi::request req;
-                boost::mpi::status stat;
-                LOG4ESPP_DEBUG(logger, "receive tags from " << iproc);
-                req = system.comm->irecv<int>(iproc, DEFAULT_TAG, ids, maxN);
-                system.comm->send(iproc, DEFAULT_TAG, 0);
-                stat = req.wait();
-                nIds = *stat.count<int>();
-                if (gatherPos)
-                {
-                    req = system.comm->irecv<Real3D>(iproc, DEFAULT_TAG, coordinates, maxN);
-                    system.comm->send(iproc, DEFAULT_TAG, 0);
-                    stat = req.wait();
-                    nVals = *stat.count<Real3D>();
-                    if (nVals != nIds)
-                    {
-                        LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                                   << nIds << " ids, but " << nVals
-                                                   << " coordinates");
-                    }
-                }
-                if (gatherVel)
-                {
-                    req = system.comm->irecv<Real3D>(iproc, DEFAULT_TAG, velocities, maxN);
-                    system.comm->send(iproc, DEFAULT_TAG, 0);
-                    stat = req.wait();
-                    nVals = *stat.count<Real3D>();
-                    if (nVals != nIds)
-                    {
-                        LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                                   << nIds << " ids, but " << nVals
-                                                   << " velocities");
-                    }
-                }
-                if (gatherForce)
-                {
-                    req = system.comm->irecv<Real3D>(iproc, DEFAULT_TAG, forces, maxN);
-                    system.comm->send(iproc, DEFAULT_TAG, 0);
-                    stat = req.wait();
-                    nVals = *stat.count<Real3D>();
-                    if (nVals != nIds)
-                    {
-                        LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                                   << nIds << " ids, but " << nVals << " forces");
-                    }
-                }
-                if (gatherRadius)
-                {
-                    req = system.comm->irecv<real>(iproc, DEFAULT_TAG, radii, maxN);
-                    system.comm->send(iproc, DEFAULT_TAG, 0);
-                    stat = req.wait();
-                    nVals = *stat.count<real>();
-                    if (nVals != nIds)
-                    {
-                        LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                                   << nIds << " ids, but " << nVals << " radii");
-                    }
-                }
-                nother = nIds;
+                config->setCoordinates(index, Real3D(p[0], p[1], p[2]));
+                p += 3;
             }
-            else
+            if (gatherVel)
             {
-                nother = myN;
+                config->setVelocities(index, Real3D(p[0], p[1], p[2]));
+                p += 3;
             }
-
-            LOG4ESPP_INFO(logger, "add " << nother << " coordinates of proc " << iproc);
-
-            for (int i = 0; i < nother; i++)
+            if (gatherForce)
             {
-                // LOG4ESPP_DEBUG(logger, "set coordinates of particle with id = " << index <<
-                //                       ": " << coordinates[3*i] << " " <<  coordinates[3*i+1] << "
-                //                       " << coordinates[3*i+2]);
-                int index = ids[i];
-                if (gatherPos) config->setCoordinates(index, coordinates[i]);
-                if (gatherVel) config->setVelocities(index, velocities[i]);
-                if (gatherForce) config->setForces(index, forces[i]);
-                if (gatherRadius) config->setRadius(index, radii[i]);
+                config->setForces(index, Real3D(p[0], p[1], p[2]));
+                p += 3;
             }
+            if (gatherRadius) config->setRadius(index, *p++);
         }
 
         LOG4ESPP_INFO(logger, "save the latest configuration");
 
         pushConfig(config);
     }
-    else
-    {
-        LOG4ESPP_INFO(logger, "proc " << system.comm->rank() << " sends data " << " of " << myN
-                                      << " particles");
-
-        // not master process, send data to master process
-
-        int tmp;
-
-        boost::mpi::status stat;
-
-        // wait for a signal (empty message) before sending
-
-        system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-        system.comm->send<int>(0, DEFAULT_TAG, ids, myN);
-        if (gatherPos)
-        {
-            system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-            system.comm->send<Real3D>(0, DEFAULT_TAG, coordinates, myN);
-        }
-        if (gatherVel)
-        {
-            system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-            system.comm->send<Real3D>(0, DEFAULT_TAG, velocities, myN);
-        }
-        if (gatherForce)
-        {
-            system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-            system.comm->send<Real3D>(0, DEFAULT_TAG, forces, myN);
-        }
-        if (gatherRadius)
-        {
-            system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-            system.comm->send<real>(0, DEFAULT_TAG, radii, myN);
-        }
-    }
-
-    // ToDo: remove first configuration if capacity is exhausted
-
-    // master process saves the configuration
-
-    if (gatherRadius) delete[] radii;
-    if (gatherForce) delete[] forces;
-    if (gatherVel) delete[] velocities;
-    if (gatherPos) delete[] coordinates;
-    delete[] ids;
 }
 
 // Python wrapping
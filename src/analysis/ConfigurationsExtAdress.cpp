@@ -23,16 +23,15 @@
 #include "python.hpp"
 #include <boost/python.hpp>
 #include "ConfigurationsExtAdress.hpp"
+#include "Configuration.hpp"
 #include "storage/Storage.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "bc/BC.hpp"
-#include "mpi.h"
+#include "esutil/Collectives.hpp"
 #include <cmath>
 
 using namespace espressopp;
 
-#define DEFAULT_TAG 71
-
 namespace espressopp
 {
 namespace analysis
@@ -112,215 +111,64 @@ void ConfigurationsExtAdress::gather()
 {
     System& system = getSystemRef();
 
-    // determine number of local particles and total particles
+    // fill the buffers with the atomistic particles of my virtual particles,
+    // 6 reals per particle: p[0].p[1].p[2].v[0].v[1].v[2]
 
+    const int dim = 6;
     int myN = system.storage->getNAdressParticles();
-    int maxN;    // maximal number of particles one processor has
-    int totalN;  // totlal number of particles all processors have
-
-    boost::mpi::all_reduce(*system.comm, myN, maxN, boost::mpi::maximum<int>());
-    boost::mpi::all_reduce(*system.comm, myN, totalN, std::plus<int>());
-
-    LOG4ESPP_INFO(logger,
-                  "#Partices: me = " << myN << ", max = " << maxN << ", totalN = " << totalN);
+    std::vector<longint> ids;
+    std::vector<real> props;
+    ids.reserve(myN);
+    props.reserve(dim * myN);
 
-    real* coordinates = new real[3 * maxN];  // buffer for gather
-    real* velocities = new real[3 * maxN];   // buffer for gather
-    int* ids = new int[maxN];                // buffer for gather
+    CellList realCells = system.storage->getRealCells();
+    Real3D L = system.bc->getBoxL();
 
-    // fill the buffer with my values
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {  // loop over virtual particles
+        FixedTupleListAdress::iterator it3 = fixedTupleList->find(&(*cit));
+        if (it3 == fixedTupleList->end()) continue;
 
-    CellList realCells = system.storage->getRealCells();
+        for (Particle* atp : it3->second)
+        {  // loop over atomistic particles
+            Particle& at = *atp;
+            ids.push_back(at.id());
 
-    int i = 0;
+            Real3D& pos = at.position();
+            Real3D& vel = at.velocity();
+            Int3D& img = at.image();
 
-    if (unfolded)
-    {
-        for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
-        {  // loop over virtual particles
-
-            FixedTupleListAdress::iterator it3;
-            it3 = fixedTupleList->find(&(*cit));
-            if (it3 != fixedTupleList->end())
-            {
-                std::vector<Particle*> atList1;
-                atList1 = it3->second;
-                for (std::vector<Particle*>::iterator itv = atList1.begin(); itv != atList1.end();
-                     ++itv)
-                {  // loop over atomistic particles
-
-                    Particle& at = **itv;
-                    ids[i] = at.id();
-                    Real3D& pos = at.position();
-                    Real3D& vel = at.velocity();
-                    Int3D& img = at.image();
-                    Real3D L = system.bc->getBoxL();
-
-                    coordinates[3 * i] = pos[0] + img[0] * L[0];
-                    coordinates[3 * i + 1] = pos[1] + img[1] * L[1];
-                    coordinates[3 * i + 2] = pos[2] + img[2] * L[2];
-
-                    velocities[3 * i] = vel[0];
-                    velocities[3 * i + 1] = vel[1];
-                    velocities[3 * i + 2] = vel[2];
-
-                    i++;
-                }
-            }
-        }
-    }
-    else
-    {
-        for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
-        {
-            FixedTupleListAdress::iterator it3;
-            it3 = fixedTupleList->find(&(*cit));
-            if (it3 != fixedTupleList->end())
-            {
-                std::vector<Particle*> atList1;
-                atList1 = it3->second;
-                for (std::vector<Particle*>::iterator itv = atList1.begin(); itv != atList1.end();
-                     ++itv)
-                {  // loop over atomistic particles
-
-                    Particle& at = **itv;
-                    ids[i] = at.id();
-                    Real3D& pos = at.position();
-                    Real3D& vel = at.velocity();
-
-                    coordinates[3 * i] = pos[0];
-                    coordinates[3 * i + 1] = pos[1];
-                    coordinates[3 * i + 2] = pos[2];
-
-                    velocities[3 * i] = vel[0];
-                    velocities[3 * i + 1] = vel[1];
-                    velocities[3 * i + 2] = vel[2];
-
-                    i++;
-                }
-            }
+            for (int k = 0; k < 3; k++)
+                props.push_back(unfolded ? pos[k] + img[k] * L[k] : pos[k]);
+            for (int k = 0; k < 3; k++) props.push_back(vel[k]);
         }
     }
 
-    if (i != myN)
+    if (int(ids.size()) != myN)
     {
         LOG4ESPP_ERROR(logger, "mismatch for number of local particles");
     }
 
-    // each proc sends its data to master process
+    // the master process collects the data of all processors in rank order
+
+    std::vector<longint> allIds;
+    std::vector<real> allProps;
+    esutil::Collectives::gatherv(*system.comm, ids, allIds, 0);
+    esutil::Collectives::gatherv(*system.comm, props, allProps, 0);
 
     if (system.comm->rank() == 0)
     {
-        ConfigurationExtPtr config = std::make_shared<ConfigurationExt>();  // totalN
-
-        // root process collects data from all processors and sets it
-
-        int nproc = system.comm->size();
-
-        for (int iproc = 0; iproc < nproc; iproc++)
-        {
-            int nother;
-
-            if (iproc)
-            {
-                int nIds, nCoords, nVelocs;  // number of received values
-                // int tmp;
-
-                boost::mpi::request req;
-                boost::mpi::status stat;
-
-                LOG4ESPP_DEBUG(logger, "receive tags from " << iproc);
-
-                req = system.comm->irecv<int>(iproc, DEFAULT_TAG, ids, maxN);
-                system.comm->send(iproc, DEFAULT_TAG, 0);
-                stat = req.wait();
-                nIds = *stat.count<int>();
-
-                req = system.comm->irecv<real>(iproc, DEFAULT_TAG, coordinates, 3 * maxN);
-                system.comm->send(iproc, DEFAULT_TAG, 0);
-                stat = req.wait();
-                nCoords = *stat.count<real>();
-
-                // make sure to have 3 coordinate values for each id
+        LOG4ESPP_INFO(logger, "add " << allIds.size() << " particles");
 
-                if (nCoords != 3 * nIds)
-                {
-                    LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                               << nIds << " ids, but " << nCoords
-                                               << " coordinates");
-                }
+        ConfigurationExtPtr config = std::make_shared<ConfigurationExt>();
 
-                req = system.comm->irecv<real>(iproc, DEFAULT_TAG, velocities, 3 * maxN);
-                system.comm->send(iproc, DEFAULT_TAG, 0);
-                stat = req.wait();
-                nVelocs = *stat.count<real>();
-
-                // make sure to have 3 velocities values for each id
-
-                if (nVelocs != 3 * nIds)
-                {
-                    LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                               << nIds << " ids, but " << nVelocs << " velocities");
-                }
-
-                nother = nIds;
-            }
-            else
-            {
-                nother = myN;
-            }
-
-            LOG4ESPP_INFO(logger, "add " << nother << " coordinates of proc " << iproc);
-
-            for (int i = 0; i < nother; i++)
-            {
-                int index = ids[i];
-
-                LOG4ESPP_INFO(logger, "set coordianates of particle with id = "
-                                          << index << ": " << coordinates[3 * i] << " "
-                                          << coordinates[3 * i + 1] << " " << coordinates[3 * i + 2]
-                                          << "and velocities: " << velocities[3 * i] << " "
-                                          << velocities[3 * i + 1] << " " << velocities[3 * i + 2]);
-
-                RealND _vec(6);
-                for (int k = 0; k < 3; k++) _vec.setItem(k, coordinates[3 * i + k]);
-
-                for (int k = 0; k < 3; k++) _vec.setItem(k + 3, velocities[3 * i + k]);
-                config->set(index, _vec);
-            }
-        }
+        for (size_t i : Configuration::idOrder(allIds))
+            config->set(allIds[i], &allProps[dim * i], dim);
 
         LOG4ESPP_INFO(logger, "save the latest configuration");
 
         pushConfig(config);
     }
-    else
-    {
-        LOG4ESPP_INFO(logger, "proc " << system.comm->rank() << " sends data " << " of " << myN
-                                      << " particles");
-
-        // not master process, send data to master process
-
-        int tmp;
-
-        boost::mpi::status stat;
-
-        // wait for a signal (empty message) before sending
-
-        system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-        system.comm->send<int>(0, DEFAULT_TAG, ids, myN);
-        system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-        system.comm->send<real>(0, DEFAULT_TAG, coordinates, 3 * myN);
-        system.comm->send<real>(0, DEFAULT_TAG, velocities, 3 * myN);
-    }
-
-    // ToDo: remove first configuration if capacity is exhausted
-
-    // master process saves the configuration
-
-    delete[] coordinates;
-    delete[] velocities;
-    delete[] ids;
 }
 
 // Python wrapping
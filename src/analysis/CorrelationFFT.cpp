@@ -0,0 +1,102 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CorrelationFFT.hpp"
+
+#include <algorithm>
+
+namespace espressopp
+{
+namespace analysis
+{
+namespace
+{
+// smallest n >= min without prime factors other than 2, 3 and 5
+int fftSize(int min)
+{
+    for (int n = std::max(min, 1);; n++)
+    {
+        int r = n;
+        for (int f : {2, 3, 5})
+            while (r % f == 0) r /= f;
+        if (r == 1) return n;
+    }
+}
+}  // namespace
+
+CorrelationFFT::CorrelationFFT(int _M) : M(_M), N(fftSize(2 * _M)), acf(_M)
+{
+    in = fftw_alloc_real(N);
+    spectrum = fftw_alloc_complex(N / 2 + 1);
+    // a new object is made by every compute(); measuring the plans of a long series would
+    // take longer than the transforms it saves
+    forward = fftw_plan_dft_r2c_1d(N, in, spectrum, FFTW_ESTIMATE);
+    backward = fftw_plan_dft_c2r_1d(N, spectrum, in, FFTW_ESTIMATE);
+}
+
+CorrelationFFT::~CorrelationFFT()
+{
+    fftw_destroy_plan(forward);
+    fftw_destroy_plan(backward);
+    fftw_free(spectrum);
+    fftw_free(in);
+}
+
+void CorrelationFFT::correlate(const real* x)
+{
+    std::copy(x, x + M, in);
+    std::fill(in + M, in + N, 0.0);
+    fftw_execute(forward);
+
+    for (int k = 0; k < N / 2 + 1; k++)
+    {
+        spectrum[k][0] = spectrum[k][0] * spectrum[k][0] + spectrum[k][1] * spectrum[k][1];
+        spectrum[k][1] = 0.0;
+    }
+    fftw_execute(backward);
+
+    // the backward transform is not normalized
+    real norm = 1.0 / N;
+    for (int m = 0; m < M; m++) acf[m] = in[m] * norm;
+}
+
+void CorrelationFFT::addProducts(const real* x, real* out)
+{
+    correlate(x);
+    for (int m = 0; m < M; m++) out[m] += acf[m];
+}
+
+void CorrelationFFT::addSquaredDisplacements(const real* x, real* out)
+{
+    correlate(x);
+
+    // sum_{n=0}^{M-1-m} (x[n]^2 + x[n+m]^2), updated from one lag to the next
+    real sumSq = 0.0;
+    for (int n = 0; n < M; n++) sumSq += x[n] * x[n];
+    sumSq *= 2.0;
+
+    for (int m = 0; m < M; m++)
+    {
+        if (m > 0) sumSq -= x[m - 1] * x[m - 1] + x[M - m] * x[M - m];
+        out[m] += sumSq - 2.0 * acf[m];
+    }
+}
+}  // namespace analysis
+}  // namespace espressopp
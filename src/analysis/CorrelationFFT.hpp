@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ANALYSIS_CORRELATIONFFT_HPP
+#define _ANALYSIS_CORRELATIONFFT_HPP
+
+#include <vector>
+#include <fftw3.h>
+#include <boost/noncopyable.hpp>
+
+#include "types.hpp"
+
+namespace espressopp
+{
+namespace analysis
+{
+/** Sums over all time origins of a series x[0..M-1] for every lag 0 <= m < M,
+    computed in O(M log M) with the Wiener-Khinchin theorem. The series is zero
+    padded to at least 2M points, so that the cyclic correlation of the FFT is
+    the linear one. The plans are made once and reused for many series of the
+    same length, e.g. one per particle and coordinate.
+*/
+class CorrelationFFT : boost::noncopyable
+{
+public:
+    explicit CorrelationFFT(int M);
+    ~CorrelationFFT();
+
+    /** out[m] += sum_{n=0}^{M-1-m} x[n] * x[n+m] */
+    void addProducts(const real* x, real* out);
+    /** out[m] += sum_{n=0}^{M-1-m} (x[n+m] - x[n])^2 */
+    void addSquaredDisplacements(const real* x, real* out);
+
+private:
+    // acf[m] = sum_{n=0}^{M-1-m} x[n] * x[n+m]
+    void correlate(const real* x);
+
+    int M;  // length of the series
+    int N;  // length of the zero padded transform
+    real* in;
+    fftw_complex* spectrum;
+    fftw_plan forward, backward;
+    std::vector<real> acf;
+};
+}  // namespace analysis
+}  // namespace espressopp
+
+#endif
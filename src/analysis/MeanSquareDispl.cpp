@@ -21,6 +21,7 @@
 */
 
 #include "MeanSquareDispl.hpp"
+#include "CorrelationFFT.hpp"
 // #include <algorithm> //for std::sort
 using namespace std;
 // using namespace espressopp;
@@ -87,31 +88,50 @@ python::list MeanSquareDispl::compute() const
     }
 
     // MSD calculation
-    int perc = 0;
-    real denom = 100.0 / (real)M;
-    for (int m = 0; m < M; m++)
+    for (int m = 0; m < M; m++) Z[m] = 0.0;
+    if (useFFT && M > 0)
     {
-        totZ[m] = 0.0;
-        Z[m] = 0.0;
-        for (int n = 0; n < M - m; n++)
+        // time series of each coordinate of a particle
+        CorrelationFFT correlation(M);
+        vector<real> series(3 * M);
+        for (vector<longint>::iterator itr = localIDs.begin(); itr != localIDs.end(); ++itr)
         {
-            for (vector<longint>::iterator itr = localIDs.begin(); itr != localIDs.end(); ++itr)
+            size_t i = *itr;
+            for (int n = 0; n < M; n++)
             {
-                size_t i = *itr;
-
-                Real3D pos1 = getConf(n + m)->getCoordinates(i);  // - centerOfMassList[n+m];
-                Real3D pos2 = getConf(n)->getCoordinates(i);      //     - centerOfMassList[n];
-                Real3D delta = pos2 - pos1;
-                Z[m] += delta.sqr();
+                Real3D pos = getConf(n)->getCoordinates(i);
+                for (int d = 0; d < 3; d++) series[d * M + n] = pos[d];
             }
+            for (int d = 0; d < 3; d++) correlation.addSquaredDisplacements(&series[d * M], Z);
         }
-        if (print_progress && system.comm->rank() == 0)
+    }
+    else
+    {
+        int perc = 0;
+        real denom = 100.0 / (real)M;
+        for (int m = 0; m < M; m++)
         {
-            perc = (int)(m * denom);
-            if (perc % 5 == 0)
+            for (int n = 0; n < M - m; n++)
             {
-                cout << "calculation progress (mean square displacement): " << perc << " %\r"
-                     << flush;
+                for (vector<longint>::iterator itr = localIDs.begin(); itr != localIDs.end();
+                     ++itr)
+                {
+                    size_t i = *itr;
+
+                    Real3D pos1 = getConf(n + m)->getCoordinates(i);  // - centerOfMassList[n+m];
+                    Real3D pos2 = getConf(n)->getCoordinates(i);      //     - centerOfMassList[n];
+                    Real3D delta = pos2 - pos1;
+                    Z[m] += delta.sqr();
+                }
+            }
+            if (print_progress && system.comm->rank() == 0)
+            {
+                perc = (int)(m * denom);
+                if (perc % 5 == 0)
+                {
+                    cout << "calculation progress (mean square displacement): " << perc << " %\r"
+                         << flush;
+                }
             }
         }
     }
@@ -475,7 +495,8 @@ void MeanSquareDispl::registerPython()
         .def("computeG2", &MeanSquareDispl::computeG2)
         .def("computeG3", &MeanSquareDispl::computeG3)
         .add_property("print_progress", &MeanSquareDispl::getPrint_progress,
-                      &MeanSquareDispl::setPrint_progress);
+                      &MeanSquareDispl::setPrint_progress)
+        .add_property("useFFT", &MeanSquareDispl::getUseFFT, &MeanSquareDispl::setUseFFT);
 }
 }  // namespace analysis
 }  // namespace espressopp
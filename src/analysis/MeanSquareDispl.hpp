@@ -45,6 +45,7 @@ public:
     {
         // by default
         setPrint_progress(true);
+        setUseFFT(true);
         key = "unfolded";
     }
 
@@ -53,6 +54,7 @@ public:
     {
         // by default
         setPrint_progress(true);
+        setUseFFT(true);
         key = "unfolded";
     }
 
@@ -66,10 +68,15 @@ public:
 
     bool getPrint_progress() { return print_progress; }
 
+    // compute the sums over time origins of compute() with FFTs, O(M log M) instead of O(M^2)
+    void setUseFFT(bool _useFFT) { useFFT = _useFFT; }
+    bool getUseFFT() { return useFFT; }
+
     static void registerPython();
 
 private:
     bool print_progress;
+    bool useFFT;
     void printReal3D(Real3D v) const
     {
         //                real x, y, z;
@@ -34,6 +34,11 @@ espressopp.analysis.MeanSquareDispl
                 :type chainlength:
                 :type start_pid:
 
+.. attribute:: espressopp.analysis.MeanSquareDispl.useFFT
+
+                compute() sums over the time origins with FFTs, O(M log M) in the
+                number of configurations M instead of O(M^2) (default: True)
+
 .. function:: espressopp.analysis.MeanSquareDispl.computeG2()
 
                 :rtype:
@@ -75,6 +80,6 @@ if pmi.isController:
     class MeanSquareDispl(ConfigsParticleDecomp, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
           cls =  'espressopp.analysis.MeanSquareDisplLocal',
-          pmiproperty = [ 'print_progress' ],
+          pmiproperty = [ 'print_progress', 'useFFT' ],
           pmicall = ["computeG2", 'strange']
         )
@@ -0,0 +1,257 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "MultipleTauCorrelator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include "Buffer.hpp"
+#include "Particle.hpp"
+#include "bc/BC.hpp"
+#include "iterator/CellListIterator.hpp"
+#include "storage/Storage.hpp"
+
+namespace espressopp
+{
+namespace analysis
+{
+using namespace iterator;
+
+MultipleTauCorrelator::MultipleTauCorrelator(std::shared_ptr<System> system,
+                                             std::shared_ptr<integrator::MDIntegrator> _integrator,
+                                             std::string _quantity,
+                                             int _numPoints,
+                                             int _averaging,
+                                             int _numLevels)
+    : ParticleAccess(system),
+      integrator(_integrator),
+      numPoints(_numPoints),
+      averaging(_averaging),
+      numLevels(_numLevels)
+{
+    if (_quantity == "msd")
+        quantity = MSD;
+    else if (_quantity == "vacf")
+        quantity = VACF;
+    else
+        throw std::runtime_error("MultipleTauCorrelator: quantity must be 'msd' or 'vacf'");
+
+    if (averaging < 2 || numPoints < averaging || numPoints % averaging != 0 || numLevels < 1)
+    {
+        throw std::runtime_error(
+            "MultipleTauCorrelator: numPoints must be a multiple of averaging >= 2");
+    }
+
+    reset();
+
+    sigBeforeSend = system->storage->beforeSendParticles.connect(
+        std::bind(&MultipleTauCorrelator::beforeSendParticles, this, std::placeholders::_1,
+                  std::placeholders::_2));
+    sigAfterRecv = system->storage->afterRecvParticles.connect(
+        std::bind(&MultipleTauCorrelator::afterRecvParticles, this, std::placeholders::_1,
+                  std::placeholders::_2));
+}
+
+MultipleTauCorrelator::~MultipleTauCorrelator()
+{
+    sigBeforeSend.disconnect();
+    sigAfterRecv.disconnect();
+}
+
+void MultipleTauCorrelator::reset()
+{
+    histories.clear();
+    corr.assign(numLevels * numPoints, 0.0);
+    numCorr.assign(numLevels * numPoints, 0.0);
+    numSamples = 0;
+    firstStep = secondStep = 0;
+}
+
+MultipleTauCorrelator::History& MultipleTauCorrelator::getHistory(longint id)
+{
+    History& h = histories[id];
+    if (h.numValues.empty())
+    {
+        h.values.resize(numLevels * numPoints * 3);
+        h.accum.assign(numLevels * 3, 0.0);
+        h.numValues.assign(numLevels, 0);
+        h.numAccum.assign(numLevels, 0);
+    }
+    return h;
+}
+
+void MultipleTauCorrelator::add(History& h, int level, const real* x)
+{
+    if (level >= numLevels) return;
+
+    // store x as the newest value of the shift register of this level
+    int n = h.numValues[level]++;
+    int pos = n % numPoints;
+    real* reg = &h.values[level * numPoints * 3];
+    for (int d = 0; d < 3; d++) reg[3 * pos + d] = x[d];
+
+    // the lags below numPoints / averaging are covered by the previous level
+    int minLag = level == 0 ? 0 : numPoints / averaging;
+    int maxLag = std::min(n, numPoints - 1);
+    real* c = &corr[level * numPoints];
+    real* nc = &numCorr[level * numPoints];
+    for (int lag = minLag; lag <= maxLag; lag++)
+    {
+        const real* y = &reg[3 * ((pos - lag + numPoints) % numPoints)];
+        real f = 0.0;
+        if (quantity == MSD)
+        {
+            for (int d = 0; d < 3; d++) f += (x[d] - y[d]) * (x[d] - y[d]);
+        }
+        else
+        {
+            for (int d = 0; d < 3; d++) f += x[d] * y[d];
+        }
+        c[lag] += f;
+        nc[lag] += 1.0;
+    }
+
+    // block average of averaging values, passed on to the next level
+    real* acc = &h.accum[3 * level];
+    for (int d = 0; d < 3; d++) acc[d] += x[d];
+    if (++h.numAccum[level] == averaging)
+    {
+        real avg[3];
+        for (int d = 0; d < 3; d++)
+        {
+            avg[d] = acc[d] / averaging;
+            acc[d] = 0.0;
+        }
+        h.numAccum[level] = 0;
+        add(h, level + 1, avg);
+    }
+}
+
+void MultipleTauCorrelator::sample()
+{
+    System& system = getSystemRef();
+
+    if (numSamples == 0) firstStep = integrator->getStep();
+    if (numSamples == 1) secondStep = integrator->getStep();
+    numSamples++;
+
+    CellList realCells = system.storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        Real3D x;
+        if (quantity == MSD)
+        {
+            x = cit->position();
+            Int3D image = cit->image();
+            system.bc->unfoldPosition(x, image);
+        }
+        else
+        {
+            x = cit->velocity();
+        }
+        add(getHistory(cit->id()), 0, x.get());
+    }
+}
+
+python::list MultipleTauCorrelator::compute() const
+{
+    System& system = getSystemRef();
+
+    int size = numLevels * numPoints;
+    std::vector<real> totCorr(size), totNumCorr(size);
+    boost::mpi::all_reduce(*system.comm, corr.data(), size, totCorr.data(), std::plus<real>());
+    boost::mpi::all_reduce(*system.comm, numCorr.data(), size, totNumCorr.data(),
+                           std::plus<real>());
+
+    real dtSample = (secondStep - firstStep) * integrator->getTimeStep();
+
+    python::list result;
+    long long unit = 1;  // lag unit of a level in samples
+    for (int level = 0; level < numLevels; level++)
+    {
+        int minLag = level == 0 ? 0 : numPoints / averaging;
+        for (int lag = minLag; lag < numPoints; lag++)
+        {
+            int i = level * numPoints + lag;
+            if (totNumCorr[i] == 0) continue;
+            result.append(python::make_tuple(lag * unit * dtSample, totCorr[i] / totNumCorr[i]));
+        }
+        unit *= averaging;
+    }
+    return result;
+}
+
+void MultipleTauCorrelator::beforeSendParticles(ParticleList& pl, OutBuffer& buf)
+{
+    // id and history of every leaving particle that has one
+    std::vector<real> data;
+    for (ParticleList::Iterator pit(pl); pit.isValid(); ++pit)
+    {
+        auto it = histories.find(pit->id());
+        if (it == histories.end()) continue;
+
+        const History& h = it->second;
+        data.push_back(pit->id());
+        data.insert(data.end(), h.values.begin(), h.values.end());
+        data.insert(data.end(), h.accum.begin(), h.accum.end());
+        data.insert(data.end(), h.numValues.begin(), h.numValues.end());
+        data.insert(data.end(), h.numAccum.begin(), h.numAccum.end());
+        histories.erase(it);
+    }
+    buf.write(data);
+}
+
+void MultipleTauCorrelator::afterRecvParticles(ParticleList& pl, InBuffer& buf)
+{
+    std::vector<real> data;
+    buf.read(data);
+
+    size_t numValues = numLevels * numPoints * 3, numAccum = numLevels * 3;
+    size_t i = 0;
+    while (i < data.size())
+    {
+        History& h = getHistory(longint(data[i++]));
+        std::copy(&data[i], &data[i] + numValues, h.values.begin());
+        i += numValues;
+        std::copy(&data[i], &data[i] + numAccum, h.accum.begin());
+        i += numAccum;
+        for (int k = 0; k < numLevels; k++) h.numValues[k] = int(data[i++]);
+        for (int k = 0; k < numLevels; k++) h.numAccum[k] = int(data[i++]);
+    }
+}
+
+void MultipleTauCorrelator::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<MultipleTauCorrelator, bases<ParticleAccess>, boost::noncopyable>(
+        "analysis_MultipleTauCorrelator",
+        init<std::shared_ptr<System>, std::shared_ptr<integrator::MDIntegrator>, std::string, int,
+             int, int>())
+        .add_property("numSamples", &MultipleTauCorrelator::getNumSamples)
+        .def("sample", &MultipleTauCorrelator::sample)
+        .def("reset", &MultipleTauCorrelator::reset)
+        .def("compute", &MultipleTauCorrelator::compute);
+}
+}  // namespace analysis
+}  // namespace espressopp
@@ -0,0 +1,117 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _ANALYSIS_MULTIPLETAUCORRELATOR_HPP
+#define _ANALYSIS_MULTIPLETAUCORRELATOR_HPP
+
+#include <unordered_map>
+#include <vector>
+#include <boost/signals2.hpp>
+
+#include "types.hpp"
+#include "ParticleAccess.hpp"
+#include "integrator/MDIntegrator.hpp"
+
+namespace espressopp
+{
+class InBuffer;
+class OutBuffer;
+
+namespace analysis
+{
+/** On-the-fly multiple-tau correlator of the particle positions (mean square
+    displacement) or velocities (velocity autocorrelation function).
+
+    Every call of perform_action() takes one sample of all particles. Level 0 keeps
+    the last p samples of each particle and correlates the newest one with them for
+    the lags 0..p-1. Every m values of a level are averaged and passed on to the next
+    level, whose lags p/m..p-1 are in units of m^level samples. The memory per
+    particle is p * numLevels values and covers lags up to p * m^(numLevels-1).
+
+    The history of a particle moves with it to another CPU, so the correlator can
+    run during a simulation with domain decomposition.
+*/
+class MultipleTauCorrelator : public ParticleAccess
+{
+public:
+    enum Quantity
+    {
+        MSD,
+        VACF
+    };
+
+    MultipleTauCorrelator(std::shared_ptr<System> system,
+                          std::shared_ptr<integrator::MDIntegrator> integrator,
+                          std::string quantity,
+                          int numPoints,
+                          int averaging,
+                          int numLevels);
+    ~MultipleTauCorrelator() override;
+
+    void perform_action() override { sample(); }
+
+    /// add the current configuration
+    void sample();
+    /// forget all samples
+    void reset();
+
+    /// lag times and correlation of all lags that have data, the same on all CPUs
+    python::list compute() const;
+
+    int getNumSamples() const { return numSamples; }
+
+    static void registerPython();
+
+private:
+    /// shift registers and block averages of one particle
+    struct History
+    {
+        std::vector<real> values;  // numLevels x numPoints x 3, circular per level
+        std::vector<real> accum;   // numLevels x 3
+        std::vector<int> numValues;
+        std::vector<int> numAccum;
+    };
+
+    History& getHistory(longint id);
+    void add(History& h, int level, const real* x);
+
+    void beforeSendParticles(ParticleList& pl, OutBuffer& buf);
+    void afterRecvParticles(ParticleList& pl, InBuffer& buf);
+
+    std::shared_ptr<integrator::MDIntegrator> integrator;
+    Quantity quantity;
+    int numPoints, averaging, numLevels;
+
+    std::unordered_map<longint, History> histories;
+
+    // sums over the local particles and time origins, numLevels x numPoints
+    std::vector<real> corr;
+    std::vector<real> numCorr;
+
+    int numSamples;
+    longint firstStep, secondStep;  // for the time between two samples
+
+    boost::signals2::connection sigBeforeSend, sigAfterRecv;
+};
+}  // namespace analysis
+}  // namespace espressopp
+
+#endif
@@ -0,0 +1,91 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+*****************************************
+espressopp.analysis.MultipleTauCorrelator
+*****************************************
+
+On-the-fly multiple-tau correlator for the mean square displacement or the
+velocity autocorrelation function. Unlike MeanSquareDispl and
+VelocityAutocorrelation it does not store configurations: each particle keeps
+p values on each of the given number of levels, and level k covers lags in units
+of m**k samples, so the lags span several decades at constant memory.
+
+Example Usage:
+
+>>> msd = espressopp.analysis.MultipleTauCorrelator(system, integrator, 'msd', p=16, m=2, levels=20)
+>>> ext = espressopp.integrator.ExtAnalyze(msd, interval=10)
+>>> integrator.addExtension(ext)
+>>> integrator.run(100000)
+>>>
+>>> for tau, value in msd.compute():
+>>>     print(tau, value / 6.0)
+
+.. function:: espressopp.analysis.MultipleTauCorrelator(system, integrator, quantity, p, m, levels)
+
+                :param system: system object
+                :param integrator: integrator, used for the time between samples
+                :param quantity: 'msd' for <|r(t)-r(0)|^2> of the unfolded positions,
+                                 'vacf' for <v(t).v(0)>
+                :param p: number of lags per level, a multiple of m
+                :param m: number of values averaged when going to the next level
+                :param levels: number of levels
+                :type quantity: str
+                :type p: int
+                :type m: int
+                :type levels: int
+
+.. function:: espressopp.analysis.MultipleTauCorrelator.sample()
+
+                adds the current configuration, called by ExtAnalyze
+
+.. function:: espressopp.analysis.MultipleTauCorrelator.compute()
+
+                :return: (tau, correlation) for all lags that have data
+                :rtype: list of tuples
+
+.. function:: espressopp.analysis.MultipleTauCorrelator.reset()
+
+.. attribute:: espressopp.analysis.MultipleTauCorrelator.numSamples
+
+                number of samples taken so far
+"""
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.ParticleAccess import *
+from _espressopp import analysis_MultipleTauCorrelator
+
+class MultipleTauCorrelatorLocal(ParticleAccessLocal, analysis_MultipleTauCorrelator):
+
+    def __init__(self, system, integrator, quantity='msd', p=16, m=2, levels=20):
+        if pmi.workerIsActive():
+            cxxinit(self, analysis_MultipleTauCorrelator, system, integrator, quantity, p, m, levels)
+
+    def compute(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.compute(self)
+
+if pmi.isController:
+    class MultipleTauCorrelator(ParticleAccess, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+          cls =  'espressopp.analysis.MultipleTauCorrelatorLocal',
+          pmicall = [ 'sample', 'reset', 'compute' ],
+          pmiproperty = [ 'numSamples' ]
+        )
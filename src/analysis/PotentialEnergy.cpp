@@ -30,7 +30,11 @@ namespace analysis
 {
 real PotentialEnergy::compute_real() const
 {
-    if (compute_global_)
+    real energy;
+    Tensor virial;
+    if (compute_global_ && interaction_->getTally(energy, virial))
+        return energy;
+    else if (compute_global_)
         return interaction_->computeEnergy();
     else if (compute_at_)
         return interaction_->computeEnergyAA();
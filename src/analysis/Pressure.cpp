@@ -100,6 +100,13 @@ real Pressure::compute() const
     const InteractionList& srIL = system.shortRangeInteractions;
     for (size_t j = 0; j < srIL.size(); j++)
     {
+        real energy;
+        Tensor virial;
+        if (srIL[j]->getTally(energy, virial))
+        {
+            rij_dot_Fij += virial[0] + virial[1] + virial[2];
+            continue;
+        }
         rij_dot_Fij += srIL[j]->computeVirial();
         // std::cout << "srIL[" << j << "]: " << srIL[j]->computeVirial() << "\n";
     }
@@ -76,7 +76,12 @@ public:
         const InteractionList& srIL = system.shortRangeInteractions;
         for (size_t j = 0; j < srIL.size(); j++)
         {
-            srIL[j]->computeVirialTensor(wij);
+            real energy;
+            Tensor virial;
+            if (srIL[j]->getTally(energy, virial))
+                wij += virial;
+            else
+                srIL[j]->computeVirialTensor(wij);
         }
 
         return (vv + wij) / V;
@@ -23,12 +23,12 @@
 #include "python.hpp"
 #include "storage/DomainDecomposition.hpp"
 #include "iterator/CellListIterator.hpp"
-#include "Configuration.hpp"
 #include "RadialDistrF.hpp"
 #include "esutil/Error.hpp"
 #include "bc/BC.hpp"
 
-#include <boost/serialization/map.hpp>
+#include <algorithm>
+#include <cmath>
 
 #ifndef M_PIl
 #define M_PIl 3.1415926535897932384626433832795029L
@@ -42,122 +42,288 @@ namespace espressopp
 {
 namespace analysis
 {
-// TODO currently works correctly for Lx = Ly = Lz
-// rdfN is a level of discretisation of rdf (how many elements it contains)
-python::list RadialDistrF::computeArray(int rdfN) const
+namespace
 {
-    System& system = getSystemRef();
-    esutil::Error err(system.comm);
-    Real3D Li = system.bc->getBoxL();
-    Real3D Li_half = Li / 2.;
+// x, y, z, type of a particle in the buffers of the ghost layer
+const int partSize = 4;
+const int GHOST_TAG = 81;
+
+// send buffer to rank dest and receive the buffer of rank src
+void shiftBuffer(mpi::communicator& comm,
+                 int dest,
+                 int src,
+                 int tag,
+                 const vector<real>& send,
+                 vector<real>& recv)
+{
+    int nSend = send.size(), nRecv = 0;
+    mpi::request req[2];
+    req[0] = comm.irecv(src, tag, nRecv);
+    req[1] = comm.isend(dest, tag, nSend);
+    mpi::wait_all(req, req + 2);
+
+    recv.resize(nRecv);
+    req[0] = comm.irecv(src, tag, recv.data(), nRecv);
+    req[1] = comm.isend(dest, tag, send.data(), nSend);
+    mpi::wait_all(req, req + 2);
+}
+}  // namespace
 
-    int nprocs = system.comm->size();
-    int myrank = system.comm->rank();
+RadialDistrF::RadialDistrF(std::shared_ptr<System> system, int _type1, int _type2)
+    : Observable(system), type1(_type1), type2(_type2)
+{
+    if ((type1 < 0) != (type2 < 0))
+        throw std::runtime_error("RadialDistrF: set either both particle types or none");
+    setPrint_progress(true);
+}
 
-    real histogram[rdfN];
-    for (int i = 0; i < rdfN; i++) histogram[i] = 0;
+void RadialDistrF::collectGhostLayer(real range, vector<real>& parts, int& numReal) const
+{
+    System& system = getSystemRef();
+    mpi::communicator& comm = *system.comm;
+    Real3D L = system.bc->getBoxL();
 
-    real dr = Li_half[1] / (real)rdfN;  // If you work with nonuniform Lx, Ly, Lz, you
-                                        // should use for Li_half[XXX] the shortest side length
+    parts.clear();
+    CellList realCells = system.storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        const Real3D& pos = cit->position();
+        parts.insert(parts.end(), {pos[0], pos[1], pos[2], real(cit->type())});
+    }
+    numReal = parts.size() / partSize;
+
+    const storage::DomainDecomposition* dd =
+        dynamic_cast<storage::DomainDecomposition*>(system.storage.get());
 
-    int num_part = 0;
-    ConfigurationPtr config = std::make_shared<Configuration>();
-    for (int rank_i = 0; rank_i < nprocs; rank_i++)
+    // the layer is built one axis after the other, forwarding the ghosts of the
+    // previous axes, so that the edges and corners are filled as well
+    vector<real> send, recv, forward[2];
+    for (int d = 0; d < 3; d++)
     {
-        map<size_t, Real3D> conf;
-        if (rank_i == myrank)
+        int n = dd ? dd->getNodeGrid().getGridSize(d) : 1;
+
+        if (n == 1)
         {
-            CellList realCells = system.storage->getRealCells();
-            for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+            // periodic images of the own particles
+            size_t end = parts.size();
+            for (size_t i = 0; i < end; i += partSize)
             {
-                int id = cit->id();
-                conf[id] = cit->position();
+                for (real shift : {L[d], -L[d]})
+                {
+                    real x = parts[i + d] + shift;
+                    if (x >= -range && x < L[d] + range)
+                    {
+                        parts.insert(parts.end(), parts.begin() + i, parts.begin() + i + partSize);
+                        parts[parts.size() - partSize + d] = x;
+                    }
+                }
             }
+            continue;
         }
 
-        boost::mpi::broadcast(*system.comm, conf, rank_i);
+        const storage::NodeGrid& nodeGrid = dd->getNodeGrid();
+        real left = nodeGrid.getMyLeft(d);
+        real right = nodeGrid.getMyRight(d);
+        int nodePos = nodeGrid.getNodePosition(d);
+
+        // a layer wider than the neighbouring domains is passed on over several hops
+        int myHops = int(ceil(range / (right - left))), hops;
+        mpi::all_reduce(comm, myHops, hops, mpi::maximum<int>());
+        hops = min(hops, n);
 
-        // for simplicity we will number the particles from 0
-        for (map<size_t, Real3D>::iterator itr = conf.begin(); itr != conf.end(); ++itr)
+        // 0: to the right neighbour, 1: to the left neighbour
+        forward[0] = parts;
+        forward[1] = parts;
+        for (int hop = 0; hop < hops; hop++)
         {
-            // size_t id = itr->first;
-            Real3D p = itr->second;
-            config->set(num_part, p[0], p[1], p[2]);
-            num_part++;
+            for (int side = 0; side < 2; side++)
+            {
+                bool toRight = side == 0;
+                real shift = 0.0;
+                if (toRight && nodePos == n - 1) shift = -L[d];
+                if (!toRight && nodePos == 0) shift = L[d];
+
+                send.clear();
+                for (size_t i = 0; i < forward[side].size(); i += partSize)
+                {
+                    real x = forward[side][i + d];
+                    if (toRight ? x >= right - range : x < left + range)
+                    {
+                        send.insert(send.end(), forward[side].begin() + i,
+                                    forward[side].begin() + i + partSize);
+                        send[send.size() - partSize + d] += shift;
+                    }
+                }
+
+                int dest = nodeGrid.getNodeNeighborIndex(2 * d + (toRight ? 1 : 0));
+                int src = nodeGrid.getNodeNeighborIndex(2 * d + (toRight ? 0 : 1));
+                shiftBuffer(comm, dest, src, GHOST_TAG + side, send, recv);
+
+                parts.insert(parts.end(), recv.begin(), recv.end());
+                forward[side].swap(recv);
+            }
         }
     }
-    // now all CPUs have all particle coords and num_part is the total number of particles
-
-    // use all cpus
-    // TODO it could be a problem if   n_nodes > num_part
-    int numi = num_part / nprocs + 1;
-    int mini = myrank * numi;
-    int maxi = mini + numi;
+}
 
-    if (maxi > num_part) maxi = num_part;
+vector<real> RadialDistrF::computeRDF(int rdfN) const
+{
+    System& system = getSystemRef();
+    esutil::Error err(system.comm);
+    Real3D Li = system.bc->getBoxL();
 
-    int perc = 0;
-    real denom = 100.0 / (real)(maxi - mini);
-    for (int i = mini; i < maxi; i++)
+    real halfBox = 0.5 * min(min(Li[0], Li[1]), Li[2]);
+    real range = rMax > 0 ? rMax : halfBox;
+    if (rdfN <= 0 || range > halfBox)
     {
-        Real3D coordP1 = config->getCoordinates(i);
-        for (int j = i + 1; j < num_part; j++)
-        {
-            Real3D coordP2 = config->getCoordinates(j);
-            Real3D distVector = coordP1 - coordP2;
+        err.setException(
+            "RadialDistrF: rdfN must be positive and rMax at most half the shortest box side");
+    }
+    err.checkException();
 
-            // minimize the distance in simulation box
-            for (int ii = 0; ii < 3; ii++)
-            {
-                if (distVector[ii] < -Li_half[ii]) distVector[ii] += Li[ii];
-                if (distVector[ii] > Li_half[ii]) distVector[ii] -= Li[ii];
-            }
+    vector<real> parts;
+    int numReal;
+    collectGhostLayer(range, parts, numReal);
+    int numParts = parts.size() / partSize;
 
-            int bin = (int)(distVector.abs() / dr);
-            if (bin < rdfN)
+    // linked cells of at least the size range covering the real and ghost particles,
+    // not more cells than about twice the number of particles
+    Real3D lo(0.0), hi(0.0);
+    if (numParts > 0)
+    {
+        lo = hi = Real3D(parts[0], parts[1], parts[2]);
+        for (int i = 1; i < numParts; i++)
+            for (int d = 0; d < 3; d++)
             {
-                histogram[bin] += 1.0;
+                lo[d] = min(lo[d], parts[partSize * i + d]);
+                hi[d] = max(hi[d], parts[partSize * i + d]);
             }
-        }
-        /*
-         * additional calculations slow down routine but from the other hand
-         * it helps to monitor progress
-         */
-        if (print_progress && system.comm->rank() == 0)
+    }
+    Real3D extent = hi - lo;
+    real volume = max(extent[0], range) * max(extent[1], range) * max(extent[2], range);
+    real cellSize = max(range, cbrt(volume / (2 * numParts + 1)));
+    int nc[3];
+    for (int d = 0; d < 3; d++) nc[d] = max(1, int(extent[d] / cellSize));
+
+    vector<int> cellIndex(numParts), head(nc[0] * nc[1] * nc[2], -1), next(numParts);
+    for (int i = 0; i < numParts; i++)
+    {
+        int c = 0;
+        for (int d = 0; d < 3; d++)
         {
-            perc = (int)((i - mini) * denom);
-            if (perc % 5 == 0)
-            {
-                cout << "calculation progress (radial distr. func.): " << perc << " %\r" << flush;
-            }
+            int ci = int((parts[partSize * i + d] - lo[d]) / cellSize);
+            c = c * nc[d] + min(max(ci, 0), nc[d] - 1);
         }
+        cellIndex[i] = c;
+        next[i] = head[c];
+        head[c] = i;
     }
-    if (system.comm->rank() == 0)
-        cout << "calculation progress (radial distr. func.): 100 %" << endl;
 
-    real totHistogram[rdfN];
-    boost::mpi::all_reduce(*system.comm, histogram, rdfN, totHistogram, plus<real>());
+    auto matches = [this](int ti, int tj)
+    {
+        return type1 < 0 || (ti == type1 && tj == type2) || (ti == type2 && tj == type1);
+    };
+
+    // every pair of real particles is counted once, a pair with a ghost particle
+    // is seen by two ranks (or twice by one rank) and counts half
+    real dr = range / (real)rdfN;
+    real range2 = range * range;
+    vector<real> histogram(rdfN, 0.0);
+    for (int i = 0; i < numReal; i++)
+    {
+        const real* pi = &parts[partSize * i];
+        int ti = int(pi[3]);
+        if (type1 >= 0 && ti != type1 && ti != type2) continue;
+
+        int c = cellIndex[i];
+        int cz = c % nc[2], cy = (c / nc[2]) % nc[1], cx = c / (nc[1] * nc[2]);
+        for (int x = max(cx - 1, 0); x <= min(cx + 1, nc[0] - 1); x++)
+            for (int y = max(cy - 1, 0); y <= min(cy + 1, nc[1] - 1); y++)
+                for (int z = max(cz - 1, 0); z <= min(cz + 1, nc[2] - 1); z++)
+                    for (int j = head[(x * nc[1] + y) * nc[2] + z]; j >= 0; j = next[j])
+                    {
+                        if (j < numReal && j <= i) continue;
+                        const real* pj = &parts[partSize * j];
+                        if (!matches(ti, int(pj[3]))) continue;
+
+                        real dx = pi[0] - pj[0], dy = pi[1] - pj[1], dz = pi[2] - pj[2];
+                        real dist2 = dx * dx + dy * dy + dz * dz;
+                        if (dist2 >= range2) continue;
+
+                        int bin = (int)(sqrt(dist2) / dr);
+                        if (bin < rdfN) histogram[bin] += j < numReal ? 1.0 : 0.5;
+                    }
+    }
+
+    // number of particles of the two types
+    longint num[2] = {0, 0};
+    for (int i = 0; i < numReal; i++)
+    {
+        int ti = int(parts[partSize * i + 3]);
+        if (type1 < 0 || ti == type1) num[0]++;
+        if (type1 < 0 || ti == type2) num[1]++;
+    }
+
+    vector<real> totHistogram(rdfN);
+    longint totNum[2];
+    mpi::all_reduce(*system.comm, histogram.data(), rdfN, totHistogram.data(), plus<real>());
+    mpi::all_reduce(*system.comm, num, 2, totNum, plus<longint>());
+
+    if (system.comm->rank() == 0 && print_progress)
+        cout << "calculation progress (radial distr. func.): 100 %" << endl;
 
-    // normalizing
-    int nconfigs = 1;  // config - 1
-    // avg_part = part_total / float(nconfigs)
-    real rho = (real)num_part / (Li[0] * Li[1] * Li[2]);
-    real factor = 2.0 * M_PIl * dr * rho * (real)nconfigs * (real)num_part;
+    // normalizing by the number of pairs in an ideal gas
+    real volume0 = Li[0] * Li[1] * Li[2];
+    real numPairs = (real)totNum[0] * (real)totNum[1];
+    if (type1 == type2) numPairs *= 0.5;
+    if (numPairs == 0) return vector<real>(rdfN, 0.0);
 
     for (int i = 0; i < rdfN; i++)
     {
         real radius = (i + 0.5) * dr;
-        totHistogram[i] /= factor * (radius * radius + dr * dr / 12.0);
+        real shell = 4.0 * M_PIl * dr * (radius * radius + dr * dr / 12.0);
+        totHistogram[i] *= volume0 / (numPairs * shell);
     }
+    return totHistogram;
+}
+
+// rdfN is a level of discretisation of rdf (how many elements it contains)
+python::list RadialDistrF::computeArray(int rdfN) const
+{
+    vector<real> rdf = computeRDF(rdfN);
 
     python::list pyli;
-    for (int i = 0; i < rdfN; i++)
+    for (real g : rdf) pyli.append(g);
+    return pyli;
+}
+
+void RadialDistrF::accumulate(int rdfN)
+{
+    vector<real> rdf = computeRDF(rdfN);
+
+    // a different number of bins starts a new average
+    if (int(sum.size()) != rdfN)
     {
-        pyli.append(totHistogram[i]);
+        sum.assign(rdfN, 0.0);
+        numFrames = 0;
     }
+    for (int i = 0; i < rdfN; i++) sum[i] += rdf[i];
+    numFrames++;
+}
+
+python::list RadialDistrF::getAverage() const
+{
+    python::list pyli;
+    for (real g : sum) pyli.append(numFrames ? g / numFrames : 0.0);
     return pyli;
 }
 
+void RadialDistrF::reset()
+{
+    sum.clear();
+    numFrames = 0;
+}
+
 // TODO: this dummy routine is still needed as we have not yet ObservableVector
 real RadialDistrF::compute() const { return -1.0; }
 
@@ -166,9 +332,15 @@ void RadialDistrF::registerPython()
     using namespace espressopp::python;
     class_<RadialDistrF, bases<Observable> >("analysis_RadialDistrF",
                                              init<std::shared_ptr<System> >())
+        .def(init<std::shared_ptr<System>, int, int>())
         .add_property("print_progress", &RadialDistrF::getPrint_progress,
                       &RadialDistrF::setPrint_progress)
-        .def("compute", &RadialDistrF::computeArray);
+        .add_property("rMax", &RadialDistrF::getRMax, &RadialDistrF::setRMax)
+        .add_property("numFrames", &RadialDistrF::getNumFrames)
+        .def("compute", &RadialDistrF::computeArray)
+        .def("accumulate", &RadialDistrF::accumulate)
+        .def("getAverage", &RadialDistrF::getAverage)
+        .def("reset", &RadialDistrF::reset);
 }
 }  // namespace analysis
 }  // namespace espressopp
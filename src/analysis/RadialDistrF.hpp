@@ -33,7 +33,14 @@ namespace espressopp
 {
 namespace analysis
 {
-/** Class to compute the radial distribution function of the system. */
+/** Class to compute the radial distribution function of the system.
+
+    Every rank bins the pairs of its real particles with the real particles and a
+    ghost layer of width rMax around its domain, using a linked cell list of cell
+    size rMax. The cost per rank is linear in its number of particles and only the
+    ghost layer is communicated. With type1 and type2 the partial RDF of these two
+    particle types is computed. accumulate() sums the RDF of many frames.
+*/
 class RadialDistrF : public Observable
 {
 public:
@@ -42,17 +49,39 @@ public:
         // by default
         setPrint_progress(true);
     }
+    RadialDistrF(std::shared_ptr<System> system, int _type1, int _type2);
     ~RadialDistrF() {}
     virtual real compute() const;
     virtual python::list computeArray(int) const;
 
+    /** Add the RDF of the current configuration to the running sum. */
+    void accumulate(int rdfN);
+    /** RDF averaged over all accumulated frames. */
+    python::list getAverage() const;
+    void reset();
+    int getNumFrames() const { return numFrames; }
+
     void setPrint_progress(bool _print_progress) { print_progress = _print_progress; }
     bool getPrint_progress() { return print_progress; }
 
+    /// largest distance of the histogram, 0 means half the shortest box side
+    void setRMax(real _rMax) { rMax = _rMax; }
+    real getRMax() const { return rMax; }
+
     static void registerPython();
 
 private:
+    /// normalized RDF of the current configuration, the same on all ranks
+    std::vector<real> computeRDF(int rdfN) const;
+    /// positions and types of the real particles followed by the ghost layer
+    void collectGhostLayer(real range, std::vector<real>& parts, int& numReal) const;
+
     bool print_progress;
+    int type1 = -1, type2 = -1;  // -1: all particles
+    real rMax = 0.0;
+
+    std::vector<real> sum;  // accumulated RDF
+    int numFrames = 0;
 };
 }  // namespace analysis
 }  // namespace espressopp
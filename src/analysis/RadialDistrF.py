@@ -25,16 +25,61 @@ espressopp.analysis.RadialDistrF
 ********************************
 
 
-.. function:: espressopp.analysis.RadialDistrF(system)
+Radial distribution function g(r) up to rMax. Every CPU bins the pairs of its
+own particles with a ghost layer of width rMax that is exchanged with the
+neighbouring domains, so the cost is linear in the number of particles.
+
+If type1 and type2 are given, the partial RDF of these two particle types is
+computed. accumulate() adds the RDF of the current configuration to a running
+average, which is returned by getAverage().
+
+Example:
+
+>>> rdf = espressopp.analysis.RadialDistrF(system, type1=0, type2=1)
+>>> for i in range(100):
+>>>     integrator.run(100)
+>>>     rdf.accumulate(200)
+>>> g = rdf.getAverage()
+
+.. function:: espressopp.analysis.RadialDistrF(system, type1, type2)
 
                 :param system:
-                :type system:
+                :param type1: (default: -1, all particles)
+                :param type2: (default: -1, all particles)
+                :type system: std::shared_ptr<System>
+                :type type1: int
+                :type type2: int
 
 .. function:: espressopp.analysis.RadialDistrF.compute(rdfN)
 
-                :param rdfN:
-                :type rdfN:
-                :rtype:
+                RDF of the current configuration.
+
+                :param rdfN: number of bins
+                :type rdfN: int
+                :rtype: list of floats
+
+.. function:: espressopp.analysis.RadialDistrF.accumulate(rdfN)
+
+                Add the RDF of the current configuration to the average.
+                A different number of bins restarts the average.
+
+                :param rdfN: number of bins
+                :type rdfN: int
+
+.. function:: espressopp.analysis.RadialDistrF.getAverage()
+
+                :rtype: list of floats
+
+.. function:: espressopp.analysis.RadialDistrF.reset()
+
+.. attribute:: espressopp.analysis.RadialDistrF.rMax
+
+                largest distance of the histogram, the default 0 means half the
+                shortest box side (the largest possible value)
+
+.. attribute:: espressopp.analysis.RadialDistrF.numFrames
+
+                number of accumulated configurations
 """
 from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -44,17 +89,26 @@ from _espressopp import analysis_RadialDistrF
 
 class RadialDistrFLocal(ObservableLocal, analysis_RadialDistrF):
 
-    def __init__(self, system):
+    def __init__(self, system, type1=-1, type2=-1):
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
-            cxxinit(self, analysis_RadialDistrF, system)
+            cxxinit(self, analysis_RadialDistrF, system, type1, type2)
 
     def compute(self, rdfN):
         return self.cxxclass.compute(self, rdfN)
 
+    def accumulate(self, rdfN):
+        self.cxxclass.accumulate(self, rdfN)
+
+    def getAverage(self):
+        return self.cxxclass.getAverage(self)
+
+    def reset(self):
+        self.cxxclass.reset(self)
+
 if pmi.isController :
     class RadialDistrF(Observable, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
-          pmiproperty = [ 'print_progress' ],
-          pmicall = [ "compute" ],
+          pmiproperty = [ 'print_progress', 'rMax', 'numFrames' ],
+          pmicall = [ "compute", "accumulate", "getAverage", "reset" ],
           cls = 'espressopp.analysis.RadialDistrFLocal'
         )
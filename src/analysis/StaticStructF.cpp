@@ -17,23 +17,21 @@
   GNU General Public License for more details.
 
   You should have received a copy of the GNU General Public License
-  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "python.hpp"
 #include "storage/DomainDecomposition.hpp"
 #include "iterator/CellListIterator.hpp"
-#include "Configuration.hpp"
 #include "StaticStructF.hpp"
 #include "esutil/Error.hpp"
+#include "esutil/ParallelFFT.hpp"
 #include "bc/BC.hpp"
 
-#include <boost/serialization/map.hpp>
+#include <boost/serialization/vector.hpp>
 
-#include <math.h>      // cos and ceil and sqrt
-#include <algorithm>   // std::min
+#include <math.h>      // cos, sin, floor and sqrt
+#include <algorithm>   // std::min, std::sort
 #include <functional>  // std::plus
-#include <time.h>      // time_t, for particle-distribution-to-cpu time
 
 #ifndef M_PIl
 #define M_PIl 3.1415926535897932384626433832795029L
@@ -47,7 +45,7 @@ namespace espressopp
 {
 namespace analysis
 {
-// currently only works for particles numbered like 0, 1, 2,...
+using esutil::dcomplex;
 
 // nqx is a number which corresponds to the different x-values of the
 // diffraction vector q. greater nqx produces more different x-values
@@ -60,169 +58,136 @@ namespace analysis
 // dqx, dqy, dqz are the cell length of the grid of possible q-vectors
 // dqx = 2*PI/Lx, dqy = 2*PI/Ly, dqz = 2*PI/Lz
 
-python::list StaticStructF::computeArray(int nqx, int nqy, int nqz, real bin_factor) const
+namespace
 {
-    time_t start;
-    time(&start);
-    cout << "collective calc starts " << ctime(&start) << "\n";
-    // fist the system coords are saved at each CPU
-    System& system = getSystemRef();
-    esutil::Error err(system.comm);
-    Real3D Li = system.bc->getBoxL();  // Box size (Lx, Ly, Lz)
+// the q-vectors (hx*dqx, hy*dqy, hz*dqz) with |hx| <= nqx, |hy| <= nqy and
+// 0 <= hz <= nqz. hz starts from zero because q and -q give the same S(q)
+struct QGrid
+{
+    Real3D dq;
+    Int3D nq;
+
+    QGrid(const Real3D& L, int nqx, int nqy, int nqz) : nq(nqx, nqy, nqz)
+    {
+        for (int i = 0; i < 3; i++) dq[i] = 2. * M_PIl / L[i];
+    }
 
-    int nprocs = system.comm->size();  // number of CPUs
-    int myrank = system.comm->rank();  // current CPU's number
+    size_t size() const { return size_t(2 * nq[0] + 1) * (2 * nq[1] + 1) * (nq[2] + 1); }
 
-    if (myrank == 0)
+    size_t index(const Int3D& h) const
     {
-        cout << "collective calc starts " << ctime(&start) << "\n";
+        return (size_t(h[0] + nq[0]) * (2 * nq[1] + 1) + (h[1] + nq[1])) * (nq[2] + 1) + h[2];
     }
+};
 
-    int num_part = 0;
-    ConfigurationPtr config = std::make_shared<Configuration>();
-    // loop over all CPU-numbers - to give all CPUs all particle coords
-    for (int rank_i = 0; rank_i < nprocs; rank_i++)
+// exp(i q r) of one particle for all q-vectors of a grid
+class Exponents
+{
+public:
+    explicit Exponents(const QGrid& _grid)
+        : grid(_grid), ex(grid.nq[0] + 1), ey(2 * grid.nq[1] + 1), ez(grid.nq[2] + 1)
+    {
+    }
+
+    // rho[k] += exp(i q_k r) in the order of QGrid::index
+    void add(const Real3D& r, dcomplex* rho)
     {
-        map<size_t, Real3D> conf;
-        if (rank_i == myrank)
+        const Int3D& nq = grid.nq;
+
+        // one cos and sin per axis, the other factors are powers of these
+        powers(grid.dq[0] * r[0], ex.data(), nq[0]);
+        powers(grid.dq[1] * r[1], &ey[nq[1]], nq[1]);
+        for (int h = 1; h <= nq[1]; h++) ey[nq[1] - h] = conj(ey[nq[1] + h]);
+        powers(grid.dq[2] * r[2], ez.data(), nq[2]);
+
+        for (int hx = -nq[0]; hx <= nq[0]; hx++)
         {
-            CellList realCells = system.storage->getRealCells();
-            for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+            dcomplex fx = hx >= 0 ? ex[hx] : conj(ex[-hx]);
+            for (int hy = 0; hy <= 2 * nq[1]; hy++)
             {
-                int id = cit->id();
-                conf[id] = cit->position();
+                dcomplex fxy = fx * ey[hy];
+                for (int hz = 0; hz <= nq[2]; hz++) *rho++ += fxy * ez[hz];
             }
         }
-        boost::mpi::broadcast(*system.comm, conf, rank_i);
-
-        // for simplicity we will number the particles from 0
-        for (map<size_t, Real3D>::iterator itr = conf.begin(); itr != conf.end(); ++itr)
-        {
-            size_t id = itr->first;
-            Real3D p = itr->second;
-            config->set(id, p[0], p[1], p[2]);
-            // config->set(num_part, p[0], p[1], p[2]);
-            num_part++;
-        }
     }
-    if (myrank == 0)
-    {
-        time_t distributed;
-        time(&distributed);
-        cout << "particles on all CPUs " << ctime(&distributed) << "\n";
-        cout << "distribution to CPUs took " << difftime(distributed, start) << " seconds \n";
-    }
-    // now all CPUs have all particle coords and num_part is the total number
-    // of particles
-
-    // use all CPUs
-    // TODO it could be a problem if   n_nodes > num_part
-
-    // here starts calculation of the static structure factor
-
-    // step size for qx, qy, qz
-    real dqs[3];
-    dqs[0] = 2. * M_PIl / Li[0];
-    dqs[1] = 2. * M_PIl / Li[1];
-    dqs[2] = 2. * M_PIl / Li[2];
-
-    Real3D q;
-
-    // calculations for binning
-    real bin_size = bin_factor * std::min(dqs[0], std::min(dqs[1], dqs[2]));
-    real q_sqr_max =
-        nqx * nqx * dqs[0] * dqs[0] + nqy * nqy * dqs[1] * dqs[1] + nqz * nqz * dqs[2] * dqs[2];
-    real q_max = sqrt(q_sqr_max);
-    int num_bins = (int)ceil(q_max / bin_size);
-    vector<real> sq_bin;
-    vector<real> q_bin;
-    vector<int> count_bin;
-    sq_bin.resize(num_bins);
-    q_bin.resize(num_bins);
-    count_bin.resize(num_bins);
-
-    if (myrank == 0)
+
+private:
+    // e[h] = exp(i h phi) for 0 <= h <= n
+    static void powers(real phi, dcomplex* e, int n)
     {
-        cout << nprocs << " CPUs\n\n"
-             << "bin size \t" << bin_size << "\n"
-             << "q_max    \t" << q_max << "\n";
+        e[0] = dcomplex(1.0, 0.0);
+        if (n > 0) e[1] = dcomplex(cos(phi), sin(phi));
+        for (int h = 2; h <= n; h++) e[h] = e[h - 1] * e[1];
     }
 
-    real n_reci = 1. / num_part;
-    real scos_local = 0;                             // will store cos-sum on each CPU
-    real ssin_local = 0;                             // will store sin-sum on each CPU
-    int ppp = (int)ceil((double)num_part / nprocs);  // particles per proc
+    const QGrid& grid;
+    vector<dcomplex> ex, ey, ez;
+};
 
-    Real3D coordP;
-
-    python::list pyli;
-
-    // loop over different q values
-    // starting from zero because combinations with negative components
-    // will give the same result in S(q). so S(q) is the same for
-    // the 8 vectors q=(x,y,z),(-x,y,z), (x,-y,z),(x,y,-z),(-x,-y,z),...
-    for (int hx = -nqx; hx <= nqx; hx++)
+// averages sq (one value per q-vector) in bins of |q| and multiplies it by norm,
+// the bin of q = 0 is left out
+python::list binning(const QGrid& grid, const vector<real>& sq, real bin_factor, real norm)
+{
+    const Real3D& dq = grid.dq;
+    const Int3D& nq = grid.nq;
+
+    real bin_size = bin_factor * std::min(dq[0], std::min(dq[1], dq[2]));
+    real q_max = Real3D(nq[0] * dq[0], nq[1] * dq[1], nq[2] * dq[2]).abs();
+    int num_bins = (int)floor(q_max / bin_size) + 1;
+    vector<real> sq_bin(num_bins, 0.0);
+    vector<real> q_bin(num_bins, 0.0);
+    vector<int> count_bin(num_bins, 0);
+
+    Int3D h;
+    for (h[0] = -nq[0]; h[0] <= nq[0]; h[0]++)
     {
-        for (int hy = -nqy; hy <= nqy; hy++)
+        for (h[1] = -nq[1]; h[1] <= nq[1]; h[1]++)
         {
-            for (int hz = 0; hz <= nqz; hz++)
+            for (h[2] = 0; h[2] <= nq[2]; h[2]++)
             {
-                // values of q-vector
-                q[0] = hx * dqs[0];
-                q[1] = hy * dqs[1];
-                q[2] = hz * dqs[2];
-                real q_abs = q.abs();
-
-                // determining the bin number
+                real q_abs = Real3D(h[0] * dq[0], h[1] * dq[1], h[2] * dq[2]).abs();
                 int bin_i = (int)floor(q_abs / bin_size);
                 q_bin[bin_i] += q_abs;
                 count_bin[bin_i] += 1;
-
-                // resetting the variables that store the local sum on each proc
-                scos_local = 0;
-                ssin_local = 0;
-
-                // loop over particles
-                for (int k = myrank * ppp; k < (1 + myrank) * ppp && k < num_part; k++)
-                {
-                    coordP = config->getCoordinates(k);
-                    scos_local += cos(q * coordP);
-                    ssin_local += sin(q * coordP);
-                }
-                if (myrank != 0)
-                {
-                    boost::mpi::reduce(*system.comm, scos_local, plus<real>(), 0);
-                    boost::mpi::reduce(*system.comm, ssin_local, plus<real>(), 0);
-                }
-
-                if (myrank == 0)
-                {
-                    real scos = 0;
-                    real ssin = 0;
-                    boost::mpi::reduce(*system.comm, scos_local, scos, plus<real>(), 0);
-                    boost::mpi::reduce(*system.comm, ssin_local, ssin, plus<real>(), 0);
-                    sq_bin[bin_i] += scos * scos + ssin * ssin;
-                }
+                sq_bin[bin_i] += sq[grid.index(h)];
             }
         }
     }
-    // creates the python list with the results
-    if (myrank == 0)
-    {
-        // starting with bin_i = 1 will leave out the value for q=0, otherwise start with bin_i=0
-        for (int bin_i = 1; bin_i < num_bins; bin_i++)
-        {
-            real c = (count_bin[bin_i]) ? 1 / (real)count_bin[bin_i] : 0;
-            sq_bin[bin_i] = n_reci * sq_bin[bin_i] * c;
-            q_bin[bin_i] = q_bin[bin_i] * c;
 
-            python::tuple q_Sq_pair;
-            q_Sq_pair = python::make_tuple(q_bin[bin_i], sq_bin[bin_i]);
-            pyli.append(q_Sq_pair);
-        }
+    python::list pyli;
+    for (int bin_i = 1; bin_i < num_bins; bin_i++)
+    {
+        real c = (count_bin[bin_i]) ? 1 / (real)count_bin[bin_i] : 0;
+        pyli.append(python::make_tuple(q_bin[bin_i] * c, norm * sq_bin[bin_i] * c));
     }
     return pyli;
 }
+}  // namespace
+
+python::list StaticStructF::computeArray(int nqx, int nqy, int nqz, real bin_factor) const
+{
+    System& system = getSystemRef();
+    QGrid grid(system.bc->getBoxL(), nqx, nqy, nqz);
+    size_t numQ = grid.size();
+
+    // the densities of all q-vectors and, as last element, the number of particles
+    vector<dcomplex> rho(numQ + 1, 0.0);
+    Exponents exponents(grid);
+    CellList realCells = system.storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        exponents.add(cit->position(), rho.data());
+        rho[numQ] += 1.0;
+    }
+
+    vector<dcomplex> totRho(numQ + 1);
+    boost::mpi::all_reduce(*system.comm, reinterpret_cast<real*>(rho.data()), 2 * (numQ + 1),
+                           reinterpret_cast<real*>(totRho.data()), plus<real>());
+
+    vector<real> sq(numQ);
+    for (size_t k = 0; k < numQ; k++) sq[k] = norm(totRho[k]);
+    return binning(grid, sq, bin_factor, 1. / totRho[numQ].real());
+}
 
 // this routine is for ordered configurations, e.g. particle 0 to 9
 // belong to chain 1, particle 10 to 19 to chain 2 etc.
@@ -230,175 +195,207 @@ python::list StaticStructF::computeArray(int nqx, int nqy, int nqz, real bin_fac
 python::list StaticStructF::computeArraySingleChain(
     int nqx, int nqy, int nqz, real bin_factor, int chainlength) const
 {
-    // fist the system coords are saved at each CPU
     System& system = getSystemRef();
-    esutil::Error err(system.comm);
-    Real3D Li = system.bc->getBoxL();  // Box size (Lx, Ly, Lz)
-
-    int nprocs = system.comm->size();  // number of CPUs
-    int myrank = system.comm->rank();  // current CPU's number
+    QGrid grid(system.bc->getBoxL(), nqx, nqy, nqz);
+    size_t numQ = grid.size();
+    int nprocs = system.comm->size();
+
+    // the particles of chain cid are collected on CPU cid % nprocs as (id, x, y, z)
+    vector<vector<real> > sendBuf(nprocs), recvBuf;
+    CellList realCells = system.storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        vector<real>& buf = sendBuf[(cit->id() / chainlength) % nprocs];
+        buf.push_back(cit->id());
+        buf.insert(buf.end(), cit->position().get(), cit->position().get() + 3);
+    }
+    boost::mpi::all_to_all(*system.comm, sendBuf, recvBuf);
 
-    int num_part = 0;
-    ConfigurationPtr config = std::make_shared<Configuration>();
-    // loop over all CPU-numbers - to give all CPUs all particle coords
-    for (int rank_i = 0; rank_i < nprocs; rank_i++)
+    vector<pair<longint, Real3D> > particles;
+    for (const vector<real>& buf : recvBuf)
     {
-        map<size_t, Real3D> conf;
-        if (rank_i == myrank)
+        for (size_t i = 0; i < buf.size(); i += 4)
         {
-            CellList realCells = system.storage->getRealCells();
-            for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
-            {
-                int id = cit->id();
-                conf[id] = cit->position();
-            }
+            Real3D pos(buf[i + 1], buf[i + 2], buf[i + 3]);
+            particles.push_back(make_pair(longint(buf[i]), pos));
         }
-        boost::mpi::broadcast(*system.comm, conf, rank_i);
-
-        // for simplicity we will number the particles from 0
-        for (map<size_t, Real3D>::iterator itr = conf.begin(); itr != conf.end(); ++itr)
+    }
+    sort(particles.begin(), particles.end(),
+         [](const pair<longint, Real3D>& a, const pair<longint, Real3D>& b)
+         { return a.first < b.first; });
+
+    // sum over the local chains of |rho_chain(q)|^2 and, as last element, the
+    // number of particles
+    vector<real> sq(numQ + 1, 0.0);
+    vector<dcomplex> rho(numQ);
+    Exponents exponents(grid);
+    for (size_t i = 0; i < particles.size();)
+    {
+        longint cid = particles[i].first / chainlength;
+        fill(rho.begin(), rho.end(), 0.0);
+        for (; i < particles.size() && particles[i].first / chainlength == cid; i++)
         {
-            size_t id = itr->first;
-            Real3D p = itr->second;
-            config->set(id, p[0], p[1], p[2]);
-            // config->set(num_part, p[0], p[1], p[2]);
-            num_part++;
+            exponents.add(particles[i].second, rho.data());
         }
+        for (size_t k = 0; k < numQ; k++) sq[k] += norm(rho[k]);
     }
-    cout << "particles are given to each CPU!\n";
-    // now all CPUs have all particle coords and num_part is the total number
-    // of particles
-
-    // use all CPUs
-    // TODO it could be a problem if   n_nodes > num_part
-
-    // here starts calculation of the static structure factor
-
-    // step size for qx, qy, qz
-    real dqs[3];
-    dqs[0] = 2. * M_PIl / Li[0];
-    dqs[1] = 2. * M_PIl / Li[1];
-    dqs[2] = 2. * M_PIl / Li[2];
-
-    Real3D q;
-
-    // calculations for binning
-    real bin_size = bin_factor * std::min(dqs[0], std::min(dqs[1], dqs[2]));
-    real q_sqr_max =
-        nqx * nqx * dqs[0] * dqs[0] + nqy * nqy * dqs[1] * dqs[1] + nqz * nqz * dqs[2] * dqs[2];
-    real q_max = sqrt(q_sqr_max);
-    int num_bins = (int)ceil(q_max / bin_size);
-    vector<real> sq_bin;
-    vector<real> q_bin;
-    vector<int> count_bin;
-    sq_bin.resize(num_bins);
-    q_bin.resize(num_bins);
-    count_bin.resize(num_bins);
-
-    if (myrank == 0)
+    sq[numQ] = particles.size();
+
+    vector<real> totSq(numQ + 1);
+    boost::mpi::all_reduce(*system.comm, sq.data(), numQ + 1, totSq.data(), plus<real>());
+
+    longint num_part = longint(totSq[numQ]);
+    if (num_part % chainlength != 0)
     {
-        cout << nprocs << " CPUs\n\n"
-             << "bin size \t" << bin_size << "\n"
-             << "q_max    \t" << q_max << "\n";
+        if (system.comm->rank() == 0)
+        {
+            cout << "ERROR: chainlenght does not match total number of "
+                 << "particles. num_part % chainlenght is unequal 0. \n"
+                 << "Calculation of SingleChain_StaticStructF aborted\n";
+        }
+        return python::list();
     }
+    return binning(grid, totSq, bin_factor, 1. / ((real)num_part * chainlength));
+}
 
-    real n_reci = 1. / num_part;
-    real chainlength_reci = 1. / chainlength;
-    real scos_local = 0;  // will store cos-sum on each CPU
-    real ssin_local = 0;  // will store sin-sum on each CPU
-    // will store the summation of the the single chain structure factor
-    real singleChain_localSum = 0;
-    Real3D coordP;
-    python::list pyli;
+python::list StaticStructF::computeArrayMesh(
+    int nqx, int nqy, int nqz, real bin_factor, int oversampling) const
+{
+    System& system = getSystemRef();
+    const mpi::communicator& comm = *system.comm;
+    Real3D L = system.bc->getBoxL();
+    QGrid grid(L, nqx, nqy, nqz);
 
-    // calculations for parallelizing (over chains)
-    int num_chains;
-    if (num_part % chainlength == 0)
-        num_chains = num_part / chainlength;
-    else
+    if (oversampling < 1)
     {
-        cout << "ERROR: chainlenght does not match total number of "
-             << "particles. num_part % chainlenght is unequal 0. \n"
-             << "Calculation of SingleChain_StaticStructF aborted\n";
-        return pyli;
+        esutil::Error err(system.comm);
+        err.setException("StaticStructF: oversampling of the mesh must be at least 1");
+        err.checkException();
     }
-    int cpp = (int)ceil((double)num_chains / nprocs);  // chains per proc
-    cout << "chains per proc\t" << cpp << "\n";
-
-    // loop over different q values
-    // starting from zero because combinations with negative components
-    // will give the same result in S(q). so S(q) is the same for
-    // the 8 vectors q=(x,y,z),(-x,y,z), (x,-y,z),(x,y,-z),(-x,-y,z),...
-    for (int hx = -nqx; hx <= nqx; hx++)
+
+    // the mesh points inside its domain belong to a CPU, like in P3M
+    Int3D M, lo(0), hi;
+    storage::DomainDecomposition* dd =
+        dynamic_cast<storage::DomainDecomposition*>(system.storage.get());
+    if (!dd && comm.size() > 1)
     {
-        for (int hy = -nqy; hy <= nqy; hy++)
-        {
-            for (int hz = 0; hz <= nqz; hz++)
-            {
-                // values of q-vector
-                q[0] = hx * dqs[0];
-                q[1] = hy * dqs[1];
-                q[2] = hz * dqs[2];
-                real q_abs = q.abs();
+        esutil::Error err(system.comm);
+        err.setException("StaticStructF: the mesh on several CPUs needs a DomainDecomposition");
+        err.checkException();
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        M[i] = oversampling * (2 * grid.nq[i] + 1);
+        hi[i] = M[i];
+        if (!dd) continue;
+
+        // at least one mesh point per cell, so that every CPU gets some
+        long long G = dd->getGlobalCellGridSize(i);
+        longint pos = dd->getNodeGrid().getNodePosition(i);
+        M[i] = std::max(M[i], int(G));
+        lo[i] = int(M[i] * dd->getCellBorder(i, pos) / G);
+        hi[i] = int(M[i] * dd->getCellBorder(i, pos + 1) / G);
+    }
+    esutil::MeshBox localBox(lo, hi);
 
-                // determining the bin number
-                int bin_i = (int)floor(q_abs / bin_size);
-                q_bin[bin_i] += q_abs;
-                count_bin[bin_i] += 1;
+    // a particle reaches the next mesh point and may be up to the skin outside of
+    // its domain
+    Int3D halo;
+    for (int i = 0; i < 3; i++) halo[i] = int(ceil(system.getSkin() * M[i] / L[i])) + 2;
+    esutil::MeshBox extBox(lo - halo, hi + halo);
 
-                // resetting the variable that stores the sum for each q-vector
-                singleChain_localSum = 0;
+    esutil::MeshRemap haloToOwner(comm, extBox, localBox, M, true);
+    esutil::ParallelFFT fft(comm, M, localBox, true);
+    const esutil::MeshBox& kBox = fft.getOutBox();
 
-                // loop over chains (cid is chain_id)
-                for (int cid = myrank * cpp; cid < (1 + myrank) * cpp && cid < num_chains; cid++)
-                {
-                    scos_local = 0;  // resetting the cos sum for the each chain
-                    ssin_local = 0;  // resetting the sin sum for the each chain
-                    // loop over particles
-                    for (int k = cid * chainlength; k < (1 + cid) * chainlength && k < num_part;
-                         k++)
+    // signed frequency of the mesh point k
+    auto frequency = [&M](const Int3D& k)
+    {
+        Int3D h;
+        for (int i = 0; i < 3; i++) h[i] = k[i] <= M[i] / 2 ? k[i] : k[i] - M[i];
+        return h;
+    };
+
+    // cloud in cell assignment. The mesh is transformed a second time with the
+    // particles shifted by half a mesh spacing, the average of both spectra cancels
+    // the leading aliasing contributions (interlacing)
+    vector<dcomplex> rhoK(kBox.size(), 0.0);
+    vector<real> rhoExt(extBox.size());
+    real num_part = 0;
+    CellList realCells = system.storage->getRealCells();
+    for (int pass = 0; pass < 2; pass++)
+    {
+        real shift = 0.5 * pass;
+        fill(rhoExt.begin(), rhoExt.end(), 0.0);
+        for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+        {
+            const Real3D& pos = cit->position();
+            Int3D g;
+            real w[3][2];
+            for (int i = 0; i < 3; i++)
+            {
+                real u = pos[i] * M[i] / L[i] - shift;
+                g[i] = int(floor(u));
+                w[i][1] = u - g[i];
+                w[i][0] = 1.0 - w[i][1];
+            }
+            for (int a = 0; a < 2; a++)
+                for (int b = 0; b < 2; b++)
+                    for (int c = 0; c < 2; c++)
                     {
-                        coordP = config->getCoordinates(k);
-                        scos_local += cos(q * coordP);
-                        ssin_local += sin(q * coordP);
+                        rhoExt[extBox.index(g + Int3D(a, b, c))] += w[0][a] * w[1][b] * w[2][c];
                     }
-                    // the (summation part of the) single chain structure
-                    // factors are summed up for the averaging at the
-                    // end (over the chains)
-                    singleChain_localSum += scos_local * scos_local + ssin_local * ssin_local;
-                }
+            if (pass == 0) num_part += 1;
+        }
+
+        real* in = fft.getRealData();
+        fill(in, in + localBox.size(), 0.0);
+        haloToOwner.execute(rhoExt.data(), in, true);
+        fft.forward();
 
-                if (myrank != 0)
+        const dcomplex* out = fft.getData();
+        Int3D k;
+        for (k[0] = kBox.lo[0]; k[0] < kBox.hi[0]; k[0]++)
+            for (k[1] = kBox.lo[1]; k[1] < kBox.hi[1]; k[1]++)
+                for (k[2] = kBox.lo[2]; k[2] < kBox.hi[2]; k[2]++)
                 {
-                    boost::mpi::reduce(*system.comm, singleChain_localSum, plus<real>(), 0);
+                    Int3D h = frequency(k);
+                    real phi = 0.0;
+                    for (int i = 0; i < 3; i++) phi -= 2. * M_PIl * h[i] * shift / M[i];
+                    size_t idx = kBox.index(k);
+                    rhoK[idx] += 0.5 * dcomplex(cos(phi), sin(phi)) * out[idx];
                 }
+    }
 
-                if (myrank == 0)
+    // |rho(q)|^2 of the local q-vectors divided by the square of the assignment
+    // function, sinc^2 per axis; as last element the number of particles
+    vector<real> sq(grid.size() + 1, 0.0);
+    Int3D k;
+    for (k[0] = kBox.lo[0]; k[0] < kBox.hi[0]; k[0]++)
+    {
+        for (k[1] = kBox.lo[1]; k[1] < kBox.hi[1]; k[1]++)
+        {
+            for (k[2] = kBox.lo[2]; k[2] < kBox.hi[2]; k[2]++)
+            {
+                Int3D h = frequency(k);
+                bool inside = true;
+                real W = 1.0;
+                for (int i = 0; i < 3; i++)
                 {
-                    real singleChainSum = 0;
-                    boost::mpi::reduce(*system.comm, singleChain_localSum, singleChainSum,
-                                       plus<real>(), 0);
-                    sq_bin[bin_i] += singleChainSum;
+                    inside = inside && abs(h[i]) <= grid.nq[i];
+                    if (h[i] == 0) continue;
+                    real x = M_PIl * h[i] / M[i];
+                    W *= (sin(x) / x) * (sin(x) / x);
                 }
+                if (inside) sq[grid.index(h)] = norm(rhoK[kBox.index(k)]) / (W * W);
             }
         }
     }
-    // creates the python list with the results
-    if (myrank == 0)
-    {
-        // starting with bin_i = 1 will leave out the value for q=0, otherwise start with bin_i=0
-        for (int bin_i = 1; bin_i < num_bins; bin_i++)
-        {
-            real c = (count_bin[bin_i]) ? 1 / (real)count_bin[bin_i] : 0;
-            sq_bin[bin_i] = n_reci * chainlength_reci * sq_bin[bin_i] * c;
-            q_bin[bin_i] = q_bin[bin_i] * c;
+    sq[grid.size()] = num_part;
 
-            python::tuple q_Sq_pair;
-            q_Sq_pair = python::make_tuple(q_bin[bin_i], sq_bin[bin_i]);
-            pyli.append(q_Sq_pair);
-        }
-    }
-    return pyli;
+    vector<real> totSq(sq.size());
+    boost::mpi::all_reduce(comm, sq.data(), sq.size(), totSq.data(), plus<real>());
+    return binning(grid, totSq, bin_factor, 1. / totSq.back());
 }
 
 // TODO: this dummy routine is still needed as we have not yet ObservableVector
@@ -413,7 +410,8 @@ void StaticStructF::registerPython()
     class_<StaticStructF, bases<Observable> >("analysis_StaticStructF",
                                               init<std::shared_ptr<System> >())
         .def("compute", &StaticStructF::computeArray)
-        .def("computeSingleChain", &StaticStructF::computeArraySingleChain);
+        .def("computeSingleChain", &StaticStructF::computeArraySingleChain)
+        .def("computeMesh", &StaticStructF::computeArrayMesh);
 }
 }  // namespace analysis
 }  // namespace espressopp
@@ -32,7 +32,20 @@ namespace espressopp
 {
 namespace analysis
 {
-/** Class to compute the static structure function of the system. */
+/** Class to compute the static structure function of the system.
+
+    S(q) is computed for the q-vectors (hx, hy, hz) * 2 pi / L with |hx| <= nqx,
+    |hy| <= nqy and 0 <= hz <= nqz and averaged in bins of |q|. The particles stay on
+    their CPU: the factors exp(i q r) of a particle are built per axis by the power
+    recurrence exp(i h q_1 x) = exp(i (h - 1) q_1 x) exp(i q_1 x), the densities of all
+    q-vectors are accumulated into one array and summed over the CPUs in a single
+    all-reduce.
+
+    For large sets of q-vectors, computeArrayMesh() assigns the particles to a mesh
+    (cloud in cell, interlaced) and gets all densities from distributed FFTs. The
+    assignment function is divided out, the remaining aliasing error decreases with
+    the oversampling of the mesh.
+*/
 class StaticStructF : public Observable
 {
 public:
@@ -43,6 +56,9 @@ public:
     virtual python::list computeArray(int nqx, int nqy, int nqz, real bin_factor) const;
     virtual python::list computeArraySingleChain(
         int nqx, int nqy, int nqz, real bin_factor, int chainlength) const;
+    /** S(q) from a mesh of oversampling * (2 nq + 1) points per axis */
+    virtual python::list computeArrayMesh(
+        int nqx, int nqy, int nqz, real bin_factor, int oversampling) const;
     static void registerPython();
 };
 }  // namespace analysis
@@ -30,18 +30,23 @@ espressopp.analysis.StaticStructF
                 :param system:
                 :type system:
 
-.. function:: espressopp.analysis.StaticStructF.compute(nqx, nqy, nqz, bin_factor, ofile)
+.. function:: espressopp.analysis.StaticStructF.compute(nqx, nqy, nqz, bin_factor, ofile, oversampling)
 
                 :param nqx:
                 :param nqy:
                 :param nqz:
                 :param bin_factor:
                 :param ofile: (default: None)
+                :param oversampling: 0 sums exp(iqr) over the particles for every q-vector,
+                                     n > 0 assigns the particles to a mesh of n*(2*nq+1) points per
+                                     axis and uses FFTs, faster for many q-vectors but approximate
+                                     (a few percent per q-vector for n = 4) (default: 0)
                 :type nqx:
                 :type nqy:
                 :type nqz:
                 :type bin_factor:
                 :type ofile:
+                :type oversampling: int
                 :rtype:
 
 .. function:: espressopp.analysis.StaticStructF.computeSingleChain(nqx, nqy, nqz, bin_factor, chainlength, ofile)
@@ -72,12 +77,14 @@ class StaticStructFLocal(ObservableLocal, analysis_StaticStructF):
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             cxxinit(self, analysis_StaticStructF, system)
 
-    def compute(self, nqx, nqy, nqz, bin_factor, ofile = None):
-        if ofile is None:
-            return self.cxxclass.compute(self, nqx, nqy, nqz, bin_factor)
+    def compute(self, nqx, nqy, nqz, bin_factor, ofile = None, oversampling = 0):
+        if oversampling > 0:
+            result = self.cxxclass.computeMesh(self, nqx, nqy, nqz, bin_factor, oversampling)
         else:
-            #run compute on each CPU
             result = self.cxxclass.compute(self, nqx, nqy, nqz, bin_factor)
+        if ofile is None:
+            return result
+        else:
             #create the outfile only on CPU 0
             if pmi.isController:
                 myofile = 'qsq_' + str(ofile) + '.txt'
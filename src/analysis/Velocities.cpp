@@ -25,13 +25,11 @@
 #include "Velocities.hpp"
 #include "storage/Storage.hpp"
 #include "iterator/CellListIterator.hpp"
-#include "mpi.h"
+#include "esutil/Collectives.hpp"
 #include <cmath>
 
 using namespace espressopp;
 
-#define DEFAULT_TAG 71
-
 namespace espressopp
 {
 namespace analysis
@@ -108,140 +106,50 @@ void Velocities::gather()
 {
     System& system = getSystemRef();
 
-    // determine number of local particles and total particles
+    // fill the buffers with my values
 
     int myN = system.storage->getNRealParticles();
-    int maxN;    // maximal number of particles one processor has
-    int totalN;  // totlal number of particles all processors have
-
-    boost::mpi::all_reduce(*system.comm, myN, maxN, boost::mpi::maximum<int>());
-    boost::mpi::all_reduce(*system.comm, myN, totalN, std::plus<int>());
-
-    LOG4ESPP_INFO(logger,
-                  "#Partices: me = " << myN << ", max = " << maxN << ", totalN = " << totalN);
-
-    real* coordinates = new real[3 * maxN];  // buffer for gather
-    int* ids = new int[maxN];                // buffer for gather
-
-    // fill the buffer with my values
+    std::vector<longint> ids;
+    std::vector<real> velocities;
+    ids.reserve(myN);
+    velocities.reserve(3 * myN);
 
     CellList realCells = system.storage->getRealCells();
 
-    int i = 0;
-
     for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
     {
-        ids[i] = cit->id();
-
-        // replaced position with velocity
-        Real3D& pos = cit->velocity();
-
-        coordinates[3 * i] = pos[0];
-        coordinates[3 * i + 1] = pos[1];
-        coordinates[3 * i + 2] = pos[2];
-
-        i++;
+        ids.push_back(cit->id());
+        Real3D& vel = cit->velocity();
+        velocities.insert(velocities.end(), vel.get(), vel.get() + 3);
     }
 
-    if (i != myN)
+    if (int(ids.size()) != myN)
     {
         LOG4ESPP_ERROR(logger, "mismatch for number of local particles");
     }
 
-    // each proc sends its data to master process
+    // the master process collects the data of all processors in rank order
+
+    std::vector<longint> allIds;
+    std::vector<real> allVelocities;
+    esutil::Collectives::gatherv(*system.comm, ids, allIds, 0);
+    esutil::Collectives::gatherv(*system.comm, velocities, allVelocities, 0);
 
     if (system.comm->rank() == 0)
     {
-        ConfigurationPtr config = std::make_shared<Configuration>();  // totalN
-
-        // root process collects data from all processors and sets it
-
-        int nproc = system.comm->size();
-
-        for (int iproc = 0; iproc < nproc; iproc++)
-        {
-            int nother;
-
-            if (iproc)
-            {
-                int nIds, nCoords;  // number of received values
-
-                boost::mpi::request req;
-                boost::mpi::status stat;
-
-                LOG4ESPP_DEBUG(logger, "receive tags from " << iproc);
-
-                req = system.comm->irecv<int>(iproc, DEFAULT_TAG, ids, maxN);
-                system.comm->send(iproc, DEFAULT_TAG, 0);
-                stat = req.wait();
-                nIds = *stat.count<int>();
+        LOG4ESPP_INFO(logger, "add " << allIds.size() << " velocities");
 
-                req = system.comm->irecv<real>(iproc, DEFAULT_TAG, coordinates, 3 * maxN);
-                system.comm->send(iproc, DEFAULT_TAG, 0);
-                stat = req.wait();
-                nCoords = *stat.count<real>();
+        // the velocities are stored as coordinates of the configuration
+        ConfigurationPtr config = std::make_shared<Configuration>();
 
-                // make sure to have 3 coordinate values for each id
-
-                if (nCoords != 3 * nIds)
-                {
-                    LOG4ESPP_ERROR(logger, "serious error collecting data, got "
-                                               << nIds << " ids, but " << nCoords
-                                               << " coordinates");
-                }
-
-                nother = nIds;
-            }
-            else
-            {
-                nother = myN;
-            }
-
-            LOG4ESPP_INFO(logger, "add " << nother << " coordinates of proc " << iproc);
-
-            for (int i = 0; i < nother; i++)
-            {
-                int index = ids[i];
-
-                LOG4ESPP_INFO(logger, "set coordianates of particle with id = "
-                                          << index << ": " << coordinates[3 * i] << " "
-                                          << coordinates[3 * i + 1] << " "
-                                          << coordinates[3 * i + 2]);
-
-                config->set(index, coordinates[3 * i], coordinates[3 * i + 1],
-                            coordinates[3 * i + 2]);
-            }
-        }
+        for (size_t i : Configuration::idOrder(allIds))
+            config->set(allIds[i], allVelocities[3 * i], allVelocities[3 * i + 1],
+                        allVelocities[3 * i + 2]);
 
         LOG4ESPP_INFO(logger, "save the latest configuration");
 
         pushConfig(config);
     }
-    else
-    {
-        LOG4ESPP_INFO(logger, "proc " << system.comm->rank() << " sends data " << " of " << myN
-                                      << " particles");
-
-        // not master process, send data to master process
-
-        int tmp;
-
-        boost::mpi::status stat;
-
-        // wait for a signal (empty message) before sending
-
-        system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-        system.comm->send<int>(0, DEFAULT_TAG, ids, myN);
-        system.comm->irecv<int>(0, DEFAULT_TAG, tmp);
-        system.comm->send<real>(0, DEFAULT_TAG, coordinates, 3 * myN);
-    }
-
-    // ToDo: remove first configuration if capacity is exhausted
-
-    // master process saves the configuration
-
-    delete[] coordinates;
-    delete[] ids;
 }
 
 // Python wrapping
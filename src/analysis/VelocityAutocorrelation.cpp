@@ -21,6 +21,7 @@
 */
 
 #include "VelocityAutocorrelation.hpp"
+#include "CorrelationFFT.hpp"
 
 using namespace std;
 // using namespace espressopp;
@@ -55,33 +56,52 @@ python::list VelocityAutocorrelation::compute() const
         }
     }
 
-    int perc = 0;
-    real denom = 100.0 / (real)M;
-    for (int m = 0; m < M; m++)
+    for (int m = 0; m < M; m++) Z[m] = 0.0;
+    if (useFFT && M > 0)
     {
-        totZ[m] = 0.0;
-        Z[m] = 0.0;
-        for (int n = 0; n < M - m; n++)
+        // time series of each velocity component of a particle
+        CorrelationFFT correlation(M);
+        vector<real> series(3 * M);
+        for (vector<longint>::iterator itr = localIDs.begin(); itr != localIDs.end(); ++itr)
         {
-            for (vector<longint>::iterator itr = localIDs.begin(); itr != localIDs.end(); ++itr)
+            size_t i = *itr;
+            for (int n = 0; n < M; n++)
             {
-                size_t i = *itr;
-                Real3D vel1 = getConf(n + m)->getCoordinates(i);
-                Real3D vel2 = getConf(n)->getCoordinates(i);
-                Z[m] += vel1 * vel2;
+                Real3D vel = getConf(n)->getCoordinates(i);
+                for (int d = 0; d < 3; d++) series[d * M + n] = vel[d];
             }
+            for (int d = 0; d < 3; d++) correlation.addProducts(&series[d * M], Z);
         }
-        /*
-         * additional calculations slow down routine but from the other hand
-         * it helps to monitor progress
-         */
-        if (print_progress && system.comm->rank() == 0)
+    }
+    else
+    {
+        int perc = 0;
+        real denom = 100.0 / (real)M;
+        for (int m = 0; m < M; m++)
         {
-            perc = (int)(m * denom);
-            if (perc % 5 == 0)
+            for (int n = 0; n < M - m; n++)
+            {
+                for (vector<longint>::iterator itr = localIDs.begin(); itr != localIDs.end();
+                     ++itr)
+                {
+                    size_t i = *itr;
+                    Real3D vel1 = getConf(n + m)->getCoordinates(i);
+                    Real3D vel2 = getConf(n)->getCoordinates(i);
+                    Z[m] += vel1 * vel2;
+                }
+            }
+            /*
+             * additional calculations slow down routine but from the other hand
+             * it helps to monitor progress
+             */
+            if (print_progress && system.comm->rank() == 0)
             {
-                cout << "calculation progress (velocity autocorrelation): " << perc << " %\r"
-                     << flush;
+                perc = (int)(m * denom);
+                if (perc % 5 == 0)
+                {
+                    cout << "calculation progress (velocity autocorrelation): " << perc << " %\r"
+                         << flush;
+                }
             }
         }
     }
@@ -119,7 +139,9 @@ void VelocityAutocorrelation::registerPython()
     class_<VelocityAutocorrelation, bases<ConfigsParticleDecomp> >(
         "analysis_VelocityAutocorrelation", init<std::shared_ptr<System> >())
         .add_property("print_progress", &VelocityAutocorrelation::getPrint_progress,
-                      &VelocityAutocorrelation::setPrint_progress);
+                      &VelocityAutocorrelation::setPrint_progress)
+        .add_property("useFFT", &VelocityAutocorrelation::getUseFFT,
+                      &VelocityAutocorrelation::setUseFFT);
 }
 }  // namespace analysis
 }  // namespace espressopp
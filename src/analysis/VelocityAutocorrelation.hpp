@@ -40,6 +40,7 @@ public:
     {
         // by default calculation progress is printed
         setPrint_progress(true);
+        setUseFFT(true);
 
         key = "velocity";
     }
@@ -50,10 +51,15 @@ public:
     void setPrint_progress(bool _print_progress) { print_progress = _print_progress; }
     bool getPrint_progress() { return print_progress; }
 
+    // compute the sums over time origins with FFTs, O(M log M) instead of O(M^2)
+    void setUseFFT(bool _useFFT) { useFFT = _useFFT; }
+    bool getUseFFT() { return useFFT; }
+
     static void registerPython();
 
 private:
     bool print_progress;
+    bool useFFT;
 };
 }  // namespace analysis
 }  // namespace espressopp
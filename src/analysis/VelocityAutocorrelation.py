@@ -29,6 +29,11 @@ espressopp.analysis.VelocityAutocorrelation
 
                 :param system:
                 :type system:
+
+.. attribute:: espressopp.analysis.VelocityAutocorrelation.useFFT
+
+                compute() sums over the time origins with FFTs, O(M log M) in the
+                number of configurations M instead of O(M^2) (default: True)
 """
 from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -45,6 +50,6 @@ class VelocityAutocorrelationLocal(ConfigsParticleDecompLocal, analysis_Velocity
 if pmi.isController:
     class VelocityAutocorrelation(ConfigsParticleDecomp, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
-          pmiproperty = [ 'print_progress' ],
+          pmiproperty = [ 'print_progress', 'useFFT' ],
           cls =  'espressopp.analysis.VelocityAutocorrelationLocal'
         )
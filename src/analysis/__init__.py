@@ -53,6 +53,7 @@ from espressopp.analysis.VelocityAutocorrelation import *
 from espressopp.analysis.MeanSquareDispl import *
 from espressopp.analysis.MeanSquareInternalDist import *
 from espressopp.analysis.Autocorrelation import *
+from espressopp.analysis.MultipleTauCorrelator import *
 from espressopp.analysis.RadialDistrF import *
 from espressopp.analysis.StaticStructF import *
 from espressopp.analysis.RDFatomistic import *
@@ -47,6 +47,7 @@
 #include "MeanSquareDispl.hpp"
 #include "MeanSquareInternalDist.hpp"
 #include "Autocorrelation.hpp"
+#include "MultipleTauCorrelator.hpp"
 #include "RadialDistrF.hpp"
 #include "StaticStructF.hpp"
 #include "RDFatomistic.hpp"
@@ -118,6 +119,7 @@ void registerPython()
     ParticleRadiusDistribution::registerPython();
 
     Autocorrelation::registerPython();
+    MultipleTauCorrelator::registerPython();
     Viscosity::registerPython();
 
     LBOutput::registerPython();
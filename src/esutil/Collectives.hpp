@@ -23,7 +23,10 @@
 // ESPP_CLASS
 #ifndef _ESUTIL_COLLECTIVES_HPP
 #define _ESUTIL_COLLECTIVES_HPP
+#include <limits>
+#include <numeric>
 #include <stdexcept>
+#include <vector>
 #include "mpi.hpp"
 
 namespace espressopp
@@ -56,6 +59,82 @@ public:
 */
 int locateItem(bool here, int controller, boost::mpi::communicator world = *mpiWorld);
 
+/** Gather the buffers of all nodes on the root, concatenated in rank order.
+    This function is SPMD. The data is moved by a single MPI_Gatherv, so T has
+    to be a builtin MPI datatype.
+
+    @param recv - on the root the gathered data, on the other nodes cleared
+*/
+template <class T>
+void gatherv(const boost::mpi::communicator& comm,
+             const std::vector<T>& send,
+             std::vector<T>& recv,
+             int root = 0)
+{
+    int size = send.size();
+    if (comm.rank() == root)
+    {
+        std::vector<int> sizes;
+        boost::mpi::gather(comm, size, sizes, root);
+        recv.resize(std::accumulate(sizes.begin(), sizes.end(), size_t(0)));
+        boost::mpi::gatherv(comm, send.data(), size, recv.data(), sizes, root);
+    }
+    else
+    {
+        recv.clear();
+        boost::mpi::gather(comm, size, root);
+        boost::mpi::gatherv(comm, send.data(), size, root);
+    }
+}
+
+/** Send the consecutive blocks of send to the nodes, sendCounts[i] elements to node i,
+    and receive the blocks of all nodes for this one, concatenated in rank order. This
+    function is SPMD. The data is moved by a single MPI_Alltoallv of a contiguous datatype
+    of sizeof(T) bytes, so T has to be copyable bytewise (builtin types, Particle). Counts
+    and offsets are in elements, so the data sent or received by a node must stay below
+    2^31 elements, not bytes.
+
+    @throw std::overflow_error if the elements sent or received by this node exceed that
+*/
+template <class T>
+void alltoallv(const boost::mpi::communicator& comm,
+               const std::vector<T>& send,
+               const std::vector<int>& sendCounts,
+               std::vector<T>& recv)
+{
+    int n = comm.size();
+    std::vector<int> recvCounts(n), sendOffsets(n), recvOffsets(n);
+    MPI_Alltoall(const_cast<int*>(sendCounts.data()), 1, MPI_INT, recvCounts.data(), 1, MPI_INT,
+                 comm);
+
+    size_t sendOffset = 0, recvOffset = 0;
+    for (int i = 0; i < n; i++)
+    {
+        sendOffsets[i] = sendOffset;
+        recvOffsets[i] = recvOffset;
+        sendOffset += sendCounts[i];
+        recvOffset += recvCounts[i];
+    }
+    // the offsets of the last blocks are ints as well; all nodes have to agree on
+    // giving up, otherwise the others would wait in MPI_Alltoallv
+    const size_t maxElements = std::numeric_limits<int>::max();
+    int overflow = sendOffset > maxElements || recvOffset > maxElements;
+    MPI_Allreduce(MPI_IN_PLACE, &overflow, 1, MPI_INT, MPI_LOR, comm);
+    if (overflow)
+    {
+        throw std::overflow_error("alltoallv: a node sends or receives more than 2^31 elements");
+    }
+
+    recv.resize(recvOffset);
+    MPI_Datatype element;
+    MPI_Type_contiguous(sizeof(T), MPI_BYTE, &element);
+    MPI_Type_commit(&element);
+    MPI_Alltoallv(const_cast<T*>(send.data()), const_cast<int*>(sendCounts.data()),
+                  sendOffsets.data(), element, recv.data(), recvCounts.data(),
+                  recvOffsets.data(), element, comm);
+    MPI_Type_free(&element);
+}
+
 void registerPython();
 }  // namespace Collectives
 }  // namespace esutil
@@ -0,0 +1,374 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include "ParallelFFT.hpp"
+
+namespace espressopp
+{
+namespace esutil
+{
+namespace
+{
+// number of reals per mesh value
+template <class T>
+inline int realsPer()
+{
+    return sizeof(T) / sizeof(real);
+}
+
+// pack/unpack a region of a box in the canonical x, y, z order
+template <class T>
+void packRegion(const T* data, const MeshBox& box, const MeshBox& region, T* out)
+{
+    Int3D i;
+    for (i[0] = region.lo[0]; i[0] < region.hi[0]; i[0]++)
+        for (i[1] = region.lo[1]; i[1] < region.hi[1]; i[1]++)
+            for (i[2] = region.lo[2]; i[2] < region.hi[2]; i[2]++) *out++ = data[box.index(i)];
+}
+
+template <class T>
+void unpackRegion(const T* in, const MeshBox& box, const MeshBox& region, T* data, bool add)
+{
+    Int3D i;
+    for (i[0] = region.lo[0]; i[0] < region.hi[0]; i[0]++)
+        for (i[1] = region.lo[1]; i[1] < region.hi[1]; i[1]++)
+            for (i[2] = region.lo[2]; i[2] < region.hi[2]; i[2]++)
+            {
+                if (add)
+                    data[box.index(i)] += *in++;
+                else
+                    data[box.index(i)] = *in++;
+            }
+}
+
+// split n points into parts pieces and return the range of piece i
+inline void splitRange(int n, int parts, int i, int& lo, int& hi)
+{
+    lo = int((longint)n * i / parts);
+    hi = int((longint)n * (i + 1) / parts);
+}
+
+// all periodic images that have to be checked when matching two boxes
+void imageShifts(const Int3D& M, bool periodic, std::vector<Int3D>& shifts)
+{
+    shifts.clear();
+    if (!periodic)
+    {
+        shifts.push_back(Int3D(0));
+        return;
+    }
+    for (int i = -1; i <= 1; i++)
+        for (int j = -1; j <= 1; j++)
+            for (int k = -1; k <= 1; k++) shifts.push_back(Int3D(i * M[0], j * M[1], k * M[2]));
+}
+}  // namespace
+
+/*-------------------------------------------------------------*/
+
+MeshRemap::MeshRemap(const mpi::communicator& _comm,
+                     const MeshBox& _srcBox,
+                     const MeshBox& _dstBox,
+                     const Int3D& M,
+                     bool periodic)
+    : comm(_comm), srcBox(_srcBox), dstBox(_dstBox)
+{
+    const int nprocs = _comm.size();
+
+    // every rank has to know the boxes of all other ranks
+    std::vector<int> myBoxes(12), allBoxes(12 * nprocs);
+    for (int i = 0; i < 3; i++)
+    {
+        myBoxes[i] = srcBox.lo[i];
+        myBoxes[3 + i] = srcBox.hi[i];
+        myBoxes[6 + i] = dstBox.lo[i];
+        myBoxes[9 + i] = dstBox.hi[i];
+    }
+    mpi::all_gather(_comm, &myBoxes[0], 12, &allBoxes[0]);
+
+    std::vector<Int3D> shifts;
+    imageShifts(M, periodic, shifts);
+
+    sendCounts.assign(nprocs, 0);
+    recvCounts.assign(nprocs, 0);
+    for (int r = 0; r < nprocs; r++)
+    {
+        const int* b = &allBoxes[12 * r];
+        MeshBox otherSrc(Int3D(b[0], b[1], b[2]), Int3D(b[3], b[4], b[5]));
+        MeshBox otherDst(Int3D(b[6], b[7], b[8]), Int3D(b[9], b[10], b[11]));
+
+        // a source point x goes to the destination point x + shift; sender and receiver
+        // loop over the shifts in the same order, so the regions match
+        for (const Int3D& shift : shifts)
+        {
+            MeshBox send = srcBox.intersect(otherDst.shifted(Int3D(0) - shift));
+            if (!send.empty())
+            {
+                sends.push_back(Transfer{r, send, send.shifted(shift)});
+                sendCounts[r] += send.size();
+            }
+            MeshBox recv = otherSrc.intersect(dstBox.shifted(Int3D(0) - shift));
+            if (!recv.empty())
+            {
+                recvs.push_back(Transfer{r, recv, recv.shifted(shift)});
+                recvCounts[r] += recv.size();
+            }
+        }
+    }
+
+    sendOffsets.assign(nprocs, 0);
+    recvOffsets.assign(nprocs, 0);
+    for (int r = 1; r < nprocs; r++)
+    {
+        sendOffsets[r] = sendOffsets[r - 1] + sendCounts[r - 1];
+        recvOffsets[r] = recvOffsets[r - 1] + recvCounts[r - 1];
+    }
+}
+
+template <class T>
+void MeshRemap::execute(const T* in, T* out, bool add)
+{
+    const int nprocs = sendCounts.size();
+    const int n = realsPer<T>();
+
+    size_t sendTotal = nprocs ? sendOffsets[nprocs - 1] + sendCounts[nprocs - 1] : 0;
+    size_t recvTotal = nprocs ? recvOffsets[nprocs - 1] + recvCounts[nprocs - 1] : 0;
+    if (sendBuf.size() < n * sendTotal) sendBuf.resize(n * sendTotal);
+    if (recvBuf.size() < n * recvTotal) recvBuf.resize(n * recvTotal);
+
+    // transfers to one rank are stored consecutively, in the order they were set up
+    T* sendData = reinterpret_cast<T*>(sendBuf.data());
+    for (const Transfer& t : sends)
+    {
+        packRegion(in, srcBox, t.src, sendData);
+        sendData += t.src.size();
+    }
+
+    std::vector<int> sc(nprocs), so(nprocs), rc(nprocs), ro(nprocs);
+    for (int r = 0; r < nprocs; r++)
+    {
+        sc[r] = n * sendCounts[r];
+        so[r] = n * sendOffsets[r];
+        rc[r] = n * recvCounts[r];
+        ro[r] = n * recvOffsets[r];
+    }
+    MPI_Alltoallv(sendBuf.data(), sc.data(), so.data(), MPI_DOUBLE, recvBuf.data(), rc.data(),
+                  ro.data(), MPI_DOUBLE, comm);
+
+    const T* recvData = reinterpret_cast<const T*>(recvBuf.data());
+    for (const Transfer& t : recvs)
+    {
+        unpackRegion(recvData, dstBox, t.dst, out, add);
+        recvData += t.dst.size();
+    }
+}
+
+template void MeshRemap::execute<real>(const real*, real*, bool);
+template void MeshRemap::execute<dcomplex>(const dcomplex*, dcomplex*, bool);
+
+/*-------------------------------------------------------------*/
+
+ParallelFFT::ParallelFFT(const mpi::communicator& comm,
+                         const Int3D& meshSize,
+                         const MeshBox& _inBox,
+                         bool _realData,
+                         unsigned planFlags)
+    : M(meshSize), realData(_realData), inBox(_inBox), cur(0)
+{
+    // process grid p1 x p2 for the pencils, as square as possible
+    const int nprocs = comm.size();
+    int p1 = int(std::sqrt(real(nprocs)));
+    while (nprocs % p1) p1--;
+    const int p2 = nprocs / p1;
+    const int r1 = comm.rank() / p2;
+    const int r2 = comm.rank() % p2;
+
+    // the complex mesh after a real-to-complex transform along z
+    Int3D Mc = M;
+    if (realData) Mc[2] = M[2] / 2 + 1;
+
+    // pencils along axis a split the two other axes b, c over the process grid, the
+    // pencil axis is stored fastest
+    for (int a = 0; a < 3; a++)
+    {
+        const int b = (a == 0) ? 1 : 0;
+        const int c = (a == 2) ? 1 : 2;
+        MeshBox& box = pencil[a];
+        box.lo[a] = 0;
+        box.hi[a] = Mc[a];
+        splitRange(Mc[b], p1, r1, box.lo[b], box.hi[b]);
+        splitRange(Mc[c], p2, r2, box.lo[c], box.hi[c]);
+        box.order = Int3D(b, c, a);
+    }
+    realPencil = pencil[2];
+    realPencil.hi[2] = M[2];
+
+    inToZ = MeshRemap(comm, inBox, realPencil, M, false);
+    zToY = MeshRemap(comm, pencil[2], pencil[1], Mc, false);
+    yToX = MeshRemap(comm, pencil[1], pencil[0], Mc, false);
+    xToY = MeshRemap(comm, pencil[0], pencil[1], Mc, false);
+    yToZ = MeshRemap(comm, pencil[1], pencil[2], Mc, false);
+    zToIn = MeshRemap(comm, realPencil, inBox, M, false);
+
+    // real data needs half the space of complex data
+    bufSize = std::max<size_t>(realData ? inBox.size() / 2 + 1 : inBox.size(), 1);
+    if (realData) bufSize = std::max(bufSize, realPencil.size() / 2 + 1);
+    for (int a = 0; a < 3; a++) bufSize = std::max(bufSize, pencil[a].size());
+    buf[0] = fftw_alloc_complex(bufSize);
+    buf[1] = fftw_alloc_complex(bufSize);
+
+    // 1D transforms along the contiguous pencil axis, executed on either buffer; the
+    // real-to-complex transforms work out of place
+    for (int a = 0; a < 3; a++)
+    {
+        int n = M[a];
+        int howmany = pencil[a].size() / Mc[a];
+        if (howmany == 0)
+        {
+            // this rank holds no pencils along a
+            planFrw[a] = planBcw[a] = NULL;
+            continue;
+        }
+        if (realData && a == 2)
+        {
+            real* rbuf = reinterpret_cast<real*>(buf[0]);
+            planFrw[a] = fftw_plan_many_dft_r2c(1, &n, howmany, rbuf, NULL, 1, n, buf[1], NULL,
+                                                1, Mc[2], planFlags);
+            planBcw[a] = fftw_plan_many_dft_c2r(1, &n, howmany, buf[1], NULL, 1, Mc[2], rbuf,
+                                                NULL, 1, n, planFlags);
+            continue;
+        }
+        planFrw[a] = fftw_plan_many_dft(1, &n, howmany, buf[0], NULL, 1, n, buf[0], NULL, 1, n,
+                                        FFTW_FORWARD, planFlags);
+        planBcw[a] = fftw_plan_many_dft(1, &n, howmany, buf[0], NULL, 1, n, buf[0], NULL, 1, n,
+                                        FFTW_BACKWARD, planFlags);
+    }
+}
+
+ParallelFFT::~ParallelFFT()
+{
+    for (int a = 0; a < 3; a++)
+    {
+        if (planFrw[a]) fftw_destroy_plan(planFrw[a]);
+        if (planBcw[a]) fftw_destroy_plan(planBcw[a]);
+    }
+    fftw_free(buf[0]);
+    fftw_free(buf[1]);
+}
+
+size_t ParallelFFT::getMemory() const
+{
+    size_t mem = 2 * bufSize * sizeof(fftw_complex);
+    mem += inToZ.getMemory() + zToY.getMemory() + yToX.getMemory();
+    mem += xToY.getMemory() + yToZ.getMemory() + zToIn.getMemory();
+    return mem;
+}
+
+bool ParallelFFT::importWisdom(const mpi::communicator& comm, const std::string& filename)
+{
+    std::string wisdom;
+    if (comm.rank() == 0)
+    {
+        std::ifstream in(filename.c_str());
+        if (in) wisdom.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    mpi::broadcast(comm, wisdom, 0);
+
+    return !wisdom.empty() && fftw_import_wisdom_from_string(wisdom.c_str());
+}
+
+void ParallelFFT::exportWisdom(const mpi::communicator& comm, const std::string& filename)
+{
+    // every rank plans its own transform sizes, so the wisdom of all ranks is merged
+    char* str = fftw_export_wisdom_to_string();
+    std::string wisdom(str ? str : "");
+    free(str);
+
+    std::vector<std::string> all;
+    mpi::gather(comm, wisdom, all, 0);
+    if (comm.rank() == 0)
+    {
+        for (const std::string& w : all) fftw_import_wisdom_from_string(w.c_str());
+        fftw_export_wisdom_to_filename(filename.c_str());
+    }
+}
+
+void ParallelFFT::remap(MeshRemap& r)
+{
+    r.execute(reinterpret_cast<dcomplex*>(buf[cur]), reinterpret_cast<dcomplex*>(buf[1 - cur]));
+    cur = 1 - cur;
+}
+
+void ParallelFFT::remapReal(MeshRemap& r)
+{
+    r.execute(reinterpret_cast<real*>(buf[cur]), reinterpret_cast<real*>(buf[1 - cur]));
+    cur = 1 - cur;
+}
+
+void ParallelFFT::transform(fftw_plan plan)
+{
+    if (plan) fftw_execute_dft(plan, buf[cur], buf[cur]);
+}
+
+void ParallelFFT::forward()
+{
+    if (realData)
+    {
+        remapReal(inToZ);
+        if (planFrw[2])
+            fftw_execute_dft_r2c(planFrw[2], reinterpret_cast<real*>(buf[cur]), buf[1 - cur]);
+        cur = 1 - cur;
+    }
+    else
+    {
+        remap(inToZ);
+        transform(planFrw[2]);
+    }
+    remap(zToY);
+    transform(planFrw[1]);
+    remap(yToX);
+    transform(planFrw[0]);
+}
+
+void ParallelFFT::backward()
+{
+    transform(planBcw[0]);
+    remap(xToY);
+    transform(planBcw[1]);
+    remap(yToZ);
+    if (realData)
+    {
+        if (planBcw[2])
+            fftw_execute_dft_c2r(planBcw[2], buf[cur], reinterpret_cast<real*>(buf[1 - cur]));
+        cur = 1 - cur;
+        remapReal(zToIn);
+    }
+    else
+    {
+        transform(planBcw[2]);
+        remap(zToIn);
+    }
+}
+}  // namespace esutil
+}  // namespace espressopp
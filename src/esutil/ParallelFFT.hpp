@@ -0,0 +1,199 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ESUTIL_PARALLELFFT_HPP
+#define _ESUTIL_PARALLELFFT_HPP
+
+#include <complex>
+#include <string>
+#include <vector>
+#include <fftw3.h>
+
+#include "types.hpp"
+#include "Int3D.hpp"
+
+namespace espressopp
+{
+namespace esutil
+{
+typedef std::complex<real> dcomplex;
+
+/** Box [lo, hi) of points of a global 3D mesh, together with the order in which
+    the points are stored: order[0] is the slowest and order[2] the fastest running
+    axis. The box coordinates may lie outside of the global mesh, e.g. for halo
+    regions, they are then understood as periodic images.
+*/
+struct MeshBox
+{
+    Int3D lo, hi;
+    Int3D order;
+
+    MeshBox() : lo(0), hi(0), order(0, 1, 2) {}
+    MeshBox(const Int3D& _lo, const Int3D& _hi, const Int3D& _order = Int3D(0, 1, 2))
+        : lo(_lo), hi(_hi), order(_order)
+    {
+    }
+
+    int extent(int axis) const { return std::max(hi[axis] - lo[axis], 0); }
+
+    size_t size() const { return size_t(extent(0)) * extent(1) * extent(2); }
+
+    bool empty() const { return size() == 0; }
+
+    bool contains(const Int3D& i) const
+    {
+        return i[0] >= lo[0] && i[0] < hi[0] && i[1] >= lo[1] && i[1] < hi[1] && i[2] >= lo[2] &&
+               i[2] < hi[2];
+    }
+
+    /** storage index of the mesh point i, given in global coordinates */
+    size_t index(const Int3D& i) const
+    {
+        const int a = order[0], b = order[1], c = order[2];
+        return (size_t(i[a] - lo[a]) * extent(b) + (i[b] - lo[b])) * extent(c) + (i[c] - lo[c]);
+    }
+
+    /** common part of two boxes, the storage order is taken from this box */
+    MeshBox intersect(const MeshBox& other) const
+    {
+        MeshBox res(lo, hi, order);
+        for (int i = 0; i < 3; i++)
+        {
+            res.lo[i] = std::max(lo[i], other.lo[i]);
+            res.hi[i] = std::min(hi[i], other.hi[i]);
+        }
+        return res;
+    }
+
+    MeshBox shifted(const Int3D& shift) const { return MeshBox(lo + shift, hi + shift, order); }
+};
+
+/** Redistribution of mesh data between two decompositions of the same global mesh
+    over the ranks of a communicator. Every rank passes the box it holds in the source
+    and in the destination decomposition. If periodic is set, points are matched modulo
+    the mesh size, which is used to move halo regions from or to their owners.
+*/
+class MeshRemap
+{
+public:
+    MeshRemap() {}
+    MeshRemap(const mpi::communicator& comm,
+              const MeshBox& srcBox,
+              const MeshBox& dstBox,
+              const Int3D& meshSize,
+              bool periodic);
+
+    /** move the data of in (source layout) to out (destination layout). If add is set,
+        the values are added to out, otherwise out is overwritten. Points of out not covered
+        by any source box are left untouched. T is real or dcomplex. */
+    template <class T>
+    void execute(const T* in, T* out, bool add = false);
+
+    size_t getMemory() const { return (sendBuf.capacity() + recvBuf.capacity()) * sizeof(real); }
+
+private:
+    // one region to exchange with one rank, in source and in destination coordinates
+    struct Transfer
+    {
+        int rank;
+        MeshBox src;
+        MeshBox dst;
+    };
+
+    MPI_Comm comm;
+    MeshBox srcBox, dstBox;
+    std::vector<Transfer> sends, recvs;
+    // number of points per rank and offsets in the exchange buffers
+    std::vector<int> sendCounts, sendOffsets, recvCounts, recvOffsets;
+    std::vector<real> sendBuf, recvBuf;
+};
+
+/** Distributed 3D FFT with a pencil decomposition.
+
+    The input data is distributed in arbitrary boxes (one per rank, e.g. following the
+    domain decomposition of the particles). It is redistributed to pencils along z,
+    transformed, redistributed to pencils along y, transformed, and finally to pencils
+    along x. The result of the forward transform stays in the x-pencil layout
+    (getOutBox()), the backward transform takes data in this layout and returns it
+    in the input boxes (getInBox()). Both transforms are unnormalized, like FFTW.
+
+    With realData set, the input is real (getRealData()) and the z transform is a
+    real-to-complex one, so only the points 0 <= k_z <= M_z/2 of the Hermitian spectrum
+    are stored and transformed. The backward transform then expects a Hermitian
+    spectrum and returns real data.
+
+    The 1D plans are created once in the constructor with the given FFTW flags. For
+    FFTW_MEASURE, the planning time can be saved across runs with importWisdom() and
+    exportWisdom().
+*/
+class ParallelFFT
+{
+public:
+    ParallelFFT(const mpi::communicator& comm,
+                const Int3D& meshSize,
+                const MeshBox& inBox,
+                bool realData = false,
+                unsigned planFlags = FFTW_ESTIMATE);
+    ~ParallelFFT();
+
+    const MeshBox& getInBox() const { return inBox; }
+    const MeshBox& getOutBox() const { return pencil[0]; }
+
+    /** buffer holding the input before and the output after a transform */
+    dcomplex* getData() { return reinterpret_cast<dcomplex*>(buf[cur]); }
+    real* getRealData() { return reinterpret_cast<real*>(buf[cur]); }
+
+    void forward();
+    void backward();
+
+    /** memory in bytes of the transform and exchange buffers */
+    size_t getMemory() const;
+
+    /** read FFTW wisdom from file on rank 0 and pass it to all ranks; returns false
+        if the file could not be read */
+    static bool importWisdom(const mpi::communicator& comm, const std::string& filename);
+    /** collect the FFTW wisdom of all ranks and write it to file on rank 0 */
+    static void exportWisdom(const mpi::communicator& comm, const std::string& filename);
+
+private:
+    void remap(MeshRemap& r);
+    void remapReal(MeshRemap& r);
+    void transform(fftw_plan plan);
+
+    Int3D M;
+    bool realData;
+    MeshBox inBox;
+    // pencil[a] is the local box of the pencils along axis a, realPencil the real
+    // z-pencils before the r2c transform
+    MeshBox pencil[3];
+    MeshBox realPencil;
+
+    // remaps between input boxes and the pencils, forward and backward direction
+    MeshRemap inToZ, zToY, yToX, xToY, yToZ, zToIn;
+
+    fftw_plan planFrw[3], planBcw[3];
+    fftw_complex* buf[2];
+    size_t bufSize;
+    int cur;
+};
+}  // namespace esutil
+}  // namespace espressopp
+
+#endif
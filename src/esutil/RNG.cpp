@@ -83,14 +83,25 @@ Real3D RNG::uniformOnSphere() { return uniformOnSphereVariate(); }
 
 std::shared_ptr<RNGType> RNG::getBoostRNG() { return boostRNG; }
 
-void RNG::saveState(long long step)
+std::string RNG::getState()
 {
     std::ostringstream oss;
     oss << *boostRNG;
+    return oss.str();
+}
+
+void RNG::setState(const std::string& state)
+{
+    std::istringstream iss(state);
+    iss >> *boostRNG;
+}
+
+void RNG::saveState(long long step)
+{
     if (mpiWorld->rank() == 0)
     {
         std::vector<std::string> oss_str_vec;
-        boost::mpi::gather(*mpiWorld, oss.str(), oss_str_vec, 0);
+        boost::mpi::gather(*mpiWorld, getState(), oss_str_vec, 0);
         std::string outfn = "rng." + std::to_string(step);
         std::ofstream ofs(outfn, std::ios::out | std::ios::binary);
         if (ofs.is_open())
@@ -104,7 +115,7 @@ void RNG::saveState(long long step)
     }
     else
     {
-        boost::mpi::gather(*mpiWorld, oss.str(), 0);
+        boost::mpi::gather(*mpiWorld, getState(), 0);
     }
 }
 
@@ -136,8 +147,7 @@ void RNG::loadState(const char* fname)
         return;
     }
     boost::mpi::scatter(*mpiWorld, rng_str_vec, rng_str, 0);
-    std::istringstream iss(rng_str);
-    iss >> *boostRNG;
+    setState(rng_str);
 }
 
 //////////////////////////////////////////////////
@@ -77,6 +77,10 @@ public:
 
     std::shared_ptr<RNGType> getBoostRNG();
 
+    /** The state of the generator of this CPU as text. */
+    std::string getState();
+    void setState(const std::string& state);
+
     void saveState(long long);
 
     void loadState(const char*);
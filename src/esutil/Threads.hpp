@@ -0,0 +1,62 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ESUTIL_THREADS_HPP
+#define _ESUTIL_THREADS_HPP
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/** Emit an OpenMP pragma only when compiled with OpenMP (WITH_OPENMP=ON), so that
+    serial builds do not warn about unknown pragmas. Usage: ESPP_OMP(omp parallel for) */
+#ifdef _OPENMP
+#define ESPP_OMP(x) _Pragma(#x)
+#else
+#define ESPP_OMP(x)
+#endif
+
+namespace espressopp
+{
+namespace esutil
+{
+/** Number of threads a parallel region inside one MPI rank will use. */
+inline int getMaxThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/** Index of the calling thread inside the current parallel region. */
+inline int getThreadNum()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+}  // namespace esutil
+}  // namespace espressopp
+
+#endif
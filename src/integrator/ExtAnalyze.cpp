@@ -63,6 +63,11 @@ void ExtAnalyze::perform_action()
     {
         particle_access->perform_action();
     }
+    // the next step is sampled, its force pass can tally the energy and virial
+    if (integrator->getTally() && integrator->getStep() % interval == 0)
+    {
+        integrator->requestTallies();
+    }
 }
 
 /****************************************************
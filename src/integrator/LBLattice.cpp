@@ -0,0 +1,245 @@
+/*
+ Copyright (C) 2026
+     Max Planck Institute for Polymer Research & JGU Mainz
+
+ This file is part of ESPResSo++.
+
+ ESPResSo++ is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ ESPResSo++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include "LBLattice.hpp"
+
+namespace espressopp
+{
+namespace integrator
+{
+namespace
+{
+// D3Q19 velocity vectors, in the order of LatticeBoltzmann::initLatticeModel()
+const int c_i[19][3] = {{0, 0, 0},   {1, 0, 0},   {-1, 0, 0}, {0, 1, 0},  {0, -1, 0},
+                        {0, 0, 1},   {0, 0, -1},  {1, 1, 0},  {-1, -1, 0}, {1, -1, 0},
+                        {-1, 1, 0},  {1, 0, 1},   {-1, 0, -1}, {1, 0, -1}, {-1, 0, 1},
+                        {0, 1, 1},   {0, -1, -1}, {0, 1, -1}, {0, -1, 1}};
+
+/* FUSED COLLISION AND STREAMING OF ONE ROW OF SITES */
+// the moments, their relaxation, the forces and the back-transformation follow
+// B.Dünweg & A.J.C.Ladd in Adv.Poly.Sci. 221, 89-166 (2009). The force is applied
+// unconditionally (it is zero without forces), so the loop has no branches and can be
+// vectorized; the thermal fluctuations are a separate instantiation.
+template <bool FLUCT>
+void collideStreamKernel(const real* const* src,
+                         real* const* dst,
+                         int _k0,
+                         int _k1,
+                         const LBCollisionPar& par,
+                         const real* fx,
+                         const real* fy,
+                         const real* fz,
+                         const real* rnd)
+{
+    const real g_b = par.gamma[0], g_s = par.gamma[1], g_odd = par.gamma[2],
+               g_even = par.gamma[3];
+
+    ESPP_VEC_PRAGMAS
+    for (int k = _k0; k < _k1; k++)
+    {
+        real m[19];
+
+        /* local moments */
+        real f0 = src[0][k];
+        real f1p2 = src[1][k] + src[2][k], f1m2 = src[1][k] - src[2][k];
+        real f3p4 = src[3][k] + src[4][k], f3m4 = src[3][k] - src[4][k];
+        real f5p6 = src[5][k] + src[6][k], f5m6 = src[5][k] - src[6][k];
+        real f7p8 = src[7][k] + src[8][k], f7m8 = src[7][k] - src[8][k];
+        real f9p10 = src[9][k] + src[10][k], f9m10 = src[9][k] - src[10][k];
+        real f11p12 = src[11][k] + src[12][k], f11m12 = src[11][k] - src[12][k];
+        real f13p14 = src[13][k] + src[14][k], f13m14 = src[13][k] - src[14][k];
+        real f15p16 = src[15][k] + src[16][k], f15m16 = src[15][k] - src[16][k];
+        real f17p18 = src[17][k] + src[18][k], f17m18 = src[17][k] - src[18][k];
+
+        m[0] = f0 + f1p2 + f3p4 + f5p6 + f7p8 + f9p10 + f11p12 + f13p14 + f15p16 + f17p18;
+
+        m[1] = f1m2 + f7m8 + f9m10 + f11m12 + f13m14;
+        m[2] = f3m4 + f7m8 - f9m10 + f15m16 + f17m18;
+        m[3] = f5m6 + f11m12 - f13m14 + f15m16 - f17m18;
+
+        m[4] = -f0 + f7p8 + f9p10 + f11p12 + f13p14 + f15p16 + f17p18;
+        m[5] = 2. * f1p2 - f3p4 - f5p6 + f7p8 + f9p10 + f11p12 + f13p14 - 2. * (f15p16 + f17p18);
+        m[6] = f3p4 - f5p6 + f7p8 + f9p10 - f11p12 - f13p14;
+        m[7] = f7p8 - f9p10;
+        m[8] = f11p12 - f13p14;
+        m[9] = f15p16 - f17p18;
+
+        m[10] = -2. * f1m2 + f7m8 + f9m10 + f11m12 + f13m14;
+        m[11] = -2. * f3m4 + f7m8 - f9m10 + f15m16 + f17m18;
+        m[12] = -2. * f5m6 + f11m12 - f13m14 + f15m16 - f17m18;
+        m[13] = f7m8 + f9m10 - f11m12 - f13m14;
+        m[14] = -f7m8 + f9m10 + f15m16 + f17m18;
+        m[15] = f11m12 - f13m14 - f15m16 + f17m18;
+        m[16] = f0 - 2. * (f1p2 + f3p4 + f5p6) + f7p8 + f9p10 + f11p12 + f13p14 + f15p16 + f17p18;
+        m[17] = -2. * f1p2 + f3p4 + f5p6 + f7p8 + f9p10 + f11p12 + f13p14 - 2. * (f15p16 + f17p18);
+        m[18] = -f3p4 + f5p6 + f7p8 + f9p10 - f11p12 - f13p14;
+
+        /* relaxation towards the equilibrium moments */
+        const int s = k - _k0;
+        const real F0 = fx[s], F1 = fy[s], F2 = fz[s];
+
+        real j0 = m[1] * par.aOverTau + 0.5 * F0;
+        real j1 = m[2] * par.aOverTau + 0.5 * F1;
+        real j2 = m[3] * par.aOverTau + 0.5 * F2;
+        real invRho = 1. / m[0];
+        real j2sum = j0 * j0 + j1 * j1 + j2 * j2;
+
+        real pi0 = j2sum * invRho;
+        real pi1 = (j0 * j0 - j1 * j1) * invRho;
+        real pi2 = (3. * j0 * j0 - j2sum) * invRho;
+        real pi3 = j0 * j1 * invRho;
+        real pi4 = j0 * j2 * invRho;
+        real pi5 = j1 * j2 * invRho;
+
+        m[4] = pi0 + g_b * (m[4] - pi0);
+        m[5] = pi1 + g_s * (m[5] - pi1);
+        m[6] = pi2 + g_s * (m[6] - pi2);
+        m[7] = pi3 + g_s * (m[7] - pi3);
+        m[8] = pi4 + g_s * (m[8] - pi4);
+        m[9] = pi5 + g_s * (m[9] - pi5);
+
+        m[10] *= g_odd;
+        m[11] *= g_odd;
+        m[12] *= g_odd;
+        m[13] *= g_odd;
+        m[14] *= g_odd;
+        m[15] *= g_odd;
+
+        m[16] *= g_even;
+        m[17] *= g_even;
+        m[18] *= g_even;
+
+        /* thermal fluctuations, uniform random numbers (hence the factor 12) */
+        if (FLUCT)
+        {
+            real rootRho = std::sqrt(12. * m[0]);
+            for (int l = 4; l < 19; l++)
+                m[l] += rootRho * par.phi[l] * (rnd[15 * s + l - 4] - 0.5);
+        }
+
+        /* external and coupling forces */
+        real u0 = (0.5 * F0 + m[1]) * invRho;
+        real u1 = (0.5 * F1 + m[2]) * invRho;
+        real u2 = (0.5 * F2 + m[3]) * invRho;
+
+        m[1] += F0;
+        m[2] += F1;
+        m[3] += F2;
+
+        real g_sp = g_s + 1.;
+        real g_sph = 0.5 * g_sp;
+        real secTerm = (1. / 3.) * (g_b - g_s) * (u0 * F0 + u1 * F1 + u2 * F2);
+
+        real sigma0 = g_sp * u0 * F0 + secTerm;
+        real sigma1 = g_sp * u1 * F1 + secTerm;
+        real sigma2 = g_sp * u2 * F2 + secTerm;
+
+        m[4] += sigma0 + sigma1 + sigma2;
+        m[5] += 2. * sigma0 - sigma1 - sigma2;
+        m[6] += sigma1 - sigma2;
+        m[7] += g_sph * (u0 * F1 + u1 * F0);
+        m[8] += g_sph * (u0 * F2 + u2 * F0);
+        m[9] += g_sph * (u1 * F2 + u2 * F1);
+
+        /* back-transformation to the populations and streaming */
+        const real* b = par.invB;
+        m[0] *= b[0], m[1] *= b[1], m[2] *= b[2], m[3] *= b[3], m[4] *= b[4];
+        m[5] *= b[5], m[6] *= b[6], m[7] *= b[7], m[8] *= b[8], m[9] *= b[9];
+        m[10] *= b[10], m[11] *= b[11], m[12] *= b[12], m[13] *= b[13], m[14] *= b[14];
+        m[15] *= b[15], m[16] *= b[16], m[17] *= b[17], m[18] *= b[18];
+
+        const real* w = par.eqWeight;
+        dst[0][k] = w[0] * (m[0] - m[4] + m[16]);
+        dst[1][k] = w[1] * (m[0] + m[1] + 2. * (m[5] - m[10] - m[16] - m[17]));
+        dst[2][k] = w[2] * (m[0] - m[1] + 2. * (m[5] + m[10] - m[16] - m[17]));
+        dst[3][k] = w[3] * (m[0] + m[2] - m[5] + m[6] - 2. * (m[11] + m[16]) + m[17] - m[18]);
+        dst[4][k] = w[4] * (m[0] - m[2] - m[5] + m[6] + 2. * (m[11] - m[16]) + m[17] - m[18]);
+        dst[5][k] = w[5] * (m[0] + m[3] - m[5] - m[6] - 2. * (m[12] + m[16]) + m[17] + m[18]);
+        dst[6][k] = w[6] * (m[0] - m[3] - m[5] - m[6] + 2. * (m[12] - m[16]) + m[17] + m[18]);
+
+        dst[7][k] = w[7] * (m[0] + m[1] + m[2] + m[4] + m[5] + m[6] + m[7] + m[10] + m[11] +
+                            m[13] - m[14] + m[16] + m[17] + m[18]);
+        dst[8][k] = w[8] * (m[0] - m[1] - m[2] + m[4] + m[5] + m[6] + m[7] - m[10] - m[11] -
+                            m[13] + m[14] + m[16] + m[17] + m[18]);
+        dst[9][k] = w[9] * (m[0] + m[1] - m[2] + m[4] + m[5] + m[6] - m[7] + m[10] - m[11] +
+                            m[13] + m[14] + m[16] + m[17] + m[18]);
+        dst[10][k] = w[10] * (m[0] - m[1] + m[2] + m[4] + m[5] + m[6] - m[7] - m[10] + m[11] -
+                              m[13] - m[14] + m[16] + m[17] + m[18]);
+
+        dst[11][k] = w[11] * (m[0] + m[1] + m[3] + m[4] + m[5] - m[6] + m[8] + m[10] + m[12] -
+                              m[13] + m[15] + m[16] + m[17] - m[18]);
+        dst[12][k] = w[12] * (m[0] - m[1] - m[3] + m[4] + m[5] - m[6] + m[8] - m[10] - m[12] +
+                              m[13] - m[15] + m[16] + m[17] - m[18]);
+        dst[13][k] = w[13] * (m[0] + m[1] - m[3] + m[4] + m[5] - m[6] - m[8] + m[10] - m[12] -
+                              m[13] - m[15] + m[16] + m[17] - m[18]);
+        dst[14][k] = w[14] * (m[0] - m[1] + m[3] + m[4] + m[5] - m[6] - m[8] - m[10] + m[12] +
+                              m[13] + m[15] + m[16] + m[17] - m[18]);
+
+        dst[15][k] = w[15] * (m[0] + m[2] + m[3] + m[4] - 2. * m[5] + m[9] + m[11] + m[12] +
+                              m[14] - m[15] + m[16] - 2. * m[17]);
+        dst[16][k] = w[16] * (m[0] - m[2] - m[3] + m[4] - 2. * m[5] + m[9] - m[11] - m[12] -
+                              m[14] + m[15] + m[16] - 2. * m[17]);
+        dst[17][k] = w[17] * (m[0] + m[2] - m[3] + m[4] - 2. * m[5] - m[9] + m[11] - m[12] +
+                              m[14] + m[15] + m[16] - 2. * m[17]);
+        dst[18][k] = w[18] * (m[0] - m[2] + m[3] + m[4] - 2. * m[5] - m[9] - m[11] + m[12] -
+                              m[14] - m[15] + m[16] - 2. * m[17]);
+    }
+}
+}  // namespace
+
+LBLattice::LBLattice(Int3D _size, int _numVels) : size(_size), numVels(_numVels)
+{
+    stride = vec::ESPP_FIT_TO_VECTOR_WIDTH(size_t(size[0]) * size[1] * size[2]);
+    f.assign(numVels * stride, 0.);
+}
+
+/*******************************************************************************************/
+
+void LBLattice::collideStreamRow(LBLattice& _dst,
+                                 int _i,
+                                 int _j,
+                                 int _k0,
+                                 int _k1,
+                                 const LBCollisionPar& par,
+                                 const real* fx,
+                                 const real* fy,
+                                 const real* fz,
+                                 const real* rnd) const
+{
+    const size_t base = index(_i, _j, 0);
+
+    // source and (shifted) destination of every direction
+    const real* src[19];
+    real* dst[19];
+    for (int l = 0; l < 19; l++)
+    {
+        long off = (long(c_i[l][0]) * size[1] + c_i[l][1]) * size[2] + c_i[l][2];
+        src[l] = pops(l) + base;
+        dst[l] = _dst.pops(l) + base + off;
+    }
+
+    if (par.fluct)
+        collideStreamKernel<true>(src, dst, _k0, _k1, par, fx, fy, fz, rnd);
+    else
+        collideStreamKernel<false>(src, dst, _k0, _k1, par, fx, fy, fz, rnd);
+}
+}  // namespace integrator
+}  // namespace espressopp
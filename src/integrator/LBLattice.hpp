@@ -0,0 +1,104 @@
+/*
+ Copyright (C) 2026
+     Max Planck Institute for Polymer Research & JGU Mainz
+
+ This file is part of ESPResSo++.
+
+ ESPResSo++ is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ ESPResSo++ is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// ESPP_CLASS
+#ifndef _INTEGRATOR_LBLATTICE_HPP
+#define _INTEGRATOR_LBLATTICE_HPP
+
+#include "types.hpp"
+#include "Int3D.hpp"
+#include "vec/include/simdconfig.hpp"
+
+namespace espressopp
+{
+namespace integrator
+{
+/** Parameters of the D3Q19 moment-space collision, the same on every lattice site */
+struct LBCollisionPar
+{
+    real gamma[4];      // relaxation of bulk, shear, odd and even modes
+    real invB[19];      // back-transformation weights
+    real eqWeight[19];  // equilibrium weights
+    real phi[19];       // amplitudes of the fluctuations
+    real aOverTau;      // lattice spacing over timestep
+    bool extForce;      // there are forces on the sites
+    bool fluct;         // add thermal fluctuations
+};
+
+class LBLattice
+{
+    /**
+     * \brief Populations of the local LB lattice (including the halo) as structure of arrays
+     *
+     * The populations of one velocity direction are stored contiguously for all sites, with
+     * the z index running fastest. Every direction starts on a SIMD boundary, see
+     * vec/include/simdconfig.hpp, so that the collide-stream kernel can process a row of
+     * sites along z with vector instructions.
+     *
+     * Only the D3Q19 model is implemented by the collide-stream kernel.
+     */
+public:
+    LBLattice(Int3D _size, int _numVels);
+
+    const Int3D& getSize() const { return size; }
+    int getNumVels() const { return numVels; }
+
+    size_t index(int _i, int _j, int _k) const
+    {
+        return (size_t(_i) * size[1] + _j) * size[2] + _k;
+    }
+
+    real getF_i(int _i, int _j, int _k, int _l) const
+    {
+        return f[_l * stride + index(_i, _j, _k)];
+    }
+    void setF_i(int _i, int _j, int _k, int _l, real _f)
+    {
+        f[_l * stride + index(_i, _j, _k)] = _f;
+    }
+
+    real* pops(int _l) { return &f[_l * stride]; }
+    const real* pops(int _l) const { return &f[_l * stride]; }
+
+    /** Collide the sites _k0 <= k < _k1 of the row (_i, _j) and push the post-collision
+        populations to the neighbouring sites of _dst. The force components are indexed
+        by k - _k0 and have to be zero without forces, rnd holds 15 uniform random
+        numbers per site in the same order (only read if par.fluct). */
+    void collideStreamRow(LBLattice& _dst,
+                          int _i,
+                          int _j,
+                          int _k0,
+                          int _k1,
+                          const LBCollisionPar& par,
+                          const real* fx,
+                          const real* fy,
+                          const real* fz,
+                          const real* rnd) const;
+
+private:
+    Int3D size;
+    int numVels;
+    size_t stride;  // padded number of sites per direction
+    vec::AlignedVector<real> f;
+};
+}  // namespace integrator
+}  // namespace espressopp
+
+#endif
@@ -107,6 +107,13 @@ real LangevinBarostat::getPressure() { return externalPressure; }
 void LangevinBarostat::setMass(real _mass) { mass = _mass; }
 real LangevinBarostat::getMass() { return mass; }
 
+void LangevinBarostat::setMomentum(real _momentum)
+{
+    momentum = _momentum;
+    momentum_mass = momentum / mass;
+}
+real LangevinBarostat::getMomentum() { return momentum; }
+
 //
 void LangevinBarostat::setMassByFrequency(real freq)
 {
@@ -306,6 +313,8 @@ void LangevinBarostat::registerPython()
             .add_property("pressure", &LangevinBarostat::getPressure,
                           &LangevinBarostat::setPressure)
             .add_property("mass", &LangevinBarostat::getMass, &LangevinBarostat::setMass)
+            .add_property("momentum", &LangevinBarostat::getMomentum,
+                          &LangevinBarostat::setMomentum)
 
             .def("setMassByFrequency", &LangevinBarostat::setMassByFrequency)
 
@@ -55,6 +55,10 @@ public:
 
     void setMassByFrequency(real);
 
+    /// momentum of the volume, the internal state of the barostat
+    void setMomentum(real);
+    real getMomentum();
+
     virtual ~LangevinBarostat();
 
     /** Register this class so it can be used from Python. */
@@ -96,6 +96,11 @@ Properties:
 
     The property 'mass' defines the fictitious mass :math:`W`.
 
+*   *langevinP.momentum*
+
+    The momentum :math:`p_{\epsilon}` of the volume, zero at the start. It is the
+    internal state of the barostat and can be stored with a checkpoint.
+
 Methods:
 
 *   *setMassByFrequency( frequency )*
@@ -183,6 +188,6 @@ if pmi.isController :
     class LangevinBarostat(Extension, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
           cls =  'espressopp.integrator.LangevinBarostatLocal',
-          pmiproperty = [ 'gammaP', 'pressure', 'mass' ],
+          pmiproperty = [ 'gammaP', 'pressure', 'mass', 'momentum' ],
           pmicall = [ "setMassByFrequency" ]
         )
@@ -49,6 +49,15 @@ namespace integrator
 {
 LOG4ESPP_LOGGER(LatticeBoltzmann::theLogger, "LatticeBoltzmann");
 
+namespace
+{
+// populations crossing a plane normal to x, y, z in positive (0) and negative (1) direction
+int const numPopTransf = 5;
+int const haloPops[3][2][numPopTransf] = {{{1, 7, 9, 11, 13}, {2, 8, 10, 12, 14}},
+                                          {{3, 7, 10, 15, 17}, {4, 8, 9, 16, 18}},
+                                          {{5, 11, 14, 15, 18}, {6, 12, 13, 16, 17}}};
+}  // namespace
+
 /* LB Constructor; expects 1 Int3D, 2 reals and 2 integers */
 LatticeBoltzmann::LatticeBoltzmann(std::shared_ptr<System> _system,
                                    Int3D _nodeGrid,
@@ -88,6 +97,7 @@ LatticeBoltzmann::LatticeBoltzmann(std::shared_ptr<System> _system,
     setNSteps(1);          // # MD steps between LB update
     setPrevDumpStep(0);    // interval between dumping coupl-files
     setProfStep(10000);    // set default time profiling step
+    setOverlapHalo(true);  // hide the halo exchange behind the interior
 
     /* find total number of MD particles*/
     int _Npart = _system->storage->getNRealParticles();
@@ -122,13 +132,8 @@ LatticeBoltzmann::LatticeBoltzmann(std::shared_ptr<System> _system,
     /* initialise global weights and coefficients from the local ones */
     initLatticeModel();
 
-    // reset timers
-    colstream.reset();
-    comm.reset();
-    swapping.reset();
-    time_colstr = 0.;
-    time_comm = 0.;
-    time_sw = 0.;
+    numHaloReq = 0;
+    resetTimers();
 }
 
 /*******************************************************************************************/
@@ -311,19 +316,41 @@ void LatticeBoltzmann::addFOnPart(int _id, Real3D _fOnPart) { fOnPart[_id] += _f
 
 void LatticeBoltzmann::keepLBDump() { setPrevDumpStep(0); }
 
+/* TIMERS OF THE COLLIDE-STREAM STEP */
+void LatticeBoltzmann::resetTimers()
+{
+    colstream.reset();
+    comm.reset();
+    swapping.reset();
+    time_colstr = 0.;
+    time_comm = 0.;
+    time_wait = 0.;
+    time_sw = 0.;
+    lbSteps = 0;
+}
+
+void LatticeBoltzmann::loadTimers(real* _t)
+{
+    _t[0] = time_colstr;
+    _t[1] = time_comm;
+    _t[2] = time_wait;
+    _t[3] = time_sw;
+    _t[4] = lbSteps;
+}
+
 /* Setter and getter for access to population values */
 void LatticeBoltzmann::setPops(Int3D _Ni, int _l, real _value)
 {
-    (*lbfluid)[_Ni[0]][_Ni[1]][_Ni[2]].setF_i(_l, _value);
+    lbfluid->setF_i(_Ni[0], _Ni[1], _Ni[2], _l, _value);
 }
 real LatticeBoltzmann::getPops(Int3D _Ni, int _l)
 {
-    return (*lbfluid)[_Ni[0]][_Ni[1]][_Ni[2]].getF_i(_l);
+    return lbfluid->getF_i(_Ni[0], _Ni[1], _Ni[2], _l);
 }
 
 void LatticeBoltzmann::setGhostFluid(Int3D _Ni, int _l, real _value)
 {
-    (*ghostlat)[_Ni[0]][_Ni[1]][_Ni[2]].setF_i(_l, _value);
+    ghostlat->setF_i(_Ni[0], _Ni[1], _Ni[2], _l, _value);
 }
 
 void LatticeBoltzmann::setLBMom(Int3D _Ni, int _l, real _value)
@@ -348,6 +375,8 @@ real LatticeBoltzmann::convLenMDtoLB()
 /* Profiling definitions */
 void LatticeBoltzmann::setProfStep(int _profStep) { profStep = _profStep; }
 int LatticeBoltzmann::getProfStep() { return profStep; }
+void LatticeBoltzmann::setOverlapHalo(bool _overlapHalo) { overlapHalo = _overlapHalo; }
+bool LatticeBoltzmann::getOverlapHalo() { return overlapHalo; }
 
 /* Setter and getter for simulation parameters */
 void LatticeBoltzmann::setStepNum(int _step) { stepNum = _step; }
@@ -366,27 +395,23 @@ void LatticeBoltzmann::initLatticeSize()
 {
     Int3D _numSites = getMyNi();
 
+    /* populations are kept as structure of arrays */
+    lbfluid = new LBLattice(_numSites, getNumVels());
+    ghostlat = new LBLattice(_numSites, getNumVels());
+
     /* stretch lattices resizing them in 3 dimensions */
-    lbfluid = new lblattice;
-    ghostlat = new lblattice;
     lbmom = new lbmoments;
     lbfor = new lbforces;
 
-    (*lbfluid).resize(_numSites[0]);
-    (*ghostlat).resize(_numSites[0]);
     (*lbmom).resize(_numSites[0]);
     (*lbfor).resize(_numSites[0]);
 
     for (int i = 0; i < _numSites[0]; i++)
     {
-        (*lbfluid)[i].resize(_numSites[1]);
-        (*ghostlat)[i].resize(_numSites[1]);
         (*lbmom)[i].resize(_numSites[1]);
         (*lbfor)[i].resize(_numSites[1]);
         for (int j = 0; j < _numSites[1]; j++)
         {
-            (*lbfluid)[i][j].resize(_numSites[2]);
-            (*ghostlat)[i][j].resize(_numSites[2]);
             (*lbmom)[i][j].resize(_numSites[2]);
             (*lbfor)[i][j].resize(_numSites[2]);
         }
@@ -511,22 +536,6 @@ void LatticeBoltzmann::initFluctuations()
             setPhi(l, sqrt(mu / getInvB(l)));
         }
 
-        // set phi on every lattice site
-        Int3D _Ni = getMyNi();
-        for (int i = 0; i < _Ni[0]; i++)
-        {
-            for (int j = 0; j < _Ni[1]; j++)
-            {
-                for (int k = 0; k < _Ni[2]; k++)
-                {
-                    for (int l = 0; l < getNumVels(); l++)
-                    {
-                        (*lbfluid)[i][j][k].setPhiLoc(l, getPhi(l));
-                    }
-                }
-            }
-        }
-
         if (_myRank == 0)
         {
             std::cout << "The amplitudes phi_i of the fluctuations have been redefined.\n";
@@ -558,17 +567,13 @@ void LatticeBoltzmann::makeLBStep()
         collideStream();
     }
 
-    if (_stepNum % _profStep == 0 && _stepNum != 0)
+    if (_stepNum % _profStep == 0 && _stepNum != 0 && lbSteps > 0)
     {
-        printf("CPU %d: colstr took %f sec, comm % f, swapping %f\n", getSystem()->comm->rank(),
-               time_colstr, time_comm, time_sw);
-
-        colstream.reset();
-        comm.reset();
-        swapping.reset();
-        time_colstr = 0.;
-        time_comm = 0.;
-        time_sw = 0.;
+        printf(
+            "CPU %d: per LB step colstr took %f sec, comm %f (waiting %f), swapping %f "
+            "(%d steps)\n",
+            getSystem()->comm->rank(), time_colstr / lbSteps, time_comm / lbSteps,
+            time_wait / lbSteps, time_sw / lbSteps, lbSteps);
     }
 }
 
@@ -616,8 +621,6 @@ void LatticeBoltzmann::makeDecompose()
 void LatticeBoltzmann::collideStream()
 {
     int _offset = getHaloSkin();
-    bool _extForce = doExtForce();
-    bool _fluct = doFluct();
     bool _coupling = doCoupling();
     Int3D _myNi = getMyNi();
 
@@ -627,32 +630,69 @@ void LatticeBoltzmann::collideStream()
         copyForcesFromHalo();
     }
 
-    // collision-streaming //
-    real timer = colstream.getElapsedTime();
-    for (int i = _offset; i < _myNi[0] - _offset; i++)
+    // the outer shell of the real region is collided first, as its populations are pushed
+    // into the halo. The halo exchange along x, y and z is then overlapped with the
+    // collision of the interior, a third of it per axis //
+    Int3D _lo = Int3D(_offset), _hi = _myNi - Int3D(_offset);
+    Int3D _inLo = _lo + Int3D(1), _inHi = _hi - Int3D(1);
+    real timer;
+    if (!getOverlapHalo() || _inLo[0] >= _inHi[0] || _inLo[1] >= _inHi[1] ||
+        _inLo[2] >= _inHi[2])
     {
-        for (int j = _offset; j < _myNi[1] - _offset; j++)
+        // no interior to hide the communication behind, or the overlap is switched off
+        timer = colstream.getElapsedTime();
+        collideStreamBox(_lo, _hi);
+        time_colstr += (colstream.getElapsedTime() - timer);
+
+        timer = comm.getElapsedTime();
+        commHalo();
+        time_comm += (comm.getElapsedTime() - timer);
+    }
+    else
+    {
+        timer = colstream.getElapsedTime();
+        for (int d = 0; d < 3; d++)
         {
-            for (int k = _offset; k < _myNi[2] - _offset; k++)
+            for (int _side = 0; _side < 2; _side++)
             {
-                Real3D _f =
-                    (*lbfor)[i][j][k].getExtForceLoc() + (*lbfor)[i][j][k].getCouplForceLoc();
-
-                (*lbfluid)[i][j][k].collision(_fluct, _extForce, _coupling, _f, gamma);
-                streaming(i, j, k);
+                Int3D _bLo = _lo, _bHi = _hi;
+                for (int e = 0; e < d; e++)
+                {
+                    _bLo[e] = _inLo[e];
+                    _bHi[e] = _inHi[e];
+                }
+                if (_side == 0)
+                    _bHi[d] = _inLo[d];
+                else
+                    _bLo[d] = _inHi[d];
+                collideStreamBox(_bLo, _bHi);
             }
         }
-    }
-    time_colstr += (colstream.getElapsedTime() - timer);
+        time_colstr += (colstream.getElapsedTime() - timer);
+
+        for (int _dir = 0; _dir < 3; _dir++)
+        {
+            timer = comm.getElapsedTime();
+            startHaloComm(_dir);
+            time_comm += (comm.getElapsedTime() - timer);
+
+            Int3D _sLo = _inLo, _sHi = _inHi;
+            _sLo[0] = _inLo[0] + _dir * (_inHi[0] - _inLo[0]) / 3;
+            _sHi[0] = _inLo[0] + (_dir + 1) * (_inHi[0] - _inLo[0]) / 3;
+            timer = colstream.getElapsedTime();
+            collideStreamBox(_sLo, _sHi);
+            time_colstr += (colstream.getElapsedTime() - timer);
 
-    // halo communication //
-    timer = comm.getElapsedTime();
-    commHalo();
-    time_comm += (comm.getElapsedTime() - timer);
+            timer = comm.getElapsedTime();
+            finishHaloComm(_dir);
+            time_comm += (comm.getElapsedTime() - timer);
+        }
+    }
+    ++lbSteps;
 
     /* swapping of the pointers to the lattices */
     timer = swapping.getElapsedTime();
-    lblattice* tmp = lbfluid;
+    LBLattice* tmp = lbfluid;
     lbfluid = ghostlat;
     ghostlat = tmp;
     time_sw += (swapping.getElapsedTime() - timer);
@@ -681,42 +721,53 @@ void LatticeBoltzmann::collideStream()
 
 /*******************************************************************************************/
 
-/* STREAMING ALONG THE VELOCITY VECTORS. SERIAL */
-// periodic boundaries are handled separately in commHalo() //
-void LatticeBoltzmann::streaming(int _i, int _j, int _k)
+/* FUSED COLLISION AND STREAMING ALONG THE VELOCITY VECTORS. SERIAL */
+// the populations are pushed from lbfluid to ghostlat, the ones leaving the real region
+// land in the halo of ghostlat and are handled in commHalo() //
+void LatticeBoltzmann::collideStreamBox(Int3D _lo, Int3D _hi)
 {
-    // assign iterations
-    int _ip = _i + 1;
-    int _im = _i - 1;
-    int _jp = _j + 1;
-    int _jm = _j - 1;
-    int _kp = _k + 1;
-    int _km = _k - 1;
-
-    // do not move the staying populations
-    (*ghostlat)[_i][_j][_k].setF_i(0, (*lbfluid)[_i][_j][_k].getF_i(0));
-
-    // move populations to the nearest neighbors
-    (*ghostlat)[_ip][_j][_k].setF_i(1, (*lbfluid)[_i][_j][_k].getF_i(1));
-    (*ghostlat)[_im][_j][_k].setF_i(2, (*lbfluid)[_i][_j][_k].getF_i(2));
-    (*ghostlat)[_i][_jp][_k].setF_i(3, (*lbfluid)[_i][_j][_k].getF_i(3));
-    (*ghostlat)[_i][_jm][_k].setF_i(4, (*lbfluid)[_i][_j][_k].getF_i(4));
-    (*ghostlat)[_i][_j][_kp].setF_i(5, (*lbfluid)[_i][_j][_k].getF_i(5));
-    (*ghostlat)[_i][_j][_km].setF_i(6, (*lbfluid)[_i][_j][_k].getF_i(6));
-
-    // move populations to the next-to-the-nearest neighbors
-    (*ghostlat)[_ip][_jp][_k].setF_i(7, (*lbfluid)[_i][_j][_k].getF_i(7));
-    (*ghostlat)[_im][_jm][_k].setF_i(8, (*lbfluid)[_i][_j][_k].getF_i(8));
-    (*ghostlat)[_ip][_jm][_k].setF_i(9, (*lbfluid)[_i][_j][_k].getF_i(9));
-    (*ghostlat)[_im][_jp][_k].setF_i(10, (*lbfluid)[_i][_j][_k].getF_i(10));
-    (*ghostlat)[_ip][_j][_kp].setF_i(11, (*lbfluid)[_i][_j][_k].getF_i(11));
-    (*ghostlat)[_im][_j][_km].setF_i(12, (*lbfluid)[_i][_j][_k].getF_i(12));
-    (*ghostlat)[_ip][_j][_km].setF_i(13, (*lbfluid)[_i][_j][_k].getF_i(13));
-    (*ghostlat)[_im][_j][_kp].setF_i(14, (*lbfluid)[_i][_j][_k].getF_i(14));
-    (*ghostlat)[_i][_jp][_kp].setF_i(15, (*lbfluid)[_i][_j][_k].getF_i(15));
-    (*ghostlat)[_i][_jm][_km].setF_i(16, (*lbfluid)[_i][_j][_k].getF_i(16));
-    (*ghostlat)[_i][_jp][_km].setF_i(17, (*lbfluid)[_i][_j][_k].getF_i(17));
-    (*ghostlat)[_i][_jm][_kp].setF_i(18, (*lbfluid)[_i][_j][_k].getF_i(18));
+    int _numVels = getNumVels();
+
+    collPar.extForce = doExtForce();
+    collPar.fluct = doFluct();
+    collPar.aOverTau = LatticePar::getALoc() / LatticePar::getTauLoc();
+    for (int i = 0; i < 4; i++) collPar.gamma[i] = getGamma(i);
+    for (int l = 0; l < _numVels; l++)
+    {
+        collPar.invB[l] = LatticePar::getInvBLoc(l);
+        collPar.eqWeight[l] = LatticePar::getEqWeightLoc(l);
+        collPar.phi[l] = getPhi(l);
+    }
+
+    int _rowLen = _hi[2] - _lo[2];
+    if (_rowLen <= 0) return;
+    for (int d = 0; d < 3; d++) rowForce[d].assign(_rowLen, 0.);
+    rowRnd.resize(collPar.fluct ? 15 * _rowLen : 0);
+
+    for (int i = _lo[0]; i < _hi[0]; i++)
+    {
+        for (int j = _lo[1]; j < _hi[1]; j++)
+        {
+            // gather the forces of the row and draw its random numbers site by site
+            if (collPar.extForce)
+            {
+                for (int k = _lo[2]; k < _hi[2]; k++)
+                {
+                    Real3D _f =
+                        (*lbfor)[i][j][k].getExtForceLoc() + (*lbfor)[i][j][k].getCouplForceLoc();
+                    for (int d = 0; d < 3; d++) rowForce[d][k - _lo[2]] = _f[d];
+                }
+            }
+            if (collPar.fluct)
+            {
+                for (size_t r = 0; r < rowRnd.size(); r++) rowRnd[r] = (*rng)();
+            }
+
+            lbfluid->collideStreamRow(*ghostlat, i, j, _lo[2], _hi[2], collPar,
+                                      rowForce[0].data(), rowForce[1].data(), rowForce[2].data(),
+                                      rowRnd.data());
+        }
+    }
 }
 
 /*******************************************************************************************/
@@ -865,8 +916,9 @@ void LatticeBoltzmann::calcDenMom()
                 Real3D jLoc = Real3D(0.);
                 for (int l = 0; l < _numVels; l++)
                 {
-                    denLoc += (*lbfluid)[i][j][k].getF_i(l);
-                    jLoc += (*lbfluid)[i][j][k].getF_i(l) * getCi(l);
+                    real f_l = lbfluid->getF_i(i, j, k, l);
+                    denLoc += f_l;
+                    jLoc += f_l * getCi(l);
                 }
                 (*lbmom)[i][j][k].setMom_i(0, denLoc);
                 (*lbmom)[i][j][k].setMom_i(1, jLoc[0]);
@@ -1439,359 +1491,102 @@ Int3D LatticeBoltzmann::findGlobIdx()
 /* COMMUNICATE POPULATIONS IN HALO REGIONS TO THE NEIGHBOURING CPUs */
 void LatticeBoltzmann::commHalo()
 {
-    int i, j, k, idx;            // running indices
-    int const numPopTransf = 5;  // num of popul and hydro moms to be sent
-    int rnode, snode;            // CPU ranks to receive from and to send to
-    std::vector<real> bufToSend, bufToRecv;
-
-    int _offset = getHaloSkin();
-    Int3D _myNi = getMyNi();
-    Int3D _myPos = getMyPos();
-
-    mpi::communicator world;
-
-    //////////////////////
-    //// X-direction /////
-    //////////////////////
-    int numDataTransf = numPopTransf * _myNi[1] * _myNi[2];
-    bufToSend.resize(numDataTransf);
-    bufToRecv.resize(numDataTransf);
-
-    /* send to right, recv from left i = 1, 7, 9, 11, 13 */
-    snode = getMyNeigh(1);
-    rnode = getMyNeigh(0);
-
-    // prepare message for sending
-    i = _myNi[0] - _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(1);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(7);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(9);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(11);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(13);
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_0, bufToSend);
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-            world.send(snode, COMM_DIR_0, bufToSend);
-        }
-    }
-    else
+    // the axes have to be done one after the other, as the halo planes of the later axes
+    // carry the edge populations received along the earlier ones //
+    for (int _dir = 0; _dir < 3; _dir++)
     {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    i = _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(1, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(7, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(9, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(11, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(13, bufToRecv[idx + 4]);
-        }
-    }
-
-    /* send to left, recv from right i = 2, 8, 10, 12, 14 */
-    snode = getMyNeigh(0);
-    rnode = getMyNeigh(1);
-
-    // prepare message for sending
-    i = 0;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(2);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(8);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(10);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(12);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(14);
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_1, bufToSend);
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-            world.send(snode, COMM_DIR_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    i = _myNi[0] - 2 * _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(2, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(8, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(10, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(12, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(14, bufToRecv[idx + 4]);
-        }
-    }
-
-    //////////////////////
-    //// Y-direction /////
-    //////////////////////
-    numDataTransf = numPopTransf * _myNi[0] * _myNi[2];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left i = 3, 7, 10, 15, 17 */
-    snode = getMyNeigh(3);
-    rnode = getMyNeigh(2);
-
-    // prepare message for sending
-    j = _myNi[1] - _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(3);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(7);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(10);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(15);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(17);
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
-    {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_0, bufToSend);
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-            world.send(snode, COMM_DIR_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    j = _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(3, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(7, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(10, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(15, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(17, bufToRecv[idx + 4]);
-        }
+        startHaloComm(_dir);
+        finishHaloComm(_dir);
     }
+}
 
-    /* send to left, recv from right i = 4, 8, 9, 16, 18 */
-    snode = getMyNeigh(2);
-    rnode = getMyNeigh(3);
+/*******************************************************************************************/
 
-    // prepare message for sending
-    j = 0;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(4);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(8);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(9);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(16);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(18);
-        }
-    }
+/* PACK THE POPULATIONS IN THE HALO PLANES OF AXIS _dir AND POST THEIR EXCHANGE */
+void LatticeBoltzmann::startHaloComm(int _dir)
+{
+    int _offset = getHaloSkin();
+    Int3D _myNi = getMyNi();
+    int u = (_dir == 0) ? 1 : 0;  // axes spanning the plane
+    int v = (_dir == 2) ? 1 : 2;
+    int _planeSize = _myNi[u] * _myNi[v];
+    int numDataTransf = numPopTransf * _planeSize;
 
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
+    // side 0: populations in the right halo plane are sent to the right neighbour,
+    // side 1: populations in the left halo plane are sent to the left neighbour
+    for (int _side = 0; _side < 2; _side++)
     {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_1, bufToSend);
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-            world.send(snode, COMM_DIR_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+        haloSend[_side].resize(numDataTransf);
+        haloRecv[_side].resize(numDataTransf);
 
-    // unpack message
-    j = _myNi[1] - 2 * _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
+        Int3D _idx(0);
+        _idx[_dir] = (_side == 0) ? _myNi[_dir] - _offset : 0;
+        int idx = 0;
+        for (int p = 0; p < numPopTransf; p++)
         {
-            (*ghostlat)[i][j][k].setF_i(4, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(8, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(9, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(16, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(18, bufToRecv[idx + 4]);
-        }
-    }
-
-    //////////////////////
-    //// Z-direction /////
-    //////////////////////
-    numDataTransf = numPopTransf * _myNi[0] * _myNi[1];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left i = 5, 11, 14, 15, 18 */
-    snode = getMyNeigh(5);
-    rnode = getMyNeigh(4);
-
-    // prepare message for sending
-    k = _myNi[2] - _offset;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(5);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(11);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(14);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(15);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(18);
+            int _l = haloPops[_dir][_side][p];
+            for (_idx[u] = 0; _idx[u] < _myNi[u]; _idx[u]++)
+            {
+                for (_idx[v] = 0; _idx[v] < _myNi[v]; _idx[v]++, idx++)
+                {
+                    haloSend[_side][idx] = ghostlat->getF_i(_idx[0], _idx[1], _idx[2], _l);
+                }
+            }
         }
     }
 
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
+    // post the messages or just swap the buffers if there is one CPU along _dir
+    numHaloReq = 0;
+    if (getNodeGrid().getItem(_dir) > 1)
     {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_0, bufToSend);
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-            world.send(snode, COMM_DIR_0, bufToSend);
-        }
+        mpi::communicator& _comm = *getSystem()->comm;
+        int _left = getMyNeigh(2 * _dir);
+        int _right = getMyNeigh(2 * _dir + 1);
+        haloReq[numHaloReq++] = _comm.irecv(_left, COMM_DIR_0, haloRecv[0].data(), numDataTransf);
+        haloReq[numHaloReq++] = _comm.irecv(_right, COMM_DIR_1, haloRecv[1].data(), numDataTransf);
+        haloReq[numHaloReq++] = _comm.isend(_right, COMM_DIR_0, haloSend[0].data(), numDataTransf);
+        haloReq[numHaloReq++] = _comm.isend(_left, COMM_DIR_1, haloSend[1].data(), numDataTransf);
     }
     else
     {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    k = _offset;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(5, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(11, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(14, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(15, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(18, bufToRecv[idx + 4]);
-        }
+        haloRecv[0].swap(haloSend[0]);
+        haloRecv[1].swap(haloSend[1]);
     }
+}
 
-    /* send to left, recv from right i = 6, 12, 13, 16, 17 */
-    snode = getMyNeigh(4);
-    rnode = getMyNeigh(5);
+/*******************************************************************************************/
 
-    // prepare message for sending
-    k = 0;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(6);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(12);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(13);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(16);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(17);
-        }
-    }
+/* WAIT FOR THE EXCHANGE ALONG AXIS _dir AND UNPACK THE POPULATIONS INTO THE REAL PLANES */
+void LatticeBoltzmann::finishHaloComm(int _dir)
+{
+    int _offset = getHaloSkin();
+    Int3D _myNi = getMyNi();
+    int u = (_dir == 0) ? 1 : 0;
+    int v = (_dir == 2) ? 1 : 2;
 
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_1, bufToSend);
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-            world.send(snode, COMM_DIR_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+    real timer = comm.getElapsedTime();
+    mpi::wait_all(haloReq, haloReq + numHaloReq);
+    numHaloReq = 0;
+    time_wait += (comm.getElapsedTime() - timer);
 
-    // unpack message
-    k = _myNi[2] - 2 * _offset;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
+    // what came from the left goes to the first real plane, from the right to the last one
+    for (int _side = 0; _side < 2; _side++)
     {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
+        Int3D _idx(0);
+        _idx[_dir] = (_side == 0) ? _offset : _myNi[_dir] - 2 * _offset;
+        int idx = 0;
+        for (int p = 0; p < numPopTransf; p++)
         {
-            (*ghostlat)[i][j][k].setF_i(6, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(12, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(13, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(16, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(17, bufToRecv[idx + 4]);
+            int _l = haloPops[_dir][_side][p];
+            for (_idx[u] = 0; _idx[u] < _myNi[u]; _idx[u]++)
+            {
+                for (_idx[v] = 0; _idx[v] < _myNi[v]; _idx[v]++, idx++)
+                {
+                    ghostlat->setF_i(_idx[0], _idx[1], _idx[2], _l, haloRecv[_side][idx]);
+                }
+            }
         }
     }
-
-    // release buffers
-    bufToSend.resize(0);
-    bufToRecv.resize(0);
 }
 
 /*******************************************************************************************/
@@ -2499,6 +2294,13 @@ LatticeBoltzmann::~LatticeBoltzmann() { disconnect(); }
 
 /*******************************************************************************************/
 
+static python::object wrapGetTimers(LatticeBoltzmann* obj)
+{
+    real tms[5];
+    obj->loadTimers(tms);
+    return python::make_tuple(tms[0], tms[1], tms[2], tms[3], int(tms[4]));
+}
+
 void LatticeBoltzmann::registerPython()
 {
     using namespace espressopp::python;
@@ -2526,11 +2328,15 @@ void LatticeBoltzmann::registerPython()
             .add_property("nSteps", &LatticeBoltzmann::getNSteps, &LatticeBoltzmann::setNSteps)
             .add_property("profStep", &LatticeBoltzmann::getProfStep,
                           &LatticeBoltzmann::setProfStep)
+            .add_property("overlapHalo", &LatticeBoltzmann::getOverlapHalo,
+                          &LatticeBoltzmann::setOverlapHalo)
             .add_property("getMyNi", &LatticeBoltzmann::getMyNi)
             .def("getLBMom", &LatticeBoltzmann::getLBMom)
             .def("setLBMom", &LatticeBoltzmann::setLBMom)
             .def("saveLBConf", &LatticeBoltzmann::saveLBConf)
             .def("keepLBDump", &LatticeBoltzmann::keepLBDump)
+            .def("resetTimers", &LatticeBoltzmann::resetTimers)
+            .def("getTimers", &wrapGetTimers)
             .def("connect", &LatticeBoltzmann::connect)
             .def("disconnect", &LatticeBoltzmann::disconnect);
 }
@@ -31,8 +31,8 @@
 #include "Real3D.hpp"
 #include "Int3D.hpp"
 #include "LatticeSite.hpp"
+#include "LBLattice.hpp"
 
-typedef std::vector<std::vector<std::vector<espressopp::integrator::LBSite> > > lblattice;
 typedef std::vector<std::vector<std::vector<espressopp::integrator::LBMom> > > lbmoments;
 typedef std::vector<std::vector<std::vector<espressopp::integrator::LBForce> > > lbforces;
 
@@ -197,6 +197,11 @@ public:
     // profiling interface //
     void setProfStep(int _profStep);  // set profiling interval
     int getProfStep();
+    void setOverlapHalo(bool _overlapHalo);  // overlap the halo exchange with the collision
+    bool getOverlapHalo();
+    void resetTimers();
+    // collide-stream, halo communication (and of it waiting), swapping, # of steps
+    void loadTimers(real* _t);
 
     // simulation parameters control //
     void setStepNum(int _step);  // current step number
@@ -233,13 +238,16 @@ public:
 
     void collideStream();  // use collide-stream scheme
 
-    void streaming(int _i, int _j, int _k);  // streaming along velocities
+    // fused collision and streaming of the sites lo <= (i,j,k) < hi
+    void collideStreamBox(Int3D _lo, Int3D _hi);
 
     /* MPI FUNCTIONS */
     void findMyNeighbours();
     void assignMyLattice();
     Int3D findGlobIdx();        // find global index of first lb site of cpu
     void commHalo();            // communicate populations in halo
+    void startHaloComm(int _dir);   // pack halo planes of axis _dir and post the messages
+    void finishHaloComm(int _dir);  // wait for the messages of axis _dir and unpack them
     void copyForcesFromHalo();  // copy coupling forces from halo regions to the real lattice sites
     void copyDenMomToHalo();    // copy den and j from real lattice sites to halo
     void makeDecompose();  // decompose storage to put escaped real particles into neighbouring CPU
@@ -282,11 +290,20 @@ private:
     bool extForce;  // flag for an external force
 
     // LATTICES
-    lblattice* lbfluid;
-    lblattice* ghostlat;
+    LBLattice* lbfluid;
+    LBLattice* ghostlat;
     lbmoments* lbmom;
     lbforces* lbfor;
 
+    LBCollisionPar collPar;           // collision parameters of the current step
+    std::vector<real> rowForce[3];  // forces and random numbers of one row of sites
+    std::vector<real> rowRnd;
+
+    // halo exchange along one axis, to the right (0) and to the left (1)
+    std::vector<real> haloSend[2], haloRecv[2];
+    mpi::request haloReq[4];
+    int numHaloReq;
+
     // COUPLING
     bool coupling;                // flag for a coupling force
     int nSteps;                   // # of MD steps between LB update
@@ -310,8 +327,10 @@ private:
     // TIMERS
     esutil::WallTimer swapping, colstream, comm;
     esutil::WallTimer timeReadLBConf, timeSaveLBConf;
-    real time_sw, time_colstr, time_comm;
+    real time_sw, time_colstr, time_comm, time_wait;
+    int lbSteps;  // number of collide-stream steps since the last reset
     int profStep;  // profiling interval
+    bool overlapHalo;  // collide the interior while the halo is exchanged
 
     void connect();
     void disconnect();
@@ -239,6 +239,30 @@ LB/MD simulations. It is implemented as :py:class:`espressopp.integrator.Extensi
         >>> # set profiling frequency
         >>> lb.profStep = 5000
 
+        Every profStep steps each CPU prints the time per LB step spent in
+        collision-streaming, in the halo communication (and of it in waiting for
+        messages) and in swapping the lattices, averaged since the last resetTimers(). The halo exchange is overlapped with
+        the collision of the interior of the local lattice, so the waiting time is the
+        part of the communication that is not hidden.
+
+    .. py:data:: bool overlapHalo = True
+
+        Collide the interior of the local lattice while the halo is exchanged. If
+        False, the whole local lattice is collided before the halo exchange.
+
+    .. py:method:: getTimers()
+
+        Accumulated times of collision-streaming, halo communication, waiting for
+        messages and swapping, and the number of LB steps since the last reset, for
+        every CPU
+
+        :rtype: list of tuples (real, real, real, real, int)
+
+    .. py:method:: resetTimers()
+
+        Reset the timers. They are never reset otherwise, so getTimers() and the
+        profStep output accumulate over runs
+
     .. py:data:: Int3D getMyNi
 
         Number of real and halo nodes for the CPU
@@ -263,6 +287,7 @@ if pmi.isController :
     class LatticeBoltzmann(Extension, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
                             cls = 'espressopp.integrator.LatticeBoltzmannLocal',
-                            pmiproperty = ['nodeGrid', 'a', 'tau', 'numDims', 'numVels', 'visc_b', 'visc_s', 'gamma_b', 'gamma_s', 'gamma_odd', 'gamma_even', 'lbTemp', 'fricCoeff', 'nSteps', 'profStep', 'getMyNi'],
-                            pmicall = ["getLBMom","setLBMom","saveLBConf","keepLBDump"]
+                            pmiproperty = ['nodeGrid', 'a', 'tau', 'numDims', 'numVels', 'visc_b', 'visc_s', 'gamma_b', 'gamma_s', 'gamma_odd', 'gamma_even', 'lbTemp', 'fricCoeff', 'nSteps', 'profStep', 'overlapHalo', 'getMyNi'],
+                            pmicall = ["getLBMom","setLBMom","saveLBConf","keepLBDump","resetTimers"],
+                            pmiinvoke = ["getTimers"]
                             )
@@ -0,0 +1,124 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "LoadBalancer.hpp"
+
+#include <functional>
+#include "System.hpp"
+#include "storage/DomainDecomposition.hpp"
+#include "esutil/Error.hpp"
+
+namespace espressopp
+{
+namespace integrator
+{
+LOG4ESPP_LOGGER(LoadBalancer::theLogger, "LoadBalancer");
+
+LoadBalancer::LoadBalancer(std::shared_ptr<System> system, int _interval, real _threshold)
+    : Extension(system),
+      interval(_interval),
+      threshold(_threshold),
+      start(0.0),
+      cost(0.0),
+      steps(0),
+      imbalance(1.0),
+      numRebalances(0)
+{
+    LOG4ESPP_INFO(theLogger, "construct LoadBalancer");
+
+    dd = dynamic_cast<storage::DomainDecomposition*>(system->storage.get());
+    if (!dd)
+    {
+        esutil::Error err(system->comm);
+        err.setException("LoadBalancer needs a DomainDecomposition storage");
+        err.checkException();
+    }
+    timer.reset();
+}
+
+LoadBalancer::~LoadBalancer() { disconnect(); }
+
+void LoadBalancer::disconnect()
+{
+    _befCalcFLocal.disconnect();
+    _befWaitGhosts.disconnect();
+    _aftInitF.disconnect();
+    _aftCalcFLocal.disconnect();
+    _aftIntV.disconnect();
+}
+
+void LoadBalancer::connect()
+{
+    // the local force computation, without the ghost communication in which the
+    // fast CPUs wait for the slow ones. If the storage overlaps the ghost update with
+    // the forces of the real pairs, the wait lies between befWaitGhosts and aftInitF.
+    _befCalcFLocal =
+        integrator->befCalcFLocal.connect(std::bind(&LoadBalancer::startForces, this));
+    _befWaitGhosts =
+        integrator->befWaitGhosts.connect(std::bind(&LoadBalancer::stopForces, this));
+    _aftInitF = integrator->aftInitF.connect(std::bind(&LoadBalancer::startForces, this));
+    _aftCalcFLocal =
+        integrator->aftCalcFLocal.connect(std::bind(&LoadBalancer::stopForces, this));
+
+    // the particles may only move to other CPUs between the steps
+    _aftIntV = integrator->aftIntV.connect(std::bind(&LoadBalancer::balance, this));
+}
+
+void LoadBalancer::startForces() { start = timer.getElapsedTime(); }
+
+void LoadBalancer::stopForces() { cost += timer.getElapsedTime() - start; }
+
+void LoadBalancer::balance()
+{
+    if (++steps < interval) return;
+    steps = 0;
+
+    System& system = getSystemRef();
+    real maxCost, sumCost;
+    mpi::all_reduce(*system.comm, cost, maxCost, mpi::maximum<real>());
+    mpi::all_reduce(*system.comm, cost, sumCost, std::plus<real>());
+
+    imbalance = sumCost > 0.0 ? maxCost * system.comm->size() / sumCost : 1.0;
+    if (imbalance > threshold && dd->rebalance(cost))
+    {
+        numRebalances++;
+        LOG4ESPP_INFO(theLogger, "load imbalance " << imbalance << ", domains rebalanced");
+    }
+    cost = 0.0;
+}
+
+/****************************************************
+** REGISTRATION WITH PYTHON
+****************************************************/
+void LoadBalancer::registerPython()
+{
+    using namespace espressopp::python;
+    class_<LoadBalancer, std::shared_ptr<LoadBalancer>, bases<Extension> >(
+        "integrator_LoadBalancer", init<std::shared_ptr<System>, int, real>())
+        .add_property("interval", &LoadBalancer::getInterval, &LoadBalancer::setInterval)
+        .add_property("threshold", &LoadBalancer::getThreshold, &LoadBalancer::setThreshold)
+        .add_property("imbalance", &LoadBalancer::getImbalance)
+        .add_property("numRebalances", &LoadBalancer::getNumRebalances)
+        .def("connect", &LoadBalancer::connect)
+        .def("disconnect", &LoadBalancer::disconnect);
+}
+}  // namespace integrator
+}  // namespace espressopp
@@ -0,0 +1,91 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTEGRATOR_LOADBALANCER_HPP
+#define _INTEGRATOR_LOADBALANCER_HPP
+
+#include "types.hpp"
+#include "logging.hpp"
+#include "Extension.hpp"
+#include "esutil/Timer.hpp"
+#include "boost/signals2.hpp"
+
+namespace espressopp
+{
+namespace storage
+{
+class DomainDecomposition;
+}
+
+namespace integrator
+{
+/** Dynamic load balancing of a DomainDecomposition. The time every CPU spends on the
+    short range forces is measured, and every interval steps the node borders are
+    moved (DomainDecomposition::rebalance()) if the slowest CPU took longer than
+    threshold times the average.
+*/
+class LoadBalancer : public Extension
+{
+public:
+    LoadBalancer(std::shared_ptr<System> system, int interval, real threshold);
+    virtual ~LoadBalancer();
+
+    void setInterval(int _interval) { interval = _interval; }
+    int getInterval() { return interval; }
+    void setThreshold(real _threshold) { threshold = _threshold; }
+    real getThreshold() { return threshold; }
+
+    /// maximum over average force time of the last interval
+    real getImbalance() { return imbalance; }
+    /// how often the borders were moved
+    int getNumRebalances() { return numRebalances; }
+
+    /** Register this class so it can be used from Python. */
+    static void registerPython();
+
+private:
+    boost::signals2::connection _befCalcFLocal, _befWaitGhosts, _aftInitF, _aftCalcFLocal, _aftIntV;
+    void connect();
+    void disconnect();
+
+    void startForces();  // also after the wait for overlapped ghosts
+    void stopForces();   // also before that wait
+    void balance();
+
+    storage::DomainDecomposition* dd;
+    int interval;
+    real threshold;
+
+    esutil::WallTimer timer;
+    real start;
+    real cost;  // force time since the last balancing
+    int steps;
+
+    real imbalance;
+    int numRebalances;
+
+    /** Logger */
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+};
+}  // namespace integrator
+}  // namespace espressopp
+
+#endif
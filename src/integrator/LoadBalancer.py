@@ -0,0 +1,74 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+**********************************
+espressopp.integrator.LoadBalancer
+**********************************
+
+Dynamic load balancing for a DomainDecomposition storage. The time each CPU
+spends on the short range forces is measured. Every interval steps, if the
+slowest CPU took longer than threshold times the average, the domain borders
+are moved by whole cells so that every layer of CPUs along an axis gets the same
+share of the work, and the particles migrate to their new CPUs.
+
+The borders of the node layers are shared by all CPUs of a layer, so the node
+grid stays a (non-uniform) grid. A layer keeps at least halfCellInt cells.
+
+Example:
+
+>>> lb = espressopp.integrator.LoadBalancer(system, interval=500, threshold=1.1)
+>>> integrator.addExtension(lb)
+>>> integrator.run(10000)
+>>> print(lb.imbalance, lb.numRebalances, system.storage.getCellBorders())
+
+.. function:: espressopp.integrator.LoadBalancer(system, interval, threshold)
+
+                :param system: system object with a DomainDecomposition storage
+                :param interval: number of steps between two checks (default: 1000)
+                :param threshold: maximum over average force time above which the
+                                  borders are moved (default: 1.1)
+                :type interval: int
+                :type threshold: real
+
+.. attribute:: espressopp.integrator.LoadBalancer.imbalance
+
+                maximum over average force time of the last interval
+
+.. attribute:: espressopp.integrator.LoadBalancer.numRebalances
+
+                number of times the borders were moved
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.integrator.Extension import *
+from _espressopp import integrator_LoadBalancer
+
+class LoadBalancerLocal(ExtensionLocal, integrator_LoadBalancer):
+    def __init__(self, system, interval=1000, threshold=1.1):
+        if pmi.workerIsActive():
+            cxxinit(self, integrator_LoadBalancer, system, interval, threshold)
+
+if pmi.isController:
+    class LoadBalancer(Extension, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+          cls =  'espressopp.integrator.LoadBalancerLocal',
+          pmiproperty = [ 'interval', 'threshold', 'imbalance', 'numRebalances' ]
+        )
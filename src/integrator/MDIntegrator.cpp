@@ -23,6 +23,8 @@
 #include <python.hpp>
 #include "MDIntegrator.hpp"
 #include "System.hpp"
+#include "interaction/Interaction.hpp"
+#include "storage/Storage.hpp"
 
 namespace espressopp
 {
@@ -41,12 +43,28 @@ MDIntegrator::MDIntegrator(std::shared_ptr<System> system) : SystemAccess(system
     {
         LOG4ESPP_ERROR(theLogger, "system has no storage");
     }
+    else
+    {
+        // particles changed outside of run(), e.g. by decompose(), scaleVolume() or
+        // modifyParticle()
+        auto invalidate = std::bind(&MDIntegrator::invalidateTallies, this);
+        _onParticlesChanged = system->storage->onParticlesChanged.connect(invalidate);
+        _onParticlesModified = system->storage->onParticlesModified.connect(invalidate);
+        _onCellAdjust = system->storage->onCellAdjust.connect(invalidate);
+    }
     timeFlag = true;
     step = 0;
     dt = 0.005;
+    tally = false;
 }
 
-MDIntegrator::~MDIntegrator() { LOG4ESPP_INFO(theLogger, "~Integrator"); }
+MDIntegrator::~MDIntegrator()
+{
+    LOG4ESPP_INFO(theLogger, "~Integrator");
+    _onParticlesChanged.disconnect();
+    _onParticlesModified.disconnect();
+    _onCellAdjust.disconnect();
+}
 
 void MDIntegrator::setTimeStep(real _dt)
 {
@@ -87,6 +105,18 @@ int MDIntegrator::getNumberOfExtensions() { return exList.size(); }
 
 std::shared_ptr<integrator::Extension> MDIntegrator::getExtension(int k) { return exList[k]; }
 
+void MDIntegrator::requestTallies()
+{
+    const interaction::InteractionList& srIL = getSystemRef().shortRangeInteractions;
+    for (size_t i = 0; i < srIL.size(); i++) srIL[i]->requestTally();
+}
+
+void MDIntegrator::invalidateTallies()
+{
+    const interaction::InteractionList& srIL = getSystemRef().shortRangeInteractions;
+    for (size_t i = 0; i < srIL.size(); i++) srIL[i]->invalidateTally();
+}
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -99,6 +129,7 @@ void MDIntegrator::registerPython()
     class_<MDIntegrator, boost::noncopyable>("integrator_MDIntegrator", no_init)
         .add_property("dt", &MDIntegrator::getTimeStep, &MDIntegrator::setTimeStep)
         .add_property("step", &MDIntegrator::getStep, &MDIntegrator::setStep)
+        .add_property("tally", &MDIntegrator::getTally, &MDIntegrator::setTally)
         .add_property("system", &SystemAccess::getSystem)
         .def("run", &MDIntegrator::run)
         .def("addExtension", &MDIntegrator::addExtension)
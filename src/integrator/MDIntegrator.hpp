@@ -83,6 +83,18 @@ public:
 
     int getNumberOfExtensions();
 
+    /** Tally mode: the force pass of the last step of run() and of the steps
+        sampled by ExtAnalyze also sums up the energy and virial of the
+        interactions, which PotentialEnergy, Pressure and PressureTensor read
+        instead of passes of their own. */
+    void setTally(bool _tally) { tally = _tally; }
+    bool getTally() const { return tally; }
+
+    /// the next force pass tallies the energy and virial of all interactions
+    void requestTallies();
+    /// the particles move, the tallies of all interactions are outdated
+    void invalidateTallies();
+
     // signals to extend the integrator
     boost::signals2::signal<void()> runInit;  // initialization of run()
     boost::signals2::signal<void()> recalc1;  // inside recalc, before updateForces()
@@ -92,7 +104,10 @@ public:
     boost::signals2::signal<void()> befIntP;      // before integrate1()
     boost::signals2::signal<void(real&)> inIntP;  // inside end of integrate1()
     boost::signals2::signal<void()> aftIntP;      // after  integrate1()
-    boost::signals2::signal<void()> aftInitF;     // after initForces()
+    boost::signals2::signal<void()> befCalcFLocal;  // after initForces(), before aftInitF
+    boost::signals2::signal<void()> aftInitF;       // after initForces() and the ghost update
+    boost::signals2::signal<void()>
+        befWaitGhosts;  // before waiting for a ghost update that overlaps the forces
     boost::signals2::signal<void()>
         aftCalcFLocal;  // after calcForces in local cells (before collectGhostForces)
     boost::signals2::signal<void()> aftCalcF;    // after calcForces()
@@ -111,6 +126,9 @@ protected:
     /** Integration step */
     long long step;
 
+    bool tally;
+    boost::signals2::connection _onParticlesChanged, _onParticlesModified, _onCellAdjust;
+
     /** Timestep used for integration */
     real dt;
 
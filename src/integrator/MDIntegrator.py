@@ -47,6 +47,19 @@ espressopp.integrator.MDIntegrator
                 :param niter:
                 :type niter:
                 :rtype:
+
+.. attribute:: espressopp.integrator.MDIntegrator.tally
+
+                Tally mode (default: False). The force pass of the last step of
+                run() and of the steps sampled by ExtAnalyze also sums up the
+                energy and virial tensor of the Verlet list interactions.
+                PotentialEnergy, Pressure and PressureTensor then read these
+                instead of looping over the pairs again, as long as the particles
+                have not moved.
+
+                >>> integrator.tally = True
+                >>> integrator.run(10)
+                >>> P = espressopp.analysis.Pressure(system).compute()
 """
 from espressopp import pmi
 from _espressopp import integrator_MDIntegrator
@@ -82,6 +95,6 @@ class MDIntegratorLocal(object):
 if pmi.isController :
     class MDIntegrator(metaclass=pmi.Proxy):
         pmiproxydefs = dict(
-            pmiproperty = [ 'dt', 'step' ],
+            pmiproperty = [ 'dt', 'step', 'tally' ],
             pmicall = [ 'run', 'addExtension', 'getExtension', 'getNumberOfExtensions' ]
             )
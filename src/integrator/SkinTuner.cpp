@@ -0,0 +1,193 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "SkinTuner.hpp"
+
+#include <cmath>
+#include <functional>
+#include "System.hpp"
+#include "bc/BC.hpp"
+#include "storage/DomainDecomposition.hpp"
+#include "esutil/Error.hpp"
+
+namespace espressopp
+{
+namespace integrator
+{
+LOG4ESPP_LOGGER(SkinTuner::theLogger, "SkinTuner");
+
+namespace
+{
+const real invGoldenRatio = 2.0 / (1.0 + std::sqrt(5.0));
+}
+
+SkinTuner::SkinTuner(
+    std::shared_ptr<System> system, int _interval, real _minSkin, real _maxSkin, real _precision)
+    : Extension(system),
+      interval(_interval),
+      minSkin(_minSkin),
+      maxSkin(_maxSkin),
+      precision(_precision),
+      start(0.0)
+{
+    LOG4ESPP_INFO(theLogger, "construct SkinTuner");
+
+    esutil::Error err(system->comm);
+    dd = dynamic_cast<storage::DomainDecomposition*>(system->storage.get());
+    if (!dd)
+    {
+        err.setException("SkinTuner needs a DomainDecomposition storage");
+    }
+    else
+    {
+        // the cells must not get larger than the domain of a CPU
+        Int3D nodeGrid = dd->getInt3DNodeGrid();
+        const Real3D& boxL = system->bc->getBoxL();
+        real maxCellSize = std::min(std::min(boxL[0] / nodeGrid[0], boxL[1] / nodeGrid[1]),
+                                    boxL[2] / nodeGrid[2]);
+        maxSkin = std::min(maxSkin, maxCellSize - system->maxCutoff);
+    }
+    if (interval < 1 || minSkin <= 0.0 || maxSkin <= minSkin || precision <= 0.0)
+    {
+        err.setException("SkinTuner: need interval >= 1, 0 < minSkin < maxSkin and precision > 0");
+    }
+    err.checkException();
+
+    timer.reset();
+    reset();
+}
+
+SkinTuner::~SkinTuner() { disconnect(); }
+
+void SkinTuner::disconnect() { _aftIntV.disconnect(); }
+
+void SkinTuner::connect()
+{
+    // the cell grid may only change between the steps
+    _aftIntV = integrator->aftIntV.connect(std::bind(&SkinTuner::step, this));
+}
+
+void SkinTuner::reset()
+{
+    a = minSkin;
+    b = maxSkin;
+    x1 = b - (b - a) * invGoldenRatio;
+    x2 = a + (b - a) * invGoldenRatio;
+    t1 = t2 = -1.0;
+    converged = false;
+    steps = -1;
+}
+
+void SkinTuner::trySkin(real skin)
+{
+    System& system = getSystemRef();
+    system.setSkin(skin);
+    dd->cellAdjust(false);
+}
+
+void SkinTuner::step()
+{
+    if (converged) return;
+
+    if (steps < 0)
+    {
+        // start the trial of the inner point that has no time yet
+        trySkin(t1 < 0.0 ? x1 : x2);
+        steps = 0;
+        start = timer.getElapsedTime();
+        return;
+    }
+    if (++steps < interval) return;
+
+    // the slowest CPU determines the time, and all CPUs take the same decision
+    System& system = getSystemRef();
+    real local = (timer.getElapsedTime() - start) / steps, time;
+    mpi::all_reduce(*system.comm, local, time, mpi::maximum<real>());
+    steps = -1;
+
+    Trial trial = {system.getSkin(), dd->getInt3DCellGrid(), time};
+    history.push_back(trial);
+    LOG4ESPP_INFO(theLogger, "skin " << trial.skin << ", cell grid " << trial.cellGrid << ": "
+                                     << time << " s per step");
+
+    if (t1 < 0.0)
+        t1 = time;
+    else
+        t2 = time;
+    if (t1 < 0.0 || t2 < 0.0) return;
+
+    // keep the part of the bracket with the smaller time
+    if (t1 > t2)
+    {
+        a = x1;
+        x1 = x2;
+        t1 = t2;
+        x2 = a + (b - a) * invGoldenRatio;
+        t2 = -1.0;
+    }
+    else
+    {
+        b = x2;
+        x2 = x1;
+        t2 = t1;
+        x1 = b - (b - a) * invGoldenRatio;
+        t1 = -1.0;
+    }
+
+    if (b - a < precision)
+    {
+        converged = true;
+        trySkin(0.5 * (a + b));
+        LOG4ESPP_INFO(theLogger, "converged: skin " << system.getSkin() << ", cell grid "
+                                                    << dd->getInt3DCellGrid());
+    }
+}
+
+python::list SkinTuner::getHistory()
+{
+    python::list result;
+    for (const Trial& trial : history)
+    {
+        result.append(python::make_tuple(trial.skin, trial.cellGrid, trial.time));
+    }
+    return result;
+}
+
+/****************************************************
+** REGISTRATION WITH PYTHON
+****************************************************/
+void SkinTuner::registerPython()
+{
+    using namespace espressopp::python;
+    class_<SkinTuner, std::shared_ptr<SkinTuner>, bases<Extension> >(
+        "integrator_SkinTuner", init<std::shared_ptr<System>, int, real, real, real>())
+        .add_property("interval", &SkinTuner::getInterval, &SkinTuner::setInterval)
+        .add_property("minSkin", &SkinTuner::getMinSkin)
+        .add_property("maxSkin", &SkinTuner::getMaxSkin)
+        .add_property("precision", &SkinTuner::getPrecision)
+        .add_property("converged", &SkinTuner::isConverged)
+        .def("reset", &SkinTuner::reset)
+        .def("getHistory", &SkinTuner::getHistory)
+        .def("connect", &SkinTuner::connect)
+        .def("disconnect", &SkinTuner::disconnect);
+}
+}  // namespace integrator
+}  // namespace espressopp
@@ -0,0 +1,111 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTEGRATOR_SKINTUNER_HPP
+#define _INTEGRATOR_SKINTUNER_HPP
+
+#include <vector>
+#include "types.hpp"
+#include "logging.hpp"
+#include "python.hpp"
+#include "Int3D.hpp"
+#include "Extension.hpp"
+#include "esutil/Timer.hpp"
+#include "boost/signals2.hpp"
+
+namespace espressopp
+{
+namespace storage
+{
+class DomainDecomposition;
+}
+
+namespace integrator
+{
+/** Tunes the Verlet list skin during a simulation. A larger skin makes the force
+    computation more expensive but the rebuilds rarer, so the time per step has a
+    minimum. It is searched for by golden section search in [minSkin, maxSkin]:
+    every trial skin is set, the cell grid is adjusted to it, and the time of the
+    next interval steps is measured, rebuilds included. The search stops when the
+    interval is smaller than precision, and the skin stays at its center.
+*/
+class SkinTuner : public Extension
+{
+public:
+    SkinTuner(
+        std::shared_ptr<System> system, int interval, real minSkin, real maxSkin, real precision);
+    virtual ~SkinTuner();
+
+    void setInterval(int _interval) { interval = _interval; }
+    int getInterval() { return interval; }
+    real getMinSkin() { return minSkin; }
+    real getMaxSkin() { return maxSkin; }
+    real getPrecision() { return precision; }
+
+    /// whether the search has finished
+    bool isConverged() { return converged; }
+    /// start a new search, e.g. after the density has changed
+    void reset();
+
+    /// (skin, cell grid, time per step) of all trials
+    python::list getHistory();
+
+    /** Register this class so it can be used from Python. */
+    static void registerPython();
+
+private:
+    boost::signals2::connection _aftIntV;
+    void connect();
+    void disconnect();
+
+    void step();
+    /// set the skin and adjust the cell grid
+    void trySkin(real skin);
+
+    storage::DomainDecomposition* dd;
+    int interval;
+    real minSkin, maxSkin, precision;
+
+    // golden section search: the bracket [a, b] and the two inner points
+    real a, b;
+    real x1, x2;
+    real t1, t2;  // time per step at x1 and x2, negative if not measured yet
+    bool converged;
+
+    esutil::WallTimer timer;
+    real start;
+    int steps;  // steps of the running trial, -1 if none is running
+
+    struct Trial
+    {
+        real skin;
+        Int3D cellGrid;
+        real time;
+    };
+    std::vector<Trial> history;
+
+    /** Logger */
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+};
+}  // namespace integrator
+}  // namespace espressopp
+
+#endif
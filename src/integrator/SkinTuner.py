@@ -0,0 +1,89 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+*******************************
+espressopp.integrator.SkinTuner
+*******************************
+
+Tunes the Verlet list skin during the simulation, without separate test runs.
+A larger skin makes the force computation more expensive, but the Verlet lists
+are rebuilt less often. The skin with the smallest time per step is searched for
+by golden section search in [minSkin, maxSkin]: each trial skin is set, the cell
+grid is adjusted to it (cellAdjust), and the time of the next interval steps is
+measured, including the rebuilds. When the bracket is smaller than precision,
+the skin is set to its center and stays there. maxSkin is reduced if the cells
+would get larger than the domain of a CPU.
+
+The search takes about log(precision/(maxSkin-minSkin))/log(0.618) + 1 trials.
+The trials are logged (logger SkinTuner, level INFO) and returned by getHistory().
+
+Example:
+
+>>> tuner = espressopp.integrator.SkinTuner(system, interval=50, minSkin=0.05, maxSkin=1.0)
+>>> integrator.addExtension(tuner)
+>>> integrator.run(1000)
+>>> print(tuner.converged, system.skin, system.storage.getCellGrid())
+
+.. function:: espressopp.integrator.SkinTuner(system, interval, minSkin, maxSkin, precision)
+
+                :param system: system object with a DomainDecomposition storage
+                :param interval: number of steps of one trial (default: 50)
+                :param minSkin: smallest skin (default: 0.05)
+                :param maxSkin: largest skin (default: 1.0)
+                :param precision: width of the final bracket (default: 0.02)
+                :type interval: int
+                :type minSkin: real
+                :type maxSkin: real
+                :type precision: real
+
+.. function:: espressopp.integrator.SkinTuner.getHistory()
+
+                :return: list of (skin, cell grid, time per step) of all trials
+
+.. function:: espressopp.integrator.SkinTuner.reset()
+
+                starts a new search, e.g. after the density has changed
+
+.. attribute:: espressopp.integrator.SkinTuner.converged
+
+                whether the search has finished
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.integrator.Extension import *
+from _espressopp import integrator_SkinTuner
+
+class SkinTunerLocal(ExtensionLocal, integrator_SkinTuner):
+    def __init__(self, system, interval=50, minSkin=0.05, maxSkin=1.0, precision=0.02):
+        if pmi.workerIsActive():
+            cxxinit(self, integrator_SkinTuner, system, interval, minSkin, maxSkin, precision)
+
+    def getHistory(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.getHistory(self)
+
+if pmi.isController:
+    class SkinTuner(Extension, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+          cls =  'espressopp.integrator.SkinTunerLocal',
+          pmiproperty = [ 'interval', 'minSkin', 'maxSkin', 'precision', 'converged' ],
+          pmicall = [ 'reset', 'getHistory' ]
+        )
@@ -55,10 +55,34 @@ VelocityVerlet::VelocityVerlet(std::shared_ptr<System> system) : MDIntegrator(sy
     LOG4ESPP_INFO(theLogger, "construct VelocityVerlet");
     resortFlag = true;
     maxDist = 0.0;
+    extDist = 0.0;
     nResorts = 0;
+
+    // the Verlet lists are rebuilt whenever the particles change, e.g. after
+    // decompose() or a cell adjustment for a new skin
+    if (system->storage)
+    {
+        sigParticlesChanged = system->storage->onParticlesChanged.connect(
+            std::bind(&VelocityVerlet::onParticlesChanged, this));
+    }
+}
+
+VelocityVerlet::~VelocityVerlet()
+{
+    LOG4ESPP_INFO(theLogger, "free VelocityVerlet");
+    sigParticlesChanged.disconnect();
 }
 
-VelocityVerlet::~VelocityVerlet() { LOG4ESPP_INFO(theLogger, "free VelocityVerlet"); }
+void VelocityVerlet::onParticlesChanged()
+{
+    CellList realCells = getSystemRef().storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        cit->lastPosition() = cit->position();
+    }
+    maxDist = 0.0;
+    extDist = 0.0;
+}
 
 void VelocityVerlet::run(int nsteps)
 {
@@ -69,7 +93,7 @@ void VelocityVerlet::run(int nsteps)
     resetTimers();
     System& system = getSystemRef();
     storage::Storage& storage = *system.storage;
-    real skinHalf = 0.5 * system.getSkin();
+    real skinHalf;
 
     // signal
     runInit();
@@ -81,7 +105,6 @@ void VelocityVerlet::run(int nsteps)
         time = timeIntegrate.getElapsedTime();
         LOG4ESPP_INFO(theLogger, "resort particles");
         storage.decompose();
-        maxDist = 0.0;
         resortFlag = false;
         timeResort += timeIntegrate.getElapsedTime();
     }
@@ -95,6 +118,7 @@ void VelocityVerlet::run(int nsteps)
         // signal
         recalc1();
 
+        if (tally && nsteps == 0) requestTallies();
         updateForces();
         if (LOG4ESPP_DEBUG_ON(theLogger))
         {
@@ -118,19 +142,24 @@ void VelocityVerlet::run(int nsteps)
 
         time = timeIntegrate.getElapsedTime();
         LOG4ESPP_INFO(theLogger, "updating positions and velocities")
-        maxDist += integrate1();
+        invalidateTallies();
+        real localDist = integrate1();
         timeInt1 += timeIntegrate.getElapsedTime() - time;
 
-        /*
-        real cellsize = 1.4411685442;
-        if (maxDist > 1.4411685442){
-          cout<<"WARNING!!!!!! huge jump: "<<maxDist<<endl;
-          exit(1);
-        }*/
+        // the largest displacement is reduced while the extensions run
+        MPI_Request distRequest;
+        MPI_Iallreduce(&localDist, &maxDist, 1, mpi::get_mpi_datatype<real>(), MPI_MAX,
+                       *system.comm, &distRequest);
 
         // signal
         aftIntP();
 
+        time = timeIntegrate.getElapsedTime();
+        MPI_Wait(&distRequest, MPI_STATUS_IGNORE);
+        timeComm1 += timeIntegrate.getElapsedTime() - time;
+
+        // extensions may change the skin during the run
+        skinHalf = 0.5 * system.getSkin();
         LOG4ESPP_INFO(theLogger, "maxDist = " << maxDist << ", skin/2 = " << skinHalf);
 
         if (maxDist > skinHalf) resortFlag = true;
@@ -141,13 +170,13 @@ void VelocityVerlet::run(int nsteps)
             time = timeIntegrate.getElapsedTime();
             LOG4ESPP_INFO(theLogger, "step " << i << ": resort particles");
             storage.decompose();
-            maxDist = 0.0;
             resortFlag = false;
             nResorts++;
             timeResort += timeIntegrate.getElapsedTime() - time;
         }
 
         LOG4ESPP_INFO(theLogger, "updating forces")
+        if (tally && i == nsteps - 1) requestTallies();
         updateForces();
 
         // signal
@@ -183,13 +212,13 @@ using namespace boost::python;
 
 static object wrapGetTimers(class VelocityVerlet* obj)
 {
-    real tms[10];
+    real tms[11];
     obj->loadTimers(tms);
     return boost::python::make_tuple(tms[0], tms[1], tms[2], tms[3], tms[4], tms[5], tms[6], tms[7],
-                                     tms[8], tms[9]);
+                                     tms[8], tms[9], tms[10]);
 }
 
-void VelocityVerlet::loadTimers(real t[10])
+void VelocityVerlet::loadTimers(real t[11])
 {
     t[0] = timeRun;
     t[1] = timeForceComp[0];
@@ -201,6 +230,7 @@ void VelocityVerlet::loadTimers(real t[10])
     t[7] = timeInt2;
     t[8] = timeResort;
     t[9] = timeLost;
+    t[10] = nResorts;
 }
 
 void VelocityVerlet::printTimers()
@@ -228,6 +258,7 @@ void VelocityVerlet::printTimers()
     cout << "resort (%) = " << timeResort << " (" << pct << ")" << endl;
     pct = 100.0 * (timeLost / timeRun);
     cout << "other (%) = " << timeLost << " (" << pct << ")" << endl;
+    cout << "rebuilds = " << nResorts << endl;
     cout << endl;
 }
 
@@ -241,6 +272,7 @@ real VelocityVerlet::integrate1()
     // loop over all particles of the local cells
     int count = 0;
     real maxSqDist = 0.0;  // maximal square distance a particle moves
+    real maxSqDisp = 0.0;  // same since the last rebuild of the Verlet lists
     for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
     {
         real sqDist = 0.0;
@@ -271,19 +303,24 @@ real VelocityVerlet::integrate1()
         count++;
 
         maxSqDist = std::max(maxSqDist, sqDist);
+
+        Real3D disp = cit->position() - cit->lastPosition();
+        maxSqDisp = std::max(maxSqDisp, disp.sqr());
     }
 
     // signal
+    real ownSqDist = maxSqDist;
     inIntP(maxSqDist);
 
-    real maxAllSqDist;
-    mpi::all_reduce(*system.comm, maxSqDist, maxAllSqDist, boost::mpi::maximum<real>());
+    // extensions that move particles themselves, e.g. a barostat, only report
+    // the largest step, so their steps are summed up since the last rebuild
+    if (maxSqDist > ownSqDist) extDist += sqrt(maxSqDist);
 
     LOG4ESPP_INFO(theLogger, "moved " << count << " particles in integrate1"
                                       << ", max move local = " << sqrt(maxSqDist)
-                                      << ", global = " << sqrt(maxAllSqDist));
+                                      << ", since the last rebuild = " << sqrt(maxSqDisp));
 
-    return sqrt(maxAllSqDist);
+    return sqrt(maxSqDisp) + extDist;
 }
 
 void VelocityVerlet::integrate2()
@@ -313,6 +350,7 @@ void VelocityVerlet::calcForces()
     initForces();
 
     // signal
+    befCalcFLocal();
     aftInitF();
 
     System& sys = getSystemRef();
@@ -329,19 +367,77 @@ void VelocityVerlet::calcForces()
     aftCalcFLocal();
 }
 
-void VelocityVerlet::updateForces()
+void VelocityVerlet::calcForcesOverlapped()
 {
-    LOG4ESPP_INFO(theLogger, "update ghosts, calculate forces and collect ghost forces")
+    VT_TRACER("forces");
+
+    LOG4ESPP_INFO(theLogger, "calculate forces while updating the ghosts");
+
+    initForces();
+
+    // signal
+    befCalcFLocal();
+
+    System& sys = getSystemRef();
+    const InteractionList& srIL = sys.shortRangeInteractions;
     real time;
-    storage::Storage& storage = *getSystemRef().storage;
+
+    for (size_t i = 0; i < srIL.size(); i++)
+    {
+        time = timeIntegrate.getElapsedTime();
+        srIL[i]->addForcesBeforeGhosts();
+        timeForceComp[i] += timeIntegrate.getElapsedTime() - time;
+    }
+
+    // signal
+    befWaitGhosts();
+
     time = timeIntegrate.getElapsedTime();
     {
         VT_TRACER("commF");
-        storage.updateGhosts();
+        sys.storage->endUpdateGhosts();
     }
     timeComm1 += timeIntegrate.getElapsedTime() - time;
+
+    // signal, the extensions may need the ghosts
+    aftInitF();
+
+    for (size_t i = 0; i < srIL.size(); i++)
+    {
+        LOG4ESPP_INFO(theLogger, "compute forces for srIL " << i << " of " << srIL.size());
+        time = timeIntegrate.getElapsedTime();
+        srIL[i]->addForcesAfterGhosts();
+        timeForceComp[i] += timeIntegrate.getElapsedTime() - time;
+    }
+    aftCalcFLocal();
+}
+
+void VelocityVerlet::updateForces()
+{
+    LOG4ESPP_INFO(theLogger, "update ghosts, calculate forces and collect ghost forces")
+    real time;
+    storage::Storage& storage = *getSystemRef().storage;
     time = timeIntegrate.getElapsedTime();
-    calcForces();
+    if (storage.overlapsGhostUpdate())
+    {
+        {
+            VT_TRACER("commF");
+            storage.beginUpdateGhosts();
+        }
+        timeComm1 += timeIntegrate.getElapsedTime() - time;
+        time = timeIntegrate.getElapsedTime();
+        calcForcesOverlapped();
+    }
+    else
+    {
+        {
+            VT_TRACER("commF");
+            storage.updateGhosts();
+        }
+        timeComm1 += timeIntegrate.getElapsedTime() - time;
+        time = timeIntegrate.getElapsedTime();
+        calcForces();
+    }
     timeForce += timeIntegrate.getElapsedTime() - time;
     time = timeIntegrate.getElapsedTime();
     {
@@ -45,8 +45,9 @@ public:
 
     void run(int nsteps);
 
-    /** Load timings in array to export to Python as a tuple. */
-    void loadTimers(real t[10]);
+    /** Load timings and the number of Verlet list rebuilds in array to export
+        to Python as a tuple. */
+    void loadTimers(real t[11]);
 
     void resetTimers();
 
@@ -60,12 +61,19 @@ public:
 protected:
     bool resortFlag;  //!< true implies need for resort of particles
     int nResorts;
-    real maxDist;
+    real maxDist;  //!< largest displacement of a particle since the last rebuild
+    real extDist;  //!< sum of the steps of particles moved by extensions, see integrate1()
 
     real maxCut;
 
+    boost::signals2::connection sigParticlesChanged;
+    /** The Verlet lists were rebuilt from the current positions, which become
+        the reference of the displacements. */
+    void onParticlesChanged();
+
     /** Method updates particle positions and velocities.
-        \return maximal square distance a particle has moved.
+        \return largest distance a local particle has moved since the last
+        rebuild of the Verlet lists.
     */
     real integrate1();
 
@@ -77,6 +85,12 @@ protected:
 
     void calcForces();
 
+    /** calcForces() during a ghost update started with beginUpdateGhosts(): the
+        forces between real particles are computed before the ghosts are waited
+        for. befCalcFLocal is signalled before them, befWaitGhosts and aftInitF
+        around the wait. */
+    void calcForcesOverlapped();
+
     void printPositions(bool withGhost);
 
     void printForces(bool withGhost);
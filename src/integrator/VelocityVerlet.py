@@ -29,6 +29,20 @@ espressopp.integrator.VelocityVerlet
 
                 :param system:
                 :type system:
+
+The Verlet lists are rebuilt when a particle has moved more than half the skin
+since the last rebuild. The largest displacement is reduced over the CPUs
+without blocking while the aftIntP extensions run.
+
+.. function:: espressopp.integrator.VelocityVerlet.getTimers()
+
+                :return: per CPU, the times of run, pair, FENE, angle, comm1, comm2,
+                         int1, int2, resort and other, and the number of rebuilds
+                         of the last run
+
+.. function:: espressopp.integrator.VelocityVerlet.getNumResorts()
+
+                :return: the number of rebuilds of the last run
 """
 from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -40,6 +40,9 @@ VelocityVerletOnRadius::VelocityVerletOnRadius(std::shared_ptr<System> system,
                                                real _radialDampingMass)
     : Extension(system), radialDampingMass(_radialDampingMass)
 {
+    // the radii change every step, and radial forces may be added on ghosts
+    system->storage->requestGhostFields(storage::Storage::GHOST_RADIUS |
+                                        storage::Storage::GHOST_FRADIUS);
     LOG4ESPP_INFO(theLogger, "VelocityVerletOnRadius constructed");
 }
 
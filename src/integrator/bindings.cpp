@@ -57,6 +57,8 @@
 #include "ExtForce.hpp"
 #include "CapForce.hpp"
 #include "ExtAnalyze.hpp"
+#include "LoadBalancer.hpp"
+#include "SkinTuner.hpp"
 #include "Settle.hpp"
 #include "Rattle.hpp"
 #include "VelocityVerletOnRadius.hpp"
@@ -105,6 +107,8 @@ void registerPython()
     ExtForce::registerPython();
     CapForce::registerPython();
     ExtAnalyze::registerPython();
+    LoadBalancer::registerPython();
+    SkinTuner::registerPython();
     Settle::registerPython();
     Rattle::registerPython();
     VelocityVerletOnRadius::registerPython();
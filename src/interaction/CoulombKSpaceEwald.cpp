@@ -45,6 +45,7 @@ CoulombKSpaceEwald::CoulombKSpaceEwald(std::shared_ptr<System> _system,
     I = Tensor(1.0, 1.0, 1.0, 0.0, 0.0, 0.0);
     sum = NULL;
     totsum = NULL;
+    stride = 0;
 
     preset();
     // getParticleNumber(); // geting the number of particles for the current node // it's done in
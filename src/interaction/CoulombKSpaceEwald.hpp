@@ -26,6 +26,7 @@
 #ifndef _INTERACTION_COULOMBKSPACEEWALD_HPP
 #define _INTERACTION_COULOMBKSPACEEWALD_HPP
 
+#include <algorithm>
 #include <cmath>
 
 #include <boost/signals2.hpp>
@@ -40,6 +41,8 @@
 #include "Tensor.hpp"
 
 #include "System.hpp"
+#include "esutil/Threads.hpp"
+#include "vec/include/simdconfig.hpp"
 
 #include "boost/serialization/vector.hpp"
 #include "boost/serialization/complex.hpp"
@@ -68,6 +71,11 @@ namespace interaction
 /** This class provides methods to compute forces and energies of the
  *  CoulombKSpaceEwald part. Currently it works with cubes and rectangular cuboids.
  *  Does not work for triclinic box, slab geometry.
+ *
+ *  The exponents of the charged particles are kept as aligned arrays of the real and
+ *  imaginary parts, so that the loops over the particles vectorize. With OpenMP, the
+ *  structure factors are summed by the threads in blocks of k-vectors and the forces
+ *  in chunks of particles.
  */
 
 // TODO should be optimized (force energy and virial calculate the same stuff)
@@ -111,12 +119,23 @@ private:
     vector<Tensor> virialTensorPref;
     Tensor I;
 
-    // exponent array
-    vector<vector<dcomplex> > eikx;
-    vector<vector<dcomplex> > eiky;
-    vector<vector<dcomplex> > eikz;
+    // charged particles of this CPU, only they enter the k space sums
+    vector<Particle*> charged;
+    size_t stride;  // number of charged particles padded to the SIMD width
 
-    vector<vector<dcomplex> > eik;
+    // exp(i k r) of the charged particles as aligned arrays of the real and imaginary parts,
+    // one row of stride values per k: k = 0..kmax for x, row kmax + k for k = -kmax..kmax
+    // for y and z
+    vec::AlignedVector<real> eikxRe, eikxIm;
+    vec::AlignedVector<real> eikyRe, eikyIm;
+    vec::AlignedVector<real> eikzRe, eikzIm;
+    vec::AlignedVector<real> charges;  // zero in the padding
+    vec::AlignedVector<real> fx, fy, fz;
+
+    // number of k-vectors summed while the exponents of one chunk of particles are in cache,
+    // and the size of the chunks (a multiple of the SIMD width)
+    static constexpr int kBlock = 16;
+    static constexpr size_t chunk = 128;
 
     real sum_q2;
 
@@ -359,17 +378,12 @@ public:
         getParticleNumber();
     }
 
-    // here we get the current particle number on the current node
-    // and set the auxiliary arrays eikx, eiky, eikz
+    // here we get the current particle number on the current node, the exponent arrays are
+    // sized to the charged particles by exponentPrecalculation()
     void getParticleNumber()
     {
         nParticles = system->storage->getNRealParticles();
-
-        eikx = vector<vector<dcomplex> >(kmax + 1, vector<dcomplex>(nParticles, 0));
-        eiky = vector<vector<dcomplex> >(2 * kmax + 1, vector<dcomplex>(nParticles, 0));
-        eikz = vector<vector<dcomplex> >(2 * kmax + 1, vector<dcomplex>(nParticles, 0));
-
-        eik = vector<vector<dcomplex> >(kVectorLength, vector<dcomplex>(nParticles, 0));
+        charged.reserve(nParticles);
     }
 
     // it counts the squared charges over all system. It is used for self energy calculations
@@ -424,106 +438,193 @@ public:
             real offs = system->shearOffset;
             cottheta = ((offs > Lx / 2.0 ? offs - Lx : offs)) / Lz;
         }
-        /* Calculation of k space sums */
-        // -1, 0, 1
-        int j = 0;  // auxiliary variable, particle counter
 
-        if (shear_flag && cottheta != .0)
+        bool sheared = shear_flag && cottheta != .0;
+        if (sheared && !ifVirial)
         {
-            if (!ifVirial)
+            if (useOtherPreset == 1)
             {
-                if (useOtherPreset == 1)
-                {
-                    preset_lite();
-                    // preset();
-                }
-                else  // interpolate kvectors, NOT done yet
-                    ;
+                preset_lite();
+                // preset();
             }
+            else  // interpolate kvectors, NOT done yet
+                ;
+        }
 
-            // calculate ksum for ewald under shear flow
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-            {
-                Particle& p = *it;
-
-                real intc = Lx / cottheta;
-                real zshift = -p.position()[0] / cottheta;
-                int nshift = static_cast<int>(floor((p.position()[2] + zshift) / intc) + 1.0);
-                real px = p.position()[0] + (nshift + .0) * Lx;
-
-                eikx[0][j] = dcomplex(1.0, 0.0);
-                eiky[kmax + 0][j] = dcomplex(1.0, 0.0);
-                eikz[kmax + 0][j] = dcomplex(1.0, 0.0);
-
-                eikx[1][j] = dcomplex(cos(rclx * (px - cottheta * p.position()[2])),
-                                      sin(rclx * (px - cottheta * p.position()[2])));
-                eiky[kmax + 1][j] =
-                    dcomplex(cos(rcly * p.position()[1]), sin(rcly * p.position()[1]));
-                eikz[kmax + 1][j] =
-                    dcomplex(cos(rclz * p.position()[2]), sin(rclz * p.position()[2]));
+        /* Calculation of k space sums */
+        charged.clear();
+        for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
+            if (it->q() != 0) charged.push_back(&*it);
+
+        size_t n = charged.size();
+        stride = vec::ESPP_FIT_TO_VECTOR_WIDTH(n);
+        eikxRe.resize((kmax + 1) * stride);
+        eikxIm.resize((kmax + 1) * stride);
+        eikyRe.resize((2 * kmax + 1) * stride);
+        eikyIm.resize((2 * kmax + 1) * stride);
+        eikzRe.resize((2 * kmax + 1) * stride);
+        eikzIm.resize((2 * kmax + 1) * stride);
+        charges.assign(stride, 0.0);
+
+        real* x0Re = &eikxRe[0];
+        real* x0Im = &eikxIm[0];
+        real* y0Re = &eikyRe[kmax * stride];
+        real* y0Im = &eikyIm[kmax * stride];
+        real* z0Re = &eikzRe[kmax * stride];
+        real* z0Im = &eikzIm[kmax * stride];
+        std::fill(x0Re, x0Re + stride, 1.0);
+        std::fill(x0Im, x0Im + stride, 0.0);
+        std::fill(y0Re, y0Re + stride, 1.0);
+        std::fill(y0Im, y0Im + stride, 0.0);
+        std::fill(z0Re, z0Re + stride, 1.0);
+        std::fill(z0Im, z0Im + stride, 0.0);
+        if (kmax < 1)
+        {
+            sumStructureFactors();
+            return;
+        }
 
-                eiky[kmax - 1][j] = conj(eiky[kmax + 1][j]);
-                eikz[kmax - 1][j] = conj(eikz[kmax + 1][j]);
+        real* x1Re = x0Re + stride;
+        real* x1Im = x0Im + stride;
+        real* y1Re = y0Re + stride;
+        real* y1Im = y0Im + stride;
+        real* z1Re = z0Re + stride;
+        real* z1Im = z0Im + stride;
+        for (size_t j = 0; j < n; j++)
+        {
+            const Particle& p = *charged[j];
+            const Real3D& pos = p.position();
 
-                j++;
+            real px = pos[0];
+            if (sheared)
+            {
+                // calculate ksum for ewald under shear flow
+                real intc = Lx / cottheta;
+                real zshift = -pos[0] / cottheta;
+                int nshift = static_cast<int>(floor((pos[2] + zshift) / intc) + 1.0);
+                px = pos[0] + (nshift + .0) * Lx - cottheta * pos[2];
             }
+
+            x1Re[j] = cos(rclx * px);
+            x1Im[j] = sin(rclx * px);
+            y1Re[j] = cos(rcly * pos[1]);
+            y1Im[j] = sin(rcly * pos[1]);
+            z1Re[j] = cos(rclz * pos[2]);
+            z1Im[j] = sin(rclz * pos[2]);
+            charges[j] = p.q();
         }
-        else
+        for (size_t j = n; j < stride; j++)
         {
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-            {
-                Particle& p = *it;
-
-                eikx[0][j] = dcomplex(1.0, 0.0);
-                eiky[kmax + 0][j] = dcomplex(1.0, 0.0);
-                eikz[kmax + 0][j] = dcomplex(1.0, 0.0);
+            x1Re[j] = x1Im[j] = y1Re[j] = y1Im[j] = z1Re[j] = z1Im[j] = 0.0;
+        }
 
-                eikx[1][j] = dcomplex(cos(rclx * p.position()[0]), sin(rclx * p.position()[0]));
-                eiky[kmax + 1][j] =
-                    dcomplex(cos(rcly * p.position()[1]), sin(rcly * p.position()[1]));
-                eikz[kmax + 1][j] =
-                    dcomplex(cos(rclz * p.position()[2]), sin(rclz * p.position()[2]));
+        // the rest terms by complex multiplication, exp(-iky) = conj(exp(iky))
+        for (int k = 1; k <= kmax; k++)
+        {
+            if (k > 1)
+            {
+                powerRow(&eikxRe[k * stride], &eikxIm[k * stride], x1Re, x1Im);
+                powerRow(y0Re + k * stride, y0Im + k * stride, y1Re, y1Im);
+                powerRow(z0Re + k * stride, z0Im + k * stride, z1Re, z1Im);
+            }
+            conjugateRow(y0Re - k * stride, y0Im - k * stride, y0Re + k * stride,
+                         y0Im + k * stride);
+            conjugateRow(z0Re - k * stride, z0Im - k * stride, z0Re + k * stride,
+                         z0Im + k * stride);
+        }
 
-                eiky[kmax - 1][j] = conj(eiky[kmax + 1][j]);
-                eikz[kmax - 1][j] = conj(eikz[kmax + 1][j]);
+        sumStructureFactors();
+    }
 
-                j++;
-            }
+    // row[k] = row[k - 1] * row[1] for the row of exponents that starts at re, im
+    void powerRow(real* re, real* im, const real* re1, const real* im1) const
+    {
+        const real* prevRe = re - stride;
+        const real* prevIm = im - stride;
+        ESPP_VEC_PRAGMAS
+        for (size_t j = 0; j < stride; j++)
+        {
+            re[j] = prevRe[j] * re1[j] - prevIm[j] * im1[j];
+            im[j] = prevRe[j] * im1[j] + prevIm[j] * re1[j];
         }
+    }
 
-        // calculation of the rest terms
-        for (int k = 2; k <= kmax; k++)
+    void conjugateRow(real* re, real* im, const real* srcRe, const real* srcIm) const
+    {
+        ESPP_VEC_PRAGMAS
+        for (size_t j = 0; j < stride; j++)
         {
-            j = 0;
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-            {
-                eikx[k][j] = eikx[k - 1][j] * eikx[1][j];
+            re[j] = srcRe[j];
+            im[j] = -srcIm[j];
+        }
+    }
 
-                eiky[kmax + k][j] = eiky[kmax + k - 1][j] * eiky[kmax + 1][j];
-                eiky[kmax - k][j] = conj(eiky[kmax + k][j]);
+    // rows of the exponents that make up exp(i k r) for the k-vector k
+    struct ExponentRows
+    {
+        const real *xRe, *xIm, *yRe, *yIm, *zRe, *zIm;
+    };
 
-                eikz[kmax + k][j] = eikz[kmax + k - 1][j] * eikz[kmax + 1][j];
-                eikz[kmax - k][j] = conj(eikz[kmax + k][j]);
+    ExponentRows exponentRows(int k) const
+    {
+        return {&eikxRe[kx_ind[k] * stride], &eikxIm[kx_ind[k] * stride],
+                &eikyRe[ky_ind[k] * stride], &eikyIm[ky_ind[k] * stride],
+                &eikzRe[kz_ind[k] * stride], &eikzIm[kz_ind[k] * stride]};
+    }
 
-                j++;
-            }
-        }
+    // exp(i k r_j) = eikx * eiky * eikz
+    static void exponent(const ExponentRows& r, size_t j, real& re, real& im)
+    {
+        real xyRe = r.xRe[j] * r.yRe[j] - r.xIm[j] * r.yIm[j];
+        real xyIm = r.xRe[j] * r.yIm[j] + r.xIm[j] * r.yRe[j];
+        re = xyRe * r.zRe[j] - xyIm * r.zIm[j];
+        im = xyRe * r.zIm[j] + xyIm * r.zRe[j];
+    }
 
-        real q;  // particle charge, auxiliary
-        for (int k = 0; k < kVectorLength; k++)
+    // structure factors sum[k] = sum_j q_j exp(i k r_j) of this CPU, summed up in totsum.
+    // Every thread sums blocks of kBlock k-vectors, chunk by chunk of the particles, with
+    // one partial sum per SIMD lane so that the compiler can vectorize the particle loop.
+    void sumStructureFactors()
+    {
+        constexpr size_t W = vec::ESPP_VECTOR_WIDTH;
+        int numBlocks = (kVectorLength + kBlock - 1) / kBlock;
+
+        ESPP_OMP(omp parallel for schedule(dynamic))
+        for (int b = 0; b < numBlocks; b++)
         {
-            sum[k] = dcomplex(0.0, 0.0);
-            totsum[k] = dcomplex(0.0, 0.0);
-            j = 0;
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
+            int k0 = b * kBlock;
+            int k1 = std::min(k0 + kBlock, kVectorLength);
+            real accRe[kBlock][W] = {}, accIm[kBlock][W] = {};
+            for (size_t j0 = 0; j0 < stride; j0 += chunk)
             {
-                Particle& p = *it;
-                if ((q = p.q()) != 0)
+                size_t j1 = std::min(j0 + chunk, stride);
+                for (int k = k0; k < k1; k++)
                 {
-                    eik[k][j] = q * (eikx[kx_ind[k]][j] * eiky[ky_ind[k]][j] * eikz[kz_ind[k]][j]);
-                    sum[k] += eik[k][j];
+                    ExponentRows r = exponentRows(k);
+                    real* re = accRe[k - k0];
+                    real* im = accIm[k - k0];
+                    for (size_t j = j0; j < j1; j += W)
+                    {
+                        ESPP_VEC_PRAGMAS
+                        for (size_t l = 0; l < W; l++)
+                        {
+                            real eRe, eIm;
+                            exponent(r, j + l, eRe, eIm);
+                            re[l] += charges[j + l] * eRe;
+                            im[l] += charges[j + l] * eIm;
+                        }
+                    }
                 }
-                j++;
+            }
+            for (int k = k0; k < k1; k++)
+            {
+                real re = 0.0, im = 0.0;
+                for (size_t l = 0; l < W; l++)
+                {
+                    re += accRe[k - k0][l];
+                    im += accIm[k - k0][l];
+                }
+                sum[k] = dcomplex(re, im);
             }
         }
 
@@ -575,6 +676,10 @@ public:
         // exponent array
         exponentPrecalculation(realcells);
 
+        // tff = fact * kvector * totsum and the force prefactors times the k-vector, per k
+        vector<real> tffRe(kVectorLength), tffIm(kVectorLength);
+        vector<real> fkx(kVectorLength), fky(kVectorLength), fkz(kVectorLength);
+        bool sheared = shear_flag && cottheta != .0;
         real fact;  // factor due to the symmetry
         for (int k = 0; k < kVectorLength; k++)
         {
@@ -589,42 +694,47 @@ public:
             }
 
             dcomplex tff = fact * kvector[k] * totsum[k];  // auxiliary complex factor
-            int j = 0;
-            if (shear_flag && cottheta != .0)
-                for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-                {
-                    Particle& p = *it;
+            tffRe[k] = tff.real();
+            tffIm[k] = tff.imag();
+            fkx[k] = force_prefac[0] * kxfield[k];
+            fky[k] = force_prefac[1] * kyfield[k];
+            fkz[k] = force_prefac[2] * kzfield[k];
+            if (sheared) fkz[k] -= force_prefac[0] * cottheta * kxfield[k];
+        }
 
-                    real tf = 0.0;
-                    if (p.q() != 0)
-                    {
-                        tf = imag(tff * conj(eik[k][j]));
+        // every thread takes whole chunks of particles and loops over all k-vectors
+        fx.assign(stride, 0.0);
+        fy.assign(stride, 0.0);
+        fz.assign(stride, 0.0);
+        int numChunks = (stride + chunk - 1) / chunk;
 
-                        p.force()[0] += force_prefac[0] * tf * kxfield[k];
-                        p.force()[1] += force_prefac[1] * tf * kyfield[k];
-                        p.force()[2] += force_prefac[2] * tf * kzfield[k] -
-                                        force_prefac[0] * cottheta * tf * kxfield[k];
-                    }
-                    j++;
-                }
-            else
-                for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
+        ESPP_OMP(omp parallel for schedule(static))
+        for (int c = 0; c < numChunks; c++)
+        {
+            size_t j0 = c * chunk;
+            size_t j1 = std::min(j0 + chunk, stride);
+            for (int k = 0; k < kVectorLength; k++)
+            {
+                ExponentRows r = exponentRows(k);
+                real tr = tffRe[k], ti = tffIm[k];
+                real ax = fkx[k], ay = fky[k], az = fkz[k];
+                ESPP_VEC_PRAGMAS
+                for (size_t j = j0; j < j1; j++)
                 {
-                    Particle& p = *it;
-
-                    real tf = 0.0;
-                    if (p.q() != 0)
-                    {
-                        tf = imag(tff * conj(eik[k][j]));
-
-                        p.force()[0] += force_prefac[0] * tf * kxfield[k];
-                        p.force()[1] += force_prefac[1] * tf * kyfield[k];
-                        p.force()[2] += force_prefac[2] * tf * kzfield[k];
-                    }
-                    j++;
+                    real eRe, eIm;
+                    exponent(r, j, eRe, eIm);
+                    // imag(tff * conj(q exp(ikr)))
+                    real tf = charges[j] * (ti * eRe - tr * eIm);
+                    fx[j] += ax * tf;
+                    fy[j] += ay * tf;
+                    fz[j] += az * tf;
                 }
+            }
         }
 
+        for (size_t j = 0; j < charged.size(); j++)
+            charged[j]->force() += Real3D(fx[j], fy[j], fz[j]);
+
         return true;
     }
 
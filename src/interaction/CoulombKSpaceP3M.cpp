@@ -37,14 +37,18 @@ CoulombKSpaceP3M::CoulombKSpaceP3M(std::shared_ptr<System> _system,
                                    Int3D _M,
                                    int _P,
                                    real _rcut,
-                                   int _interpolation)
+                                   int _interpolation,
+                                   bool _analytic,
+                                   string _wisdomFile)
     : system(_system),
       C_pref(_coulomb_prefactor),
       alpha(_alpha),
       M(_M),
       P(_P),
       rc(_rcut),
-      interpolation(_interpolation)
+      interpolation(_interpolation),
+      analytic(_analytic),
+      wisdomFile(_wisdomFile)
 {
     // predefined assigned function coefficients
     af_coef[1][0][0] = 1.0;
@@ -195,10 +199,10 @@ CoulombKSpaceP3M::CoulombKSpaceP3M(std::shared_ptr<System> _system,
     af_coef[7][6][6] = 64. / 46080.;
 
     getParticleNumber();
-    preset();
+    resetTimers();
 
-    // first initialize
-    initialize();
+    // set up the mesh and the influence function
+    preset();
 
     // This function calculates the square of all particle charges. It should be called ones,
     // if the total number of particles doesn't change.
@@ -217,15 +221,13 @@ CoulombKSpaceP3M::CoulombKSpaceP3M(std::shared_ptr<System> _system,
     // recalcCommonPart = system.
 }
 
-CoulombKSpaceP3M::~CoulombKSpaceP3M()
+CoulombKSpaceP3M::~CoulombKSpaceP3M() {}
+
+static python::object wrapGetTimers(CoulombKSpaceP3M* obj)
 {
-    /*
-    delete [] sum;
-    delete [] totsum;
-    sum = NULL;
-    totsum = NULL;
-    */
-    clean_fftw();
+    real tms[4];
+    obj->loadTimers(tms);
+    return python::make_tuple(tms[0], tms[1], tms[2], tms[3]);
 }
 
 //////////////////////////////////////////////////
@@ -237,9 +239,12 @@ void CoulombKSpaceP3M::registerPython()
 
     class_<CoulombKSpaceP3M, bases<Potential> >(
         "interaction_CoulombKSpaceP3M",
-        init<std::shared_ptr<System>, real, real, Int3D, int, real, int>())
+        init<std::shared_ptr<System>, real, real, Int3D, int, real, int, bool, std::string>())
         .add_property("prefactor", &CoulombKSpaceP3M::getPrefactor,
-                      &CoulombKSpaceP3M::setPrefactor);
+                      &CoulombKSpaceP3M::setPrefactor)
+        .def("resetTimers", &CoulombKSpaceP3M::resetTimers)
+        .def("getTimers", &wrapGetTimers)
+        .def("getMemory", &CoulombKSpaceP3M::getMemory);
     //.add_property("alpha", &CoulombKSpaceP3M::getAlpha, &CoulombKSpaceP3M::setAlpha)
     //.add_property("kmax", &CoulombKSpaceP3M::getKMax, &CoulombKSpaceP3M::setKMax)
     //;
@@ -25,15 +25,17 @@
 #define _INTERACTION_COULOMBKSPACEP3M_HPP
 
 #include <cmath>
+#include <memory>
 #include <boost/signals2.hpp>
 
-#include <fftw3.h>
-
 #include "mpi.hpp"
 #include "Potential.hpp"
 #include "CellListAllParticlesInteractionTemplate.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "esutil/Error.hpp"
+#include "esutil/ParallelFFT.hpp"
+#include "esutil/Timer.hpp"
+#include "storage/DomainDecomposition.hpp"
 
 #include "bc/BC.hpp"
 
@@ -62,10 +64,20 @@ namespace interaction
  *
  *  The code is based on M.Deserno's work. Reference in literature
  *  M. Deserno, C.Holm, J.Chem. Phys, 109[18] (1998) 7694
+ *
+ *  The mesh is distributed over the ranks like the particles: every rank owns the mesh
+ *  points inside its domain of the DomainDecomposition and assigns the charges of its
+ *  particles to these points plus a halo. The halo contributions are added to their
+ *  owners, the mesh is transformed by a distributed pencil FFT (esutil::ParallelFFT)
+ *  and the fields are sent back to the halos for the force interpolation.
+ *
+ *  The charge density is real, so the mesh is transformed by real-to-complex FFTs and
+ *  only half of the k-space mesh is stored. The forces are computed either by ik
+ *  differentiation (three backward transforms, one per field component) or by analytic
+ *  differentiation of the charge assignment function (one backward transform of the
+ *  potential, with the influence function optimized for this scheme).
  */
 
-// TODO this version is still under development. not parallel. doesn't work for several
-// CPUs
 // TODO should be optimized (force, energy and virial calculate the same stuff)
 
 class CoulombKSpaceP3M : public PotentialTemplate<CoulombKSpaceP3M>
@@ -84,6 +96,8 @@ private:
     real rc;            // cutoff in real space
     int interpolation;  // number of interpolation points for the charge assignment
                         // function
+    bool analytic;      // analytic instead of ik differentiation
+    string wisdomFile;  // file to keep the FFTW wisdom between runs, empty for none
 
     int MMM;  // MMM = M[0]*M[1]*M[2]
 
@@ -91,25 +105,44 @@ private:
     static const int brillouin = 1;
 
     vector<vector<real> > precalc_interp_caf;
+    vector<vector<real> > precalc_interp_dcaf;  // derivatives, for analytic differentiation
 
     vector<vector<real> > mesh_shift;
 
     vector<vector<real> > d_op;
 
-    // vector< vector< vector<real> > >gf; // influence function
-    vector<real> gf;  // influence function
+    // influence function on the local k-space points (fft->getOutBox()), which cover
+    // the non-negative k_z half of the mesh
+    vector<real> gf;
 
-    // vector< vector< vector< dcomplex > > > QQQ;
+    // transformed charges on the local k-space points
     vector<dcomplex> QQQ;
 
-    vector<vector<dcomplex> > phi;
+    // mesh points owned by this rank, and extended by the halo
+    esutil::MeshBox localBox;
+    esutil::MeshBox extBox;
+    Int3D halo;
 
-    // reference points in the lattice, needed for the charge assignment
-    vector<Int3D> g_ca;
-    // mesh contributions of the charged particles
-    vector<vector<real> > q_l;
+    // charges on the extended and on the owned mesh
+    vector<real> rho_ext;
+    vector<real> rho;
 
-    vector<vector<vector<int> > > map_indx;
+    // field components (ik) or the potential (analytic) on the owned and on the
+    // extended mesh
+    vector<real> field;
+    vector<vector<real> > field_ext;
+
+    // charge assignment of the local particles in cell order: index of the first
+    // assigned point on the extended mesh, and the P^3 charge contributions
+    vector<size_t> ca_index;
+    vector<real> ca_weight;
+    vector<Int3D> ca_arg;  // interpolation arguments, for analytic differentiation
+
+    // distributed FFT and halo exchange
+    std::shared_ptr<esutil::ParallelFFT> fft;
+    Int3D fftMesh;
+    esutil::MeshRemap haloToOwner;
+    esutil::MeshRemap ownerToHalo;
 
     int nParticles;       // number of particles in system
     Real3D sysL;          // system size
@@ -117,10 +150,8 @@ private:
 
     real af_coef[8][7][7];  // matrix of predefined assigned function coefficients
 
-    // fftw elements
-    fftw_complex* in_array;
-    fftw_plan plan;
-    int MM[3];  // auxiliary array for plan generation
+    esutil::WallTimer timer;
+    real timeAssign, timeHalo, timeFFT, timeInterpolate;
 
     // real oddeven1, oddeven2; // supporting variables odd/even interpolation order
 public:
@@ -132,7 +163,9 @@ public:
                      Int3D _M,
                      int _P,
                      real _rcut,
-                     int _interpolation);
+                     int _interpolation,
+                     bool _analytic,
+                     string _wisdomFile);
 
     ~CoulombKSpaceP3M();
 
@@ -141,26 +174,12 @@ public:
     {
         sysL = system->bc->getBoxL();
         MMM = M[0] * M[1] * M[2];
-        for (int i = 0; i < 3; i++) MM[i] = M[i];
-
-        // map xpos, ypos and zpos to index = zpos + M[2] * (ypos + M[1] * xpos)
-        map_indx =
-            vector<vector<vector<int> > >(M[0], vector<vector<int> >(M[1], vector<int>(M[2], 0)));
-        for (int i = 0; i < M[0]; i++)
-        {
-            int mi = M[1] * i;
-            for (int j = 0; j < M[1]; j++)
-            {
-                int mj = M[2] * (j + mi);
-                for (int k = 0; k < M[2]; k++)
-                {
-                    map_indx[i][j][k] = k + mj;
-                }
-            }
-        }
 
         precalc_interp_caf = vector<vector<real> >(P, vector<real>(2 * interpolation + 1, 0.0));
+        precalc_interp_dcaf = vector<vector<real> >(P, vector<real>(2 * interpolation + 1, 0.0));
         precalc_interpol_charge_assignment_f();
+
+        initialize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -201,11 +220,12 @@ public:
         preset();
     }
     int getInterpolation() const { return interpolation; }
+    bool getAnalytic() const { return analytic; }
     /////////////////////////////////////////////////////////////////////////////////////////
 
     void initialize()
     {
-        set_fftw_array();
+        setupMesh();
 
         mesh_shift = vector<vector<real> >(3, vector<real>());
         d_op = vector<vector<real> >(3, vector<real>());
@@ -219,21 +239,76 @@ public:
 
         calc_differential_operator();
 
-        gf = vector<real>(MMM, 0.0);
+        gf = vector<real>(fft->getOutBox().size(), 0.0);
 
         calc_opt_influence_function();
 
         // -----------------------------------------
         // charge assignment
-        QQQ = vector<dcomplex>(MMM, 0.0);
+        QQQ = vector<dcomplex>(fft->getOutBox().size(), 0.0);
+    }
+
+    // distribute the mesh over the ranks following the domain decomposition
+    void setupMesh()
+    {
+        const mpi::communicator& comm = *system->comm;
+
+        // every rank owns the mesh points inside its domain. The domain borders are
+        // whole cells and may move with the load balancing
+        Int3D lo(0), hi(M);
+        storage::DomainDecomposition* dd =
+            dynamic_cast<storage::DomainDecomposition*>(system->storage.get());
+        if (dd)
+        {
+            const storage::NodeGrid& nodeGrid = dd->getNodeGrid();
+            for (int i = 0; i < 3; i++)
+            {
+                long long G = dd->getGlobalCellGridSize(i);
+                longint pos = nodeGrid.getNodePosition(i);
+                lo[i] = int(M[i] * dd->getCellBorder(i, pos) / G);
+                hi[i] = int(M[i] * dd->getCellBorder(i, pos + 1) / G);
+            }
+        }
+        else if (comm.size() > 1)
+        {
+            esutil::Error err(system->comm);
+            err.setException("P3M on several CPUs needs a DomainDecomposition storage");
+            err.checkException();
+        }
+
+        // the charges of a particle reach P mesh points, and particles may leave their
+        // domain by up to the skin before they are resorted
+        Int3D newHalo;
+        for (int i = 0; i < 3; i++)
+        {
+            newHalo[i] = P + int(ceil(system->getSkin() * M[i] / sysL[i])) + 1;
+        }
+
+        bool newFFT = !fft || fftMesh != M || localBox.lo != lo || localBox.hi != hi;
+        if (newFFT)
+        {
+            localBox = esutil::MeshBox(lo, hi);
 
-        // TODO check double use in common part
-        g_ca = vector<Int3D>(0, Int3D(0));
+            // the plans are measured once per mesh layout, the wisdom file makes this
+            // cheap for repeated runs
+            if (!wisdomFile.empty()) esutil::ParallelFFT::importWisdom(comm, wisdomFile);
+            fft = std::make_shared<esutil::ParallelFFT>(comm, M, localBox, true, FFTW_MEASURE);
+            if (!wisdomFile.empty()) esutil::ParallelFFT::exportWisdom(comm, wisdomFile);
+            fftMesh = M;
 
-        q_l = vector<vector<real> >(nParticles + 1, vector<real>(MMM, 0.0));
+            rho = vector<real>(localBox.size(), 0.0);
+            field = vector<real>(localBox.size(), 0.0);
+        }
+        if (newFFT || newHalo != halo)
+        {
+            halo = newHalo;
+            extBox = esutil::MeshBox(lo - halo, hi + halo);
+            haloToOwner = esutil::MeshRemap(comm, extBox, localBox, M, true);
+            ownerToHalo = esutil::MeshRemap(comm, localBox, extBox, M, true);
 
-        // force specific
-        phi = vector<vector<dcomplex> >(3, vector<dcomplex>(MMM, dcomplex(0.0)));
+            rho_ext = vector<real>(extBox.size(), 0.0);
+            field_ext = vector<vector<real> >(analytic ? 1 : 3, vector<real>(extBox.size(), 0.0));
+        }
     }
 
     // get the current particle number on the current node
@@ -271,6 +346,7 @@ public:
             {
                 // precalc_interp_caf[j][i+interpolation] = asignment_f2(j, x, P);
                 precalc_interp_caf[j][i + interpolation] = asignment_f1(x, j, P);
+                precalc_interp_dcaf[j][i + interpolation] = asignment_df1(x, j, P);
             }
         }
     }
@@ -293,23 +369,30 @@ public:
     void gen_mesh(CellList realCells) {}
     void assign_charge_for_single_particle(real q, Real3D particle_pos) {}
 
-    // calculates the optimal influence function
+    // calculates the optimal influence function on the local k-space points
     void calc_opt_influence_function()
     {
         real coef = 2.0 * MMM / (sysL[0] * sysL[1]);
 
+        const esutil::MeshBox& kBox = fft->getOutBox();
         real denom;
         Real3D nom, D;
         Int3D i;
-        for (i[0] = 0; i[0] < M[0]; i[0]++)
+        for (i[0] = kBox.lo[0]; i[0] < kBox.hi[0]; i[0]++)
         {
-            for (i[1] = 0; i[1] < M[1]; i[1]++)
+            for (i[1] = kBox.lo[1]; i[1] < kBox.hi[1]; i[1]++)
             {
-                for (i[2] = 0; i[2] < M[2]; i[2]++)
+                for (i[2] = kBox.lo[2]; i[2] < kBox.hi[2]; i[2]++)
                 {
-                    int indx = map_indx[i[0]][i[1]][i[2]];
+                    size_t indx = kBox.index(i);
                     if (i == Int3D(0))
                         gf[indx] = 0.0;
+                    else if (analytic)
+                    {
+                        real nom_ad, k2sum;
+                        aliasing_sum_ad(i, &nom_ad, &denom, &k2sum);
+                        gf[indx] = (k2sum > 1e-10) ? coef * nom_ad / (denom * k2sum) : 0.0;
+                    }
                     else
                     {
                         aliasing_sum(i, &nom, &denom);
@@ -334,7 +417,6 @@ public:
             mesh_shift[i][M[i] / 2] = 0.0;
         }
     }
-
     void aliasing_sum(Int3D i, Real3D* nominator, real* denominator)
     {
         /*
@@ -387,6 +469,49 @@ public:
         }
     }
 
+    /* aliasing sums of the optimal influence function for analytic differentiation
+       (Ballenegger, Cerda, Holm, JCTC 8, 936 (2012)): the gradient of the assignment
+       function replaces the differential operator D, which gives
+       G(k) = sum_m U_m^2 R_m / (sum_m U_m^2 * sum_m U_m^2 k_m^2) with the reference
+       potential R_m ~ exp(-k_m^2/4alpha^2), i.e. nominator = sum_m U_m^2 R_m and
+       k2sum = sum_m U_m^2 k_m^2 in mesh units. */
+    void aliasing_sum_ad(Int3D i, real* nominator, real* denominator, real* k2sum)
+    {
+        Real3D ms(mesh_shift[0][i[0]], mesh_shift[1][i[1]], mesh_shift[2][i[2]]);
+
+        Real3D Minv;
+        for (int l = 0; l < 3; l++) Minv[l] = 1.0 / (real)M[l];
+
+        real ftr = pow(M_PIl / (alpha * sysL[0]), 2);
+
+        *nominator = *denominator = *k2sum = 0.0;
+
+        Int3D ijk(0);
+        Real3D nml(0.0), x(0.0);
+        for (ijk[0] = -brillouin; ijk[0] <= brillouin; ijk[0]++)
+        {
+            for (ijk[1] = -brillouin; ijk[1] <= brillouin; ijk[1]++)
+            {
+                for (ijk[2] = -brillouin; ijk[2] <= brillouin; ijk[2]++)
+                {
+                    for (int l = 0; l < 3; l++)
+                    {
+                        nml[l] = ms[l] + M[l] * ijk[l];
+                        x[l] = Minv[l] * nml[l];
+                    }
+
+                    real sc = pow(sinc(x), 2.0 * P);
+                    real nml2 = nml.sqr();
+                    real e = ftr * nml2;
+
+                    *denominator += sc;
+                    *k2sum += sc * nml2;
+                    *nominator += (e < 30) ? sc * exp(-e) : 0.0;
+                }
+            }
+        }
+    }
+
     /**
      *  taken from Deserno's code
      *  Calculates the sinc-function as sin(PI*x)/(PI*x).
@@ -437,33 +562,78 @@ public:
         return out;
     }
 
-    void set_fftw_array() { in_array = (fftw_complex*)fftw_malloc(MMM * sizeof(fftw_complex)); }
-    void set_plan_frw()
+    // first mesh point of the charge assignment of a particle, in coordinates of the
+    // extended mesh, and the index of its assignment weights; false if the assignment
+    // does not fit into the local extended mesh
+    bool assignment_point(const Real3D& ppos, real modadd1, real modadd2, Int3D& Gi, Int3D& arg)
     {
-        plan = fftw_plan_dft(3, MM, in_array, in_array, FFTW_FORWARD, FFTW_ESTIMATE);
-    }
-    void set_plan_bcw()
-    {
-        plan = fftw_plan_dft(3, MM, in_array, in_array, FFTW_BACKWARD, FFTW_ESTIMATE);
+        real _2interp = 2.0 * interpolation;
+        for (int i = 0; i < 3; i++)
+        {
+            real d1 = ppos[i] * M[i] / sysL[i] + modadd1;
+            Gi[i] = int(floor(d1 + modadd2)) - (P - 1) / 2;
+            arg[i] = int((d1 - dround(d1) + 0.5) * _2interp);
+
+            // particles near the box border may be assigned to a periodic image
+            if (Gi[i] < extBox.lo[i])
+                Gi[i] += M[i];
+            else if (Gi[i] + P > extBox.hi[i])
+                Gi[i] -= M[i];
+        }
+        return extBox.contains(Gi) && extBox.contains(Gi + Int3D(P - 1));
     }
-    void clean_fftw()
+
+    // odd and even interpolation order
+    void assignment_shift(real& modadd1, real& modadd2)
     {
-        fftw_destroy_plan(plan);
-        in_array = NULL;
-        fftw_free(in_array);
+        modadd1 = 0;
+        modadd2 = 0;
+        switch (P)
+        {
+            case 2:
+            case 4:
+            case 6:
+            {
+                modadd1 = 0.5;
+                modadd2 = -0.5;
+            }
+            break;
+            case 1:
+            case 3:
+            case 5:
+            case 7:
+            {
+                modadd1 = 0.0;
+                modadd2 = 0.5;
+            }
+            break;
+        }
     }
 
     real _computeEnergy(CellList realCells)
     {
         common_part(realCells, 1);
 
-        real energy = 0.0;
-
-        for (int i = 0; i < MMM; i++)
+        // only k_z >= 0 is stored, the other half of the spectrum is the complex conjugate
+        real node_energy = 0.0;
+        const esutil::MeshBox& kBox = fft->getOutBox();
+        Int3D i;
+        for (i[0] = kBox.lo[0]; i[0] < kBox.hi[0]; i[0]++)
         {
-            energy += gf[i] * norm(QQQ[i]);
+            for (i[1] = kBox.lo[1]; i[1] < kBox.hi[1]; i[1]++)
+            {
+                for (i[2] = kBox.lo[2]; i[2] < kBox.hi[2]; i[2]++)
+                {
+                    size_t indx = kBox.index(i);
+                    real mult = (i[2] == 0 || 2 * i[2] == M[2]) ? 1.0 : 2.0;
+                    node_energy += mult * gf[indx] * norm(QQQ[indx]);
+                }
+            }
         }
 
+        real energy = 0.0;
+        mpi::all_reduce(*system->comm, node_energy, energy, plus<real>());
+
         // TODO sysL[0]?? what about [1] and [2]?
         energy *= (C_pref * sysL[0] / (4.0 * MMM * M_PIl));
 
@@ -477,86 +647,82 @@ public:
     // TODO get rid of iii at the end
     void common_part(CellList realCells, int iii)
     {
-        initialize();
+        real time = timer.getElapsedTime();
 
-        real _2interp = 2.0 * interpolation;
-        // TODO assignshift probably should be [3]
-        int assignshift = M[0] - floor((real)(P - 1) / 2.0);
+        // the halo depends on the box size and the skin
+        setupMesh();
 
-        real modadd1 = 0;
-        real modadd2 = 0;
-        // odd and even interpolation order
-        switch (P)
-        {
-            case 2:
-            case 4:
-            case 6:
-            {
-                modadd1 = 0.5;
-                modadd2 = -0.5;
-            }
-            break;
-            case 1:
-            case 3:
-            case 5:
-            case 7:
-            {
-                modadd1 = 0.0;
-                modadd2 = 0.5;
-            }
-            break;
-        }
+        real modadd1, modadd2;
+        assignment_shift(modadd1, modadd2);
 
-        g_ca.clear();
-        g_ca = vector<Int3D>(nParticles + 1, Int3D(0));
-        QQQ.clear();
-        QQQ = vector<dcomplex>(MMM, dcomplex(0.0));  // MMM+1?
+        // the arena only grows, so it is reused as long as the particle number is stable
+        const int PPP = P * P * P;
+        getParticleNumber();
+        if (ca_index.size() < size_t(nParticles)) ca_index.resize(nParticles);
+        if (ca_weight.size() < size_t(nParticles) * PPP) ca_weight.resize(size_t(nParticles) * PPP);
+        if (analytic && ca_arg.size() < size_t(nParticles)) ca_arg.resize(nParticles);
 
+        fill(rho_ext.begin(), rho_ext.end(), 0.0);
+
+        // strides of the extended mesh, which is stored in x, y, z order
+        const size_t sy = extBox.extent(2);
+        const size_t sx = extBox.extent(1) * sy;
+
+        // all CPUs check for errors once, an exception of one CPU alone would hang the others
+        esutil::Error err(system->comm);
         Int3D Gi, arg;
-        for (iterator::CellListIterator it(realCells); it.isValid(); ++it)
+        size_t n = 0;
+        for (iterator::CellListIterator it(realCells); it.isValid(); ++it, ++n)
         {
             Particle& p = *it;
-            Real3D ppos = p.position();
-            Real3D d1;
-            for (int i = 0; i < 3; i++)
+            if (!assignment_point(p.position(), modadd1, modadd2, Gi, arg))
             {
-                d1[i] = ppos[i] * M[i] / sysL[i] + modadd1;
+                stringstream msg;
+                msg << "P3M: particle at " << p.position() << " is outside of the local mesh";
+                err.setException(msg.str());
+                break;
             }
-            Gi = Int3D(d1 + modadd2) + assignshift;
-            arg = Int3D((d1 - dround(d1) + 0.5) * _2interp);
 
-            // specific for force !!!!!!!!
-            g_ca[p.id()] = Gi;
+            // Calculate the mesh based charges and keep them for the force interpolation
+            const size_t base = extBox.index(Gi);
+            real* q_l = &ca_weight[n * PPP];
+            ca_index[n] = base;
+            if (analytic) ca_arg[n] = arg;
 
-            // Calculate the mesh based charges
             real T1, T2, T3;
             for (int i = 0; i < P; i++)
             {
-                int xpos = (Gi[0] + i) % M[0];
                 T1 = p.q() * precalc_interp_caf[i][arg[0]];
                 for (int j = 0; j < P; j++)
                 {
-                    int ypos = (Gi[1] + j) % M[1];
                     T2 = T1 * precalc_interp_caf[j][arg[1]];
+                    size_t indx = base + i * sx + j * sy;
                     for (int k = 0; k < P; k++)
                     {
-                        int zpos = (Gi[2] + k) % M[2];
                         T3 = T2 * precalc_interp_caf[k][arg[2]];
 
-                        int indx = map_indx[xpos][ypos][zpos];
-
-                        // specific for force !!!!!!!!
-                        q_l[p.id()][indx] = T3;
-
-                        QQQ[indx] += dcomplex(T3, 0.0);
+                        *q_l++ = T3;
+                        rho_ext[indx + k] += T3;
                     }
                 }
             }
         }
+        err.checkException();
+        timeAssign += timer.getElapsedTime() - time;
+
+        // add the halo contributions to the owners of the mesh points
+        time = timer.getElapsedTime();
+        fill(rho.begin(), rho.end(), 0.0);
+        haloToOwner.execute(rho_ext.data(), rho.data(), true);
+        timeHalo += timer.getElapsedTime() - time;
 
-        in_array = reinterpret_cast<fftw_complex*>(&QQQ[0]);
-        set_plan_frw();
-        fftw_execute(plan);
+        time = timer.getElapsedTime();
+        copy(rho.begin(), rho.end(), fft->getRealData());
+        fft->forward();
+
+        dcomplex* data = fft->getData();
+        copy(data, data + QQQ.size(), QQQ.begin());
+        timeFFT += timer.getElapsedTime() - time;
     }
 
     // @TODO this function could be void,
@@ -564,60 +730,173 @@ public:
     {
         common_part(realCells, 0);
 
-        // Calculate the supporting arrays phi_?_??:
+        if (analytic)
+            interpolate_ad(realCells);
+        else
+            interpolate_ik(realCells);
+
+        // usual return from espressopp
+        return true;
+    }
+
+    // transform gf * QQQ times the given k-space factor back to the owned mesh and send
+    // it to the halos
+    template <class Factor>
+    void backward_to_halo(Factor factor, vector<real>& out)
+    {
+        real time = timer.getElapsedTime();
+        const esutil::MeshBox& kBox = fft->getOutBox();
+        dcomplex* data = fft->getData();
         Int3D i;
-        for (i[0] = 0; i[0] < M[0]; i[0]++)
+        for (i[0] = kBox.lo[0]; i[0] < kBox.hi[0]; i[0]++)
         {
-            for (i[1] = 0; i[1] < M[1]; i[1]++)
+            for (i[1] = kBox.lo[1]; i[1] < kBox.hi[1]; i[1]++)
             {
-                for (i[2] = 0; i[2] < M[2]; i[2]++)
+                for (i[2] = kBox.lo[2]; i[2] < kBox.hi[2]; i[2]++)
                 {
-                    int indx = map_indx[i[0]][i[1]][i[2]];
-                    dcomplex phi_aux = gf[indx] * swap_complex(conj(QQQ[indx]));
-
-                    for (int ii = 0; ii < 3; ii++) phi[ii][indx] = d_op[ii][i[ii]] * phi_aux;
+                    size_t indx = kBox.index(i);
+                    data[indx] = factor(i) * gf[indx] * QQQ[indx];
                 }
             }
         }
 
+        fft->backward();
+
+        const real* rdata = fft->getRealData();
+        copy(rdata, rdata + field.size(), field.begin());
+        timeFFT += timer.getElapsedTime() - time;
+
+        time = timer.getElapsedTime();
+        ownerToHalo.execute(field.data(), out.data());
+        timeHalo += timer.getElapsedTime() - time;
+    }
+
+    // ik differentiation: the field components i*D_l*phi are transformed separately
+    // and interpolated with the charge assignment weights
+    void interpolate_ik(CellList realCells)
+    {
         for (int l = 0; l < 3; l++)
         {
-            in_array = reinterpret_cast<fftw_complex*>(&phi[l][0]);
-            set_plan_bcw();
-            fftw_execute(plan);
+            const vector<real>& dl = d_op[l];
+            backward_to_halo([&dl, l](const Int3D& i) { return dcomplex(0.0, dl[i[l]]); },
+                             field_ext[l]);
         }
 
+        real time = timer.getElapsedTime();
+        const int PPP = P * P * P;
+        const size_t sy = extBox.extent(2);
+        const size_t sx = extBox.extent(1) * sy;
+        const real* Ex = field_ext[0].data();
+        const real* Ey = field_ext[1].data();
+        const real* Ez = field_ext[2].data();
+
+        // the particles are visited in the same order as in common_part
         real C_MMM_inv = C_pref / (real)MMM;
-        for (iterator::CellListIterator it(realCells); it.isValid(); ++it)
+        size_t n = 0;
+        for (iterator::CellListIterator it(realCells); it.isValid(); ++it, ++n)
         {
             Particle& p = *it;
+            const size_t base = ca_index[n];
+            const real* q_l = &ca_weight[n * PPP];
 
-            int iii = p.id();
             Real3D ff(0.0);
             for (int i = 0; i < P; i++)
             {
-                int xpos = (g_ca[iii][0] + i) % M[0];
                 for (int j = 0; j < P; j++)
                 {
-                    int ypos = (g_ca[iii][1] + j) % M[1];
-                    for (int k = 0; k < P; k++)
+                    size_t indx = base + i * sx + j * sy;
+                    for (int k = 0; k < P; k++, indx++)
                     {
-                        int zpos = (g_ca[iii][2] + k) % M[2];
+                        real q = *q_l++;
+                        ff[0] += q * Ex[indx];
+                        ff[1] += q * Ey[indx];
+                        ff[2] += q * Ez[indx];
+                    }
+                }
+            }
 
-                        int indx = map_indx[xpos][ypos][zpos];
+            p.force() -= C_MMM_inv * ff;
+        }
+        timeInterpolate += timer.getElapsedTime() - time;
+    }
+
+    // analytic differentiation: only the potential is transformed back, the force is
+    // its gradient at the particle, taken from the gradient of the assignment function
+    void interpolate_ad(CellList realCells)
+    {
+        backward_to_halo([](const Int3D&) { return dcomplex(1.0, 0.0); }, field_ext[0]);
+
+        real time = timer.getElapsedTime();
+        const size_t sy = extBox.extent(2);
+        const size_t sx = extBox.extent(1) * sy;
+        const real* phi = field_ext[0].data();
 
-                        Real3D f_add(phi[0][indx].real(), phi[1][indx].real(), phi[2][indx].real());
+        // d/dx of the weights is M/L times the tabulated derivative, and the k-vectors of
+        // the influence function are in units of 2pi/L
+        real C_MMM_inv = C_pref / (real)MMM;
+        Real3D scale;
+        for (int l = 0; l < 3; l++) scale[l] = C_MMM_inv * M[l] / M_2PI;
 
-                        ff += C_MMM_inv * q_l[iii][indx] * f_add;
+        size_t n = 0;
+        for (iterator::CellListIterator it(realCells); it.isValid(); ++it, ++n)
+        {
+            Particle& p = *it;
+            const size_t base = ca_index[n];
+            const Int3D& arg = ca_arg[n];
+
+            Real3D ff(0.0);
+            for (int i = 0; i < P; i++)
+            {
+                real wx = precalc_interp_caf[i][arg[0]];
+                real dx = precalc_interp_dcaf[i][arg[0]];
+                for (int j = 0; j < P; j++)
+                {
+                    real wy = precalc_interp_caf[j][arg[1]];
+                    real dy = precalc_interp_dcaf[j][arg[1]];
+                    size_t indx = base + i * sx + j * sy;
+                    for (int k = 0; k < P; k++, indx++)
+                    {
+                        real wz = precalc_interp_caf[k][arg[2]];
+                        real dz = precalc_interp_dcaf[k][arg[2]];
+                        ff[0] += dx * wy * wz * phi[indx];
+                        ff[1] += wx * dy * wz * phi[indx];
+                        ff[2] += wx * wy * dz * phi[indx];
                     }
                 }
             }
 
-            p.force() -= ff;
+            for (int l = 0; l < 3; l++) p.force()[l] -= p.q() * scale[l] * ff[l];
         }
+        timeInterpolate += timer.getElapsedTime() - time;
+    }
 
-        // usual return from espressopp
-        return true;
+    void resetTimers()
+    {
+        timer.reset();
+        timeAssign = 0.0;
+        timeHalo = 0.0;
+        timeFFT = 0.0;
+        timeInterpolate = 0.0;
+    }
+
+    void loadTimers(real* t)
+    {
+        t[0] = timeAssign;
+        t[1] = timeHalo;
+        t[2] = timeFFT;
+        t[3] = timeInterpolate;
+    }
+
+    // memory in bytes used by the meshes and the charge assignment arena of this rank
+    size_t getMemory() const
+    {
+        size_t mem = (rho_ext.size() + rho.size() + field.size() + gf.size()) * sizeof(real);
+        for (const vector<real>& f : field_ext) mem += f.size() * sizeof(real);
+        mem += QQQ.size() * sizeof(dcomplex);
+        mem += ca_weight.size() * sizeof(real) + ca_index.size() * sizeof(size_t);
+        mem += ca_arg.size() * sizeof(Int3D);
+        if (fft) mem += fft->getMemory();
+        return mem;
     }
 
     dcomplex swap_complex(dcomplex C) { return dcomplex(C.imag(), C.real()); }
@@ -686,6 +965,19 @@ public:
         return res;
     }
 
+    // derivative of asignment_f1 with respect to x
+    real asignment_df1(real x, int k, int P)
+    {
+        real res = 0.0;
+        real xx = 1.0;
+        for (int i = 1; i < P; i++)
+        {
+            res += i * af_coef[P][k][i] * xx;
+            xx *= x;
+        }
+        return res;
+    }
+
     real asignment_f2(int i, real x, int P)
     {
         mpi::communicator communic = *system->comm;
@@ -38,6 +38,22 @@ Example:
 
 **!IMPORTANT** Coulomb interaction needs `R` space part as well CoulombRSpace_.
 
+The mesh is distributed over the CPUs in the same way as the particles, which requires
+a DomainDecomposition storage when running on several CPUs. Every CPU assigns the
+charges of its particles to its part of the mesh and a halo around it, and the mesh is
+transformed by a parallel FFT, so the `K` space cost decreases with the number of CPUs.
+
+The charge density is transformed by real-to-complex FFTs. The forces are obtained
+by ik differentiation (``differentiation='ik'``, three backward FFTs) or by analytic
+differentiation of the charge assignment function (``differentiation='ad'``, one
+backward FFT, with the matching optimal influence function). The FFT plans are
+measured when the mesh is set up; pass ``wisdom='p3m.wisdom'`` to keep the FFTW wisdom
+in a file, so that later runs with the same mesh start without planning.
+
+The time spent in charge assignment, halo exchange, FFT and force interpolation is
+returned by ``getTimers()`` (reset with ``resetTimers()``), and ``getMemory()`` returns
+the bytes used by the meshes on each CPU.
+
 .. _CoulombRSpace: espressopp.interaction.CoulombRSpace.html
 
 Definition:
@@ -90,7 +106,7 @@ Adding the interaction to the system:
 
 
 
-.. function:: espressopp.interaction.CoulombKSpaceP3M(system, C_pref, alpha, M, P, rcut, interpolation)
+.. function:: espressopp.interaction.CoulombKSpaceP3M(system, C_pref, alpha, M, P, rcut, interpolation, differentiation, wisdom)
 
                 :param system:
                 :param C_pref:
@@ -99,6 +115,8 @@ Adding the interaction to the system:
                 :param P:
                 :param rcut:
                 :param interpolation: (default: 200192)
+                :param differentiation: 'ik' or 'ad' (default: 'ik')
+                :param wisdom: file for the FFTW wisdom (default: '', none)
                 :type system:
                 :type C_pref:
                 :type alpha:
@@ -106,6 +124,8 @@ Adding the interaction to the system:
                 :type P:
                 :type rcut:
                 :type interpolation: int
+                :type differentiation: str
+                :type wisdom: str
 
 .. function:: espressopp.interaction.CellListCoulombKSpaceP3M(storage, potential)
 
@@ -129,11 +149,15 @@ from _espressopp import interaction_CoulombKSpaceP3M, \
                       interaction_CellListCoulombKSpaceP3M
 
 class CoulombKSpaceP3MLocal(PotentialLocal, interaction_CoulombKSpaceP3M):
-    def __init__(self, system, C_pref, alpha, M, P, rcut, interpolation = 200192):
+    def __init__(self, system, C_pref, alpha, M, P, rcut, interpolation = 200192,
+                 differentiation = 'ik', wisdom = ''):
 
+        if differentiation not in ('ik', 'ad'):
+            raise ValueError("differentiation has to be 'ik' or 'ad'")
 
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
-            cxxinit(self, interaction_CoulombKSpaceP3M, system, C_pref, alpha, M, P, rcut, interpolation)
+            cxxinit(self, interaction_CoulombKSpaceP3M, system, C_pref, alpha, M, P, rcut, interpolation,
+                    differentiation == 'ad', wisdom)
 
 class CellListCoulombKSpaceP3MLocal(InteractionLocal, interaction_CellListCoulombKSpaceP3M):
     def __init__(self, storage, potential):
@@ -149,7 +173,9 @@ if pmi.isController:
     class CoulombKSpaceP3M(Potential):
         pmiproxydefs = dict(
           cls = 'espressopp.interaction.CoulombKSpaceP3MLocal',
-          pmiproperty = ['prefactor']  #, 'alpha', 'kmax'
+          pmiproperty = ['prefactor'],  #, 'alpha', 'kmax'
+          pmicall = ['resetTimers'],
+          pmiinvoke = ['getTimers', 'getMemory']
         )
 
     class CellListCoulombKSpaceP3M(Interaction, metaclass=pmi.Proxy):
@@ -53,6 +53,11 @@ private:
 public:
     static void registerPython();
 
+    // the distance based versions cannot apply the charges, but templates that instantiate
+    // them for all potentials need them to be visible
+    using PotentialTemplate<CoulombRSpace>::_computeEnergy;
+    using PotentialTemplate<CoulombRSpace>::_computeForce;
+
     // empty constructor
     CoulombRSpace() : alpha(0.0), prefactor(0.0)
     {
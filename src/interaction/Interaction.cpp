@@ -22,6 +22,7 @@
 
 #include <python.hpp>
 #include "Interaction.hpp"
+#include "mpi.hpp"
 
 namespace espressopp
 {
@@ -29,6 +30,21 @@ namespace interaction
 {
 LOG4ESPP_LOGGER(Interaction::theLogger, "Interaction");
 
+bool Interaction::getTally(real& energy, Tensor& virial)
+{
+    // all CPUs tally the same passes
+    if (!tallyValid) return false;
+
+    real local[7], global[7];
+    local[0] = tallyEnergy;
+    for (int i = 0; i < 6; i++) local[i + 1] = tallyVirial[i];
+    boost::mpi::all_reduce(*mpiWorld, local, 7, global, std::plus<real>());
+
+    energy = global[0];
+    for (int i = 0; i < 6; i++) virial[i] = global[i + 1];
+    return true;
+}
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
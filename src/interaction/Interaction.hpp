@@ -26,6 +26,7 @@
 
 #include "types.hpp"
 #include "logging.hpp"
+#include "Tensor.hpp"
 #include "esutil/ESPPIterator.hpp"
 
 namespace espressopp
@@ -50,6 +51,11 @@ class Interaction
 public:
     virtual ~Interaction(){};
     virtual void addForces() = 0;
+    /** addForces() split in two for overlapping it with the ghost update: the first
+        part only uses real particles and runs while the ghosts are in flight, the
+        second part does the rest. By default, all is done in the second part. */
+    virtual void addForcesBeforeGhosts() {}
+    virtual void addForcesAfterGhosts() { addForces(); }
     virtual real computeEnergy() = 0;
     virtual real computeEnergyDeriv() = 0;
     virtual real computeEnergyAA() = 0;
@@ -69,9 +75,39 @@ public:
     virtual real getMaxCutoff() = 0;
     virtual int bondType() = 0;
 
+    /** Tally mode: the next force pass also sums up the energy and the virial
+        tensor, so that the analysis does not need passes of its own. Interactions
+        that do not support it ignore the request. */
+    void requestTally() { tallyRequested = true; }
+    /** The particles have moved, so the last tally is outdated. */
+    void invalidateTally() { tallyValid = false; }
+    /** Energy and virial tensor of the last tallied force pass, summed over all
+        CPUs. Returns false if there is none for the current positions. */
+    bool getTally(real& energy, Tensor& virial);
+
     static void registerPython();
 
 protected:
+    /** Called at the start of a force pass, returns whether it tallies. */
+    bool beginTally()
+    {
+        tallying = tallyRequested;
+        tallyRequested = false;
+        tallyValid = false;
+        tallyEnergy = 0.0;
+        tallyVirial = Tensor(0.0);
+        return tallying;
+    }
+    /** Called when all pairs of the force pass are done. */
+    void endTally() { tallyValid = tallying; }
+
+    bool tallyRequested = false;
+    bool tallying = false;
+    bool tallyValid = false;
+    // sums over the local pairs of the last tallied force pass
+    real tallyEnergy = 0.0;
+    Tensor tallyVirial = Tensor(0.0);
+
     /** Logger */
     static LOG4ESPP_DECL_LOGGER(theLogger);
 };
@@ -39,6 +39,11 @@ public:
     virtual real getEnergy(real r) const = 0;
     virtual real getForce(real r) const = 0;
     virtual void read(mpi::communicator comm, const char* file) = 0;
+
+    /** Range and number of the equidistant values read from the file */
+    virtual real getInner() const = 0;
+    virtual real getOuter() const = 0;
+    virtual int getN() const = 0;
 };  // class Interpolation
 
 template <class Derived>
@@ -39,6 +39,10 @@ public:
     real getEnergyRaw(real r) const;
     real getForceRaw(real r) const;
 
+    real getInner() const { return inner; }
+    real getOuter() const { return outer; }
+    int getN() const { return N; }
+
 protected:
     static LOG4ESPP_DECL_LOGGER(theLogger);
 
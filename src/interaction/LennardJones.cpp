@@ -25,7 +25,9 @@
 #include "Tabulated.hpp"
 #include "Harmonic.hpp"
 #include "ReactionFieldGeneralized.hpp"
+#include "CoulombRSpace.hpp"
 #include "VerletListInteractionTemplate.hpp"
+#include "VerletListMultiInteractionTemplate.hpp"
 #include "VerletListAdressInteractionTemplate.hpp"
 #include "VerletListAdressATInteractionTemplate.hpp"
 #include "VerletListAdressCGInteractionTemplate.hpp"
@@ -45,6 +47,12 @@ namespace espressopp
 namespace interaction
 {
 typedef class VerletListInteractionTemplate<LennardJones> VerletListLennardJones;
+typedef class VerletListMultiInteractionTemplate<LennardJones, ReactionFieldGeneralized>
+    VerletListLennardJonesReacFieldGen;
+typedef class VerletListMultiInteractionTemplate<LennardJones, CoulombRSpace>
+    VerletListLennardJonesCoulombRSpace;
+typedef class VerletListMultiInteractionTemplate<LennardJones, CoulombRSpace, Tabulated>
+    VerletListLJCoulombRSpaceTab;
 typedef class VerletListAdressInteractionTemplate<LennardJones, Tabulated>
     VerletListAdressLennardJones;
 typedef class VerletListAdressATInteractionTemplate<LennardJones> VerletListAdressATLennardJones;
@@ -108,6 +116,25 @@ void LennardJones::registerPython()
         .def("setPotential", &VerletListLennardJones::setPotential)
         .def("getPotential", &VerletListLennardJones::getPotentialPtr);
 
+    class_<VerletListLennardJonesReacFieldGen, bases<Interaction> >(
+        "interaction_VerletListLennardJonesReacFieldGen", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLennardJonesReacFieldGen::getVerletList)
+        .def("setPotential1", &VerletListLennardJonesReacFieldGen::setPotential<0>)
+        .def("setPotential2", &VerletListLennardJonesReacFieldGen::setPotential<1>);
+
+    class_<VerletListLennardJonesCoulombRSpace, bases<Interaction> >(
+        "interaction_VerletListLennardJonesCoulombRSpace", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLennardJonesCoulombRSpace::getVerletList)
+        .def("setPotential1", &VerletListLennardJonesCoulombRSpace::setPotential<0>)
+        .def("setPotential2", &VerletListLennardJonesCoulombRSpace::setPotential<1>);
+
+    class_<VerletListLJCoulombRSpaceTab, bases<Interaction> >(
+        "interaction_VerletListLJCoulombRSpaceTab", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLJCoulombRSpaceTab::getVerletList)
+        .def("setPotential1", &VerletListLJCoulombRSpaceTab::setPotential<0>)
+        .def("setPotential2", &VerletListLJCoulombRSpaceTab::setPotential<1>)
+        .def("setPotential3", &VerletListLJCoulombRSpaceTab::setPotential<2>);
+
     class_<VerletListAdressATLennardJones, bases<Interaction> >(
         "interaction_VerletListAdressATLennardJones",
         init<std::shared_ptr<VerletListAdress>, std::shared_ptr<FixedTupleListAdress> >())
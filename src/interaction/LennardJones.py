@@ -75,6 +75,113 @@ espressopp.interaction.LennardJones
         :type type2: int
         :type potential: std::shared_ptr<LennardJones>
 
+.. function:: espressopp.interaction.VerletListLennardJonesReacFieldGen(vl)
+
+        Defines a verletlist-based interaction using both a LennardJones potential and a ReactionFieldGeneralized potential. Both are computed in one loop over the particle pairs.
+
+        :param vl: Verletlist object
+        :type vl: shared_ptr<VerletList>
+
+.. function:: espressopp.interaction.VerletListLennardJonesReacFieldGen.setPotential1(type1, type2, potential)
+
+        Sets the LennardJones potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: LennardJones potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<LennardJones>
+
+.. function:: espressopp.interaction.VerletListLennardJonesReacFieldGen.setPotential2(type1, type2, potential)
+
+        Sets the ReactionFieldGeneralized potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: ReactionFieldGeneralized potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<ReactionFieldGeneralized>
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace(vl)
+
+        Defines a verletlist-based interaction using both a LennardJones potential and the real space part of the Ewald sum (CoulombRSpace). Both are computed in one loop over the particle pairs.
+
+        :param vl: Verletlist object
+        :type vl: shared_ptr<VerletList>
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace.setPotential1(type1, type2, potential)
+
+        Sets the LennardJones potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: LennardJones potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<LennardJones>
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace.setPotential2(type1, type2, potential)
+
+        Sets the CoulombRSpace potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: CoulombRSpace potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<CoulombRSpace>
+
+.. function:: espressopp.interaction.VerletListLJCoulombRSpaceTab(vl)
+
+        Defines a verletlist-based interaction using a LennardJones, a CoulombRSpace and a Tabulated potential, all computed in one loop over the particle pairs. Type pairs without one of the potentials skip it.
+
+        Example:
+
+        >>> vl = espressopp.VerletList(system, cutoff=rc)
+        >>> inter = espressopp.interaction.VerletListLJCoulombRSpaceTab(vl)
+        >>> inter.setPotential1(0, 0, espressopp.interaction.LennardJones(1.0, 1.0, rc))
+        >>> inter.setPotential2(0, 0, espressopp.interaction.CoulombRSpace(1.0, alpha, rc))
+        >>> inter.setPotential3(0, 1, espressopp.interaction.Tabulated(2, 'table.pot', rc))
+        >>> system.addInteraction(inter)
+
+        :param vl: Verletlist object
+        :type vl: shared_ptr<VerletList>
+
+.. function:: espressopp.interaction.VerletListLJCoulombRSpaceTab.setPotential1(type1, type2, potential)
+
+        Sets the LennardJones potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: LennardJones potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<LennardJones>
+
+.. function:: espressopp.interaction.VerletListLJCoulombRSpaceTab.setPotential2(type1, type2, potential)
+
+        Sets the CoulombRSpace potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: CoulombRSpace potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<CoulombRSpace>
+
+.. function:: espressopp.interaction.VerletListLJCoulombRSpaceTab.setPotential3(type1, type2, potential)
+
+        Sets the Tabulated potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: Tabulated potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<Tabulated>
+
 .. function:: espressopp.interaction.VerletListAdressLennardJones(vl, fixedtupleList)
 
         Defines a verletlist-based AdResS interaction using a LennardJones potential for the AT and a tabulated potential for the CG interaction.
@@ -698,6 +805,9 @@ from espressopp.interaction.Potential import *
 from espressopp.interaction.Interaction import *
 from _espressopp import interaction_LennardJones, \
                       interaction_VerletListLennardJones, \
+                      interaction_VerletListLennardJonesReacFieldGen, \
+                      interaction_VerletListLennardJonesCoulombRSpace, \
+                      interaction_VerletListLJCoulombRSpaceTab, \
                       interaction_VerletListAdressLennardJones, \
                       interaction_VerletListAdressATLennardJones, \
                       interaction_VerletListAdressATLenJonesReacFieldGen, \
@@ -749,6 +859,64 @@ class VerletListLennardJonesLocal(InteractionLocal, interaction_VerletListLennar
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             return self.cxxclass.getVerletList(self)
 
+class VerletListLennardJonesReacFieldGenLocal(InteractionLocal, interaction_VerletListLennardJonesReacFieldGen):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListLennardJonesReacFieldGen, vl)
+
+    def setPotential1(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential1(self, type1, type2, potential)
+
+    def setPotential2(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential2(self, type1, type2, potential)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+class VerletListLennardJonesCoulombRSpaceLocal(InteractionLocal, interaction_VerletListLennardJonesCoulombRSpace):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListLennardJonesCoulombRSpace, vl)
+
+    def setPotential1(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential1(self, type1, type2, potential)
+
+    def setPotential2(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential2(self, type1, type2, potential)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+class VerletListLJCoulombRSpaceTabLocal(InteractionLocal, interaction_VerletListLJCoulombRSpaceTab):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListLJCoulombRSpaceTab, vl)
+
+    def setPotential1(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential1(self, type1, type2, potential)
+
+    def setPotential2(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential2(self, type1, type2, potential)
+
+    def setPotential3(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential3(self, type1, type2, potential)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
 class VerletListAdressATLennardJonesLocal(InteractionLocal, interaction_VerletListAdressATLennardJones):
 
     def __init__(self, vl, fixedtupleList):
@@ -1073,6 +1241,24 @@ if pmi.isController:
             pmicall = ['setPotential', 'getPotential', 'getVerletList']
             )
 
+    class VerletListLennardJonesReacFieldGen(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListLennardJonesReacFieldGenLocal',
+            pmicall = ['setPotential1', 'setPotential2', 'getVerletList']
+            )
+
+    class VerletListLennardJonesCoulombRSpace(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListLennardJonesCoulombRSpaceLocal',
+            pmicall = ['setPotential1', 'setPotential2', 'getVerletList']
+            )
+
+    class VerletListLJCoulombRSpaceTab(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListLJCoulombRSpaceTabLocal',
+            pmicall = ['setPotential1', 'setPotential2', 'setPotential3', 'getVerletList']
+            )
+
     class VerletListAdressATLennardJones(Interaction, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
             cls =  'espressopp.interaction.VerletListAdressATLennardJonesLocal',
@@ -69,6 +69,11 @@ private:
 public:
     static void registerPython();
 
+    // the distance based versions cannot apply the charges, but templates that instantiate
+    // them for all potentials need them to be visible
+    using PotentialTemplate<ReactionFieldGeneralized>::_computeEnergy;
+    using PotentialTemplate<ReactionFieldGeneralized>::_computeForce;
+
     ReactionFieldGeneralized() : prefactor(0.0), kappa(0.0), epsilon1(1.0), epsilon2(80.0), rc(1.0)
     {
         setShift(0.0);
@@ -116,6 +121,10 @@ public:
     }
     real getPrefactor() const { return prefactor; }
 
+    // coefficients of the force and energy, for kernels that apply them to the charges
+    real getB1() const { return B1; }
+    real getCrf() const { return crf; }
+
     real _computeEnergy(const Particle& p1, const Particle& p2) const
     {
         Real3D dist = p1.position() - p2.position();
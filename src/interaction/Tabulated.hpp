@@ -89,6 +89,9 @@ public:
     /** Getter for the filename. */
     const char* getFilename() const { return filename.c_str(); }
 
+    /** Getter for the interpolation table, NULL as long as no file is read. */
+    std::shared_ptr<Interpolation> getTable() const { return table; }
+
     real _computeEnergySqrRaw(real distSqr) const
     {
         // make an interpolation
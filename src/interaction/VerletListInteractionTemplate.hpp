@@ -35,6 +35,7 @@
 #include "Particle.hpp"
 #include "VerletList.hpp"
 #include "esutil/Array2D.hpp"
+#include "esutil/Threads.hpp"
 #include "bc/BC.hpp"
 
 #include "storage/Storage.hpp"
@@ -67,6 +68,7 @@ public:
         // typeX+1 because i<ntypes
         ntypes = std::max(ntypes, std::max(type1 + 1, type2 + 1));
         potentialArray.at(type1, type2) = potential;
+        invalidateTally();
         LOG4ESPP_INFO(_Potential::theLogger,
                       "added potential for type1=" << type1 << " type2=" << type2);
         if (type1 != type2)
@@ -88,6 +90,8 @@ public:
     }
 
     virtual void addForces();
+    virtual void addForcesBeforeGhosts();
+    virtual void addForcesAfterGhosts();
     virtual real computeEnergy();
     virtual real computeEnergyDeriv();
     virtual real computeEnergyAA();
@@ -103,9 +107,25 @@ public:
     virtual int bondType() { return Nonbonded; }
 
 protected:
+    /** Force loop split over the threads of this rank. Each thread sums the forces of its
+        share of the pairs into its own slot buffer, the buffers are reduced per slot. */
+    template <bool TALLY>
+    void addForcesThreaded();
+    /// force loop over the pairs [begin, end), with the energy and virial if TALLY
+    template <bool TALLY>
+    void addForcesRange(size_t begin, size_t end);
+    /// whether the pairs without ghosts are computed separately
+    bool splitsGhostPairs()
+    {
+        return verletList->getNumRealPairs() > 0 && !(verletList->getSystemRef().ifViscosity &&
+                                                      verletList->getSystemRef().shearOffset != .0);
+    }
+
     int ntypes;
     std::shared_ptr<VerletList> verletList;
     esutil::Array2D<Potential, esutil::enlarge> potentialArray;
+    // per-thread force buffers, indexed by thread * number of slots + slot
+    std::vector<Real3D> threadForces;
     // not needed esutil::Array2D<std::shared_ptr<Potential>, esutil::enlarge> potentialArrayPtr;
 };
 
@@ -119,6 +139,7 @@ inline void VerletListInteractionTemplate<_Potential>::addForces()
 
     int vlmaxtype = verletList->getMaxType();
     Potential max_pot = potentialArray.at(vlmaxtype, vlmaxtype);  // force a resize
+    bool tally = beginTally();
 
     // Uncomment below for analyzing shear simulations
     if (verletList->getSystemRef().ifViscosity && verletList->getSystemRef().shearOffset != .0)
@@ -173,26 +194,129 @@ inline void VerletListInteractionTemplate<_Potential>::addForces()
             }
         }
     }
+    else if (verletList->hasPairSlots())
+    {
+        tally ? addForcesThreaded<true>() : addForcesThreaded<false>();
+        endTally();
+    }
     else
     {
-        for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+        size_t numPairs = verletList->getPairs().size();
+        tally ? addForcesRange<true>(0, numPairs) : addForcesRange<false>(0, numPairs);
+        endTally();
+    }
+}
+
+template <typename _Potential>
+inline void VerletListInteractionTemplate<_Potential>::addForcesBeforeGhosts()
+{
+    if (!splitsGhostPairs()) return;
+
+    int vlmaxtype = verletList->getMaxType();
+    Potential max_pot = potentialArray.at(vlmaxtype, vlmaxtype);  // force a resize
+    size_t numRealPairs = verletList->getNumRealPairs();
+    beginTally() ? addForcesRange<true>(0, numRealPairs) : addForcesRange<false>(0, numRealPairs);
+}
+
+template <typename _Potential>
+inline void VerletListInteractionTemplate<_Potential>::addForcesAfterGhosts()
+{
+    if (!splitsGhostPairs())
+    {
+        addForces();
+        return;
+    }
+    size_t begin = verletList->getNumRealPairs(), end = verletList->getPairs().size();
+    tallying ? addForcesRange<true>(begin, end) : addForcesRange<false>(begin, end);
+    endTally();
+}
+
+template <typename _Potential>
+template <bool TALLY>
+inline void VerletListInteractionTemplate<_Potential>::addForcesRange(size_t begin, size_t end)
+{
+    const PairList& pairs = verletList->getPairs();
+    for (size_t i = begin; i < end; ++i)
+    {
+        Particle& p1 = *pairs[i].first;
+        Particle& p2 = *pairs[i].second;
+        int type1 = p1.type();
+        int type2 = p2.type();
+        const Potential& potential = potentialArray(type1, type2);
+        // std::shared_ptr<Potential> potential = getPotential(type1, type2);
+
+        Real3D force(0.0);
+        if (potential._computeForce(force, p1, p2))
         {
-            Particle& p1 = *it->first;
-            Particle& p2 = *it->second;
-            int type1 = p1.type();
-            int type2 = p2.type();
-            const Potential& potential = potentialArray(type1, type2);
-            // std::shared_ptr<Potential> potential = getPotential(type1, type2);
+            p1.force() += force;
+            p2.force() -= force;
+            if (TALLY) tallyVirial += Tensor(p1.position() - p2.position(), force);
+            LOG4ESPP_TRACE(_Potential::theLogger,
+                           "id1=" << p1.id() << " id2=" << p2.id() << " force=" << force);
+        }
+        if (TALLY) tallyEnergy += potential._computeEnergy(p1, p2);
+    }
+}
+
+template <typename _Potential>
+template <bool TALLY>
+inline void VerletListInteractionTemplate<_Potential>::addForcesThreaded()
+{
+    const PairList& pairs = verletList->getPairs();
+    const std::vector<int>& slots = verletList->getPairSlots();
+    const std::vector<Particle*>& slotParticles = verletList->getSlotParticles();
+    const size_t numPairs = pairs.size();
+    const size_t numSlots = slotParticles.size();
+    const int numThreads = esutil::getMaxThreads();
+    threadForces.resize(numThreads * numSlots);
+
+    ESPP_OMP(omp parallel num_threads(numThreads))
+    {
+        ESPP_OMP(omp for schedule(static))
+        for (size_t i = 0; i < threadForces.size(); i++)
+        {
+            threadForces[i] = Real3D(0.0);
+        }
+
+        Real3D* forces = &threadForces[esutil::getThreadNum() * numSlots];
+        real energy = 0.0;
+        Tensor virial(0.0);
+
+        ESPP_OMP(omp for schedule(static))
+        for (size_t i = 0; i < numPairs; i++)
+        {
+            Particle& p1 = *pairs[i].first;
+            Particle& p2 = *pairs[i].second;
+            const Potential& potential = potentialArray(p1.type(), p2.type());
 
             Real3D force(0.0);
             if (potential._computeForce(force, p1, p2))
             {
-                // if(potential->_computeForce(force, p1, p2)) {
-                p1.force() += force;
-                p2.force() -= force;
-                LOG4ESPP_TRACE(_Potential::theLogger,
-                               "id1=" << p1.id() << " id2=" << p2.id() << " force=" << force);
+                forces[slots[2 * i]] += force;
+                forces[slots[2 * i + 1]] -= force;
+                if (TALLY) virial += Tensor(p1.position() - p2.position(), force);
+            }
+            if (TALLY) energy += potential._computeEnergy(p1, p2);
+        }
+
+        if (TALLY)
+        {
+            ESPP_OMP(omp critical)
+            {
+                tallyEnergy += energy;
+                tallyVirial += virial;
+            }
+        }
+
+        ESPP_OMP(omp for schedule(static))
+        for (size_t slot = 0; slot < numSlots; slot++)
+        {
+            Real3D force(0.0);
+            for (int t = 0; t < numThreads; t++)
+            {
+                force += threadForces[t * numSlots + slot];
             }
+            slotParticles[slot]->force() += force;
         }
     }
 }
@@ -0,0 +1,164 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTERACTION_VERLETLISTMULTIINTERACTIONTEMPLATE_HPP
+#define _INTERACTION_VERLETLISTMULTIINTERACTIONTEMPLATE_HPP
+
+#include <tuple>
+#include <utility>
+
+#include "types.hpp"
+#include "log4espp.hpp"
+#include "Particle.hpp"
+#include "VerletListInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace interaction
+{
+/** Several potentials of one pair of particle types, evaluated one after the
+    other. Only the potentials that were set contribute, the others are skipped
+    without being evaluated.
+*/
+template <typename... _Potentials>
+class MultiPotential
+{
+public:
+    MultiPotential() : active(0) {}
+
+    template <size_t I>
+    using Potential = typename std::tuple_element<I, std::tuple<_Potentials...> >::type;
+
+    template <size_t I>
+    void set(const Potential<I>& potential)
+    {
+        std::get<I>(potentials) = potential;
+        active |= 1 << I;
+    }
+
+    template <size_t I>
+    Potential<I>& get()
+    {
+        return std::get<I>(potentials);
+    }
+
+    real getCutoff() const
+    {
+        real cutoff = 0.0;
+        forEachActive([&](const auto& potential)
+                      { cutoff = std::max(cutoff, potential.getCutoff()); });
+        return cutoff;
+    }
+
+    bool _computeForce(Real3D& force, const Particle& p1, const Particle& p2) const
+    {
+        bool any = false;
+        force = 0.0;
+        forEachActive(
+            [&](const auto& potential)
+            {
+                Real3D f(0.0);
+                if (potential._computeForce(f, p1, p2))
+                {
+                    force += f;
+                    any = true;
+                }
+            });
+        return any;
+    }
+
+    real _computeEnergy(const Particle& p1, const Particle& p2) const
+    {
+        real e = 0.0;
+        forEachActive([&](const auto& potential) { e += potential._computeEnergy(p1, p2); });
+        return e;
+    }
+
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+
+private:
+    /// calls f for every potential that was set, in the order of the template arguments
+    template <class F>
+    void forEachActive(F&& f) const
+    {
+        forEachActive(f, std::index_sequence_for<_Potentials...>());
+    }
+
+    template <class F, size_t... I>
+    void forEachActive(F& f, std::index_sequence<I...>) const
+    {
+        ((active & (1 << I) ? f(std::get<I>(potentials)) : void()), ...);
+    }
+
+    std::tuple<_Potentials...> potentials;
+    int active;  // bit I is set if potential I was set
+};
+
+template <typename... _Potentials>
+LOG4ESPP_LOGGER(MultiPotential<_Potentials...>::theLogger, "MultiPotential");
+
+/** Verlet list interaction with several potentials, e.g. Lennard-Jones, the
+    real space part of the Ewald sum and a tabulated correction. All potentials
+    are evaluated in one loop over the pairs, so the pairs, the particle types and
+    the particles are read once instead of once per potential. The potentials
+    are known at compile time and called without virtual functions.
+
+    The potentials are set per pair of types with setPotential<I>(), where I is
+    the position of the potential in the template arguments.
+*/
+template <typename... _Potentials>
+class VerletListMultiInteractionTemplate
+    : public VerletListInteractionTemplate<MultiPotential<_Potentials...> >
+{
+    typedef VerletListInteractionTemplate<MultiPotential<_Potentials...> > Super;
+
+public:
+    template <size_t I>
+    using Potential = typename MultiPotential<_Potentials...>::template Potential<I>;
+
+    VerletListMultiInteractionTemplate(std::shared_ptr<VerletList> _verletList)
+        : Super(_verletList)
+    {
+    }
+
+    template <size_t I>
+    void setPotential(int type1, int type2, const Potential<I>& potential)
+    {
+        // typeX+1 because i<ntypes
+        this->ntypes = std::max(this->ntypes, std::max(type1 + 1, type2 + 1));
+        this->potentialArray.at(type1, type2).template set<I>(potential);
+        this->invalidateTally();
+        if (type1 != type2)
+        {  // add potential in the other direction
+            this->potentialArray.at(type2, type1).template set<I>(potential);
+        }
+    }
+
+    template <size_t I>
+    Potential<I>& getPotential(int type1, int type2)
+    {
+        return this->potentialArray.at(type1, type2).template get<I>();
+    }
+};
+}  // namespace interaction
+}  // namespace espressopp
+
+#endif
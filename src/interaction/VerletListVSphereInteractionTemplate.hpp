@@ -53,6 +53,8 @@ public:
     {
         potentialArray = esutil::Array2D<Potential, esutil::enlarge>(0, 0, Potential());
         ntypes = 0;
+        // the potential depends on the radii of the ghosts
+        verletList->getSystemRef().storage->requestGhostFields(storage::Storage::GHOST_RADIUS);
     }
 
     virtual ~VerletListVSphereInteractionTemplate(){};
@@ -0,0 +1,246 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+#include "DumpH5MDParallel.hpp"
+#include "FixedPairList.hpp"
+#include "FixedQuadrupleList.hpp"
+#include "FixedTripleList.hpp"
+#include "RestoreH5MDParallel.hpp"
+#include "bc/OrthorhombicBC.hpp"
+#include "esutil/RNG.hpp"
+#include "integrator/MDIntegrator.hpp"
+#include "storage/Storage.hpp"
+
+namespace espressopp
+{
+namespace io
+{
+namespace
+{
+const char* stateGroup = "/checkpoint";
+const char* rngDataset = "/checkpoint/rng";
+const std::string boxGroup = "/particles/atoms/box";
+
+// one row of a rows x columns dataset per process, written or read collectively
+void selectRow(hid_t dset, hsize_t row, hsize_t columns, hid_t& fileSpace, hid_t& memSpace)
+{
+    std::vector<hsize_t> offset = {row, 0};
+    std::vector<hsize_t> count = {1, columns};
+    fileSpace = CHECK_HDF5(H5Dget_space(dset));
+    CHECK_HDF5(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), nullptr,
+                                   count.data(), nullptr));
+    memSpace = CHECK_HDF5(H5Screate_simple(2, count.data(), nullptr));
+}
+}  // namespace
+
+void Checkpoint::addPairs(const shared_ptr<FixedPairList>& fpl, const std::string& name)
+{
+    pairLists.emplace_back(fpl, name);
+}
+
+void Checkpoint::addTriples(const shared_ptr<FixedTripleList>& ftl, const std::string& name)
+{
+    tripleLists.emplace_back(ftl, name);
+}
+
+void Checkpoint::addQuadruples(const shared_ptr<FixedQuadrupleList>& fql,
+                               const std::string& name)
+{
+    quadrupleLists.emplace_back(fql, name);
+}
+
+hid_t Checkpoint::openFile(bool write)
+{
+    boost::mpi::communicator world;
+    auto plist = CHECK_HDF5(H5Pcreate(H5P_FILE_ACCESS));
+    CHECK_HDF5(H5Pset_fapl_mpio(plist, world, MPI_INFO_NULL));
+    auto fileId =
+        CHECK_HDF5(H5Fopen(filename_.c_str(), write ? H5F_ACC_RDWR : H5F_ACC_RDONLY, plist));
+    CHECK_HDF5(H5Pclose(plist));
+    return fileId;
+}
+
+void Checkpoint::write()
+{
+    // particles that left their cell since the last resort would be sorted into another
+    // cell by restore(); after a resort both runs continue with the same cell order
+    system_->storage->decompose();
+
+    DumpH5MDParallel dump(system_, filename_);
+    dump.dumpGhost = false;
+    dump.dumpImage = true;
+    dump.dump();
+    for (auto& list : pairLists) dump.dumpPairs(list.first, list.second);
+    for (auto& list : tripleLists) dump.dumpTriples(list.first, list.second);
+    for (auto& list : quadrupleLists) dump.dumpQuadruples(list.first, list.second);
+
+    writeState();
+}
+
+void Checkpoint::writeState()
+{
+    boost::mpi::communicator world;
+    auto fileId = openFile(true);
+
+    auto group = CHECK_HDF5(H5Gcreate(fileId, stateGroup, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    CHECK_HDF5(H5Gclose(group));
+
+    long long step = integrator_->getStep();
+    double dt = integrator_->getTimeStep();
+    int processes = world.size();
+    CHECK_HDF5(H5LTset_attribute_long_long(fileId, stateGroup, "step", &step, 1));
+    CHECK_HDF5(H5LTset_attribute_double(fileId, stateGroup, "dt", &dt, 1));
+    CHECK_HDF5(H5LTset_attribute_int(fileId, stateGroup, "processes", &processes, 1));
+
+    if (system_->rng)
+    {
+        long seed = system_->rng->get_seed();
+        CHECK_HDF5(H5LTset_attribute_long(fileId, stateGroup, "seed", &seed, 1));
+
+        // the text states of the generators, zero padded to the longest one
+        std::string state = system_->rng->getState();
+        hsize_t length = boost::mpi::all_reduce(world, hsize_t(state.size() + 1),
+                                                boost::mpi::maximum<hsize_t>());
+        std::vector<int8_t> data(length, 0);
+        std::copy(state.begin(), state.end(), data.begin());
+
+        std::vector<hsize_t> dims = {hsize_t(processes), length};
+        auto dataspace = CHECK_HDF5(H5Screate_simple(2, dims.data(), nullptr));
+        auto dset = CHECK_HDF5(H5Dcreate(fileId, rngDataset, typeToHDF5<int8_t>(), dataspace,
+                                         H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+        hid_t fileSpace, memSpace;
+        selectRow(dset, world.rank(), length, fileSpace, memSpace);
+        auto xfer = CHECK_HDF5(H5Pcreate(H5P_DATASET_XFER));
+        CHECK_HDF5(H5Pset_dxpl_mpio(xfer, H5FD_MPIO_COLLECTIVE));
+        CHECK_HDF5(
+            H5Dwrite(dset, typeToHDF5<int8_t>(), memSpace, fileSpace, xfer, data.data()));
+        CHECK_HDF5(H5Pclose(xfer));
+        CHECK_HDF5(H5Sclose(memSpace));
+        CHECK_HDF5(H5Sclose(fileSpace));
+        CHECK_HDF5(H5Dclose(dset));
+        CHECK_HDF5(H5Sclose(dataspace));
+    }
+
+    CHECK_HDF5(H5Fclose(fileId));
+}
+
+void Checkpoint::restore()
+{
+    auto& storage = *system_->storage;
+    storage.removeAllParticles();
+
+    restoreState();
+
+    RestoreH5MDParallel restore(system_, filename_);
+    restore.restoreImage = true;
+    restore.restore();
+    storage.decompose();
+    for (auto& list : pairLists) restore.restorePairs(list.first, list.second);
+    for (auto& list : tripleLists) restore.restoreTriples(list.first, list.second);
+    for (auto& list : quadrupleLists) restore.restoreQuadruples(list.first, list.second);
+}
+
+void Checkpoint::restoreState()
+{
+    boost::mpi::communicator world;
+    auto fileId = openFile(false);
+
+    long long step = 0;
+    double dt = 0.0;
+    CHECK_HDF5(H5LTget_attribute_long_long(fileId, stateGroup, "step", &step));
+    CHECK_HDF5(H5LTget_attribute_double(fileId, stateGroup, "dt", &dt));
+    integrator_->setStep(step);
+    integrator_->setTimeStep(dt);
+
+    // the box is scaled while there are no particles, so only the cells change
+    double edges[3];
+    CHECK_HDF5(H5LTget_attribute_double(fileId, boxGroup.c_str(), "edges", edges));
+    Real3D box(edges[0], edges[1], edges[2]);
+    Real3D oldBox = system_->bc->getBoxL();
+    if (box != oldBox)
+    {
+        system_->scaleVolume(Real3D(box[0] / oldBox[0], box[1] / oldBox[1], box[2] / oldBox[2]),
+                             false);
+        // the scaled box may differ in the last bit
+        auto bc = std::dynamic_pointer_cast<bc::OrthorhombicBC>(system_->bc);
+        if (bc && bc->getBoxL() != box) bc->setBoxL(box);
+    }
+
+    if (system_->rng && H5Lexists(fileId, rngDataset, H5P_DEFAULT) > 0)
+    {
+        auto dset = CHECK_HDF5(H5Dopen(fileId, rngDataset, H5P_DEFAULT));
+        auto dspace = CHECK_HDF5(H5Dget_space(dset));
+        hsize_t dims[2];
+        CHECK_HDF5(H5Sget_simple_extent_dims(dspace, dims, nullptr));
+        CHECK_HDF5(H5Sclose(dspace));
+
+        if (dims[0] == hsize_t(world.size()))
+        {
+            std::vector<int8_t> data(dims[1] + 1, 0);
+            hid_t fileSpace, memSpace;
+            selectRow(dset, world.rank(), dims[1], fileSpace, memSpace);
+            auto xfer = CHECK_HDF5(H5Pcreate(H5P_DATASET_XFER));
+            CHECK_HDF5(H5Pset_dxpl_mpio(xfer, H5FD_MPIO_COLLECTIVE));
+            CHECK_HDF5(
+                H5Dread(dset, typeToHDF5<int8_t>(), memSpace, fileSpace, xfer, data.data()));
+            CHECK_HDF5(H5Pclose(xfer));
+            CHECK_HDF5(H5Sclose(memSpace));
+            CHECK_HDF5(H5Sclose(fileSpace));
+            system_->rng->setState(reinterpret_cast<const char*>(data.data()));
+        }
+        else
+        {
+            // the streams belong to the processes, so they can not be split or merged
+            long seed = 0;
+            CHECK_HDF5(H5LTget_attribute_long(fileId, stateGroup, "seed", &seed));
+            system_->rng->seed(seed + step);
+            if (world.rank() == 0)
+            {
+                std::cerr << "# Warning: the checkpoint " << filename_ << " was written by "
+                          << dims[0] << " processes, the random number generators are seeded "
+                          << "with " << seed + step << std::endl;
+            }
+        }
+        CHECK_HDF5(H5Dclose(dset));
+    }
+
+    CHECK_HDF5(H5Fclose(fileId));
+}
+
+void Checkpoint::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<Checkpoint>("io_Checkpoint", init<shared_ptr<System>,
+                                             shared_ptr<integrator::MDIntegrator>, std::string>())
+        .def("addPairs", &Checkpoint::addPairs)
+        .def("addTriples", &Checkpoint::addTriples)
+        .def("addQuadruples", &Checkpoint::addQuadruples)
+        .def("write", &Checkpoint::write)
+        .def("restore", &Checkpoint::restore);
+}
+}  // namespace io
+}  // namespace espressopp
@@ -0,0 +1,92 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "System.hpp"
+#include "hdf5.hpp"
+#include "types.hpp"
+
+namespace espressopp
+{
+class FixedPairList;
+class FixedTripleList;
+class FixedQuadrupleList;
+
+namespace integrator
+{
+class MDIntegrator;
+}
+
+namespace io
+{
+/** Writes and restores the state of a simulation with parallel HDF5, so that a run can be
+    continued after the job ended, also on a different number of processes.
+
+    The file is an H5MD file of DumpH5MDParallel with images, plus the registered
+    tuple lists under /connectivity and the group /checkpoint with the integrator
+    step and time step and the random number generator of every process. On the same
+    number of processes the generators continue their streams, otherwise they are
+    seeded again from seed and step.
+*/
+class Checkpoint
+{
+public:
+    Checkpoint(const shared_ptr<System>& system,
+               const shared_ptr<integrator::MDIntegrator>& integrator,
+               const std::string& filename)
+        : system_(system), integrator_(integrator), filename_(filename)
+    {
+    }
+
+    /// The lists are written with the particles and filled again by restore().
+    void addPairs(const shared_ptr<FixedPairList>& fpl, const std::string& name);
+    void addTriples(const shared_ptr<FixedTripleList>& ftl, const std::string& name);
+    void addQuadruples(const shared_ptr<FixedQuadrupleList>& fql, const std::string& name);
+
+    void write();
+
+    /** Replace all particles, the box and the step by the ones in the file and fill the
+        registered lists, which should be empty.
+    */
+    void restore();
+
+    static void registerPython();
+
+private:
+    hid_t openFile(bool write);
+
+    void writeState();
+    void restoreState();
+
+    shared_ptr<System> system_;
+    shared_ptr<integrator::MDIntegrator> integrator_;
+    std::string filename_;
+
+    std::vector<std::pair<shared_ptr<FixedPairList>, std::string>> pairLists;
+    std::vector<std::pair<shared_ptr<FixedTripleList>, std::string>> tripleLists;
+    std::vector<std::pair<shared_ptr<FixedQuadrupleList>, std::string>> quadrupleLists;
+};
+
+}  // namespace io
+}  // namespace espressopp
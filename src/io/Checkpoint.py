@@ -0,0 +1,145 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+********************************
+espressopp.io.Checkpoint
+********************************
+
+Writes the state of a simulation to an H5MD file with parallel HDF5 and restores it,
+so that a job that hits the time limit of the queue can be continued. The file holds
+
+* id, type, mass, charge, position, image, velocity and force of all particles,
+* the tuples of the registered fixed pair, triple and quadruple lists (``/connectivity``),
+* the integrator step and time step and the box,
+* the state of the random number generator of every process,
+* properties of other objects, e.g. of thermostats, barostats and extensions.
+
+The particles and tuples are distributed over the processes by
+:class:`espressopp.io.RestoreH5MDParallel`, so the run can be continued on a different
+number of processes. On the same number of processes the random number generators
+continue their streams and the continued run is the same as the uninterrupted one up
+to the last bit. ``write`` resorts the particles into their cells for this. On a
+different number of processes the generators are seeded with seed + step.
+
+Other per-particle properties (AdResS, radius, state, ...) are not stored.
+
+.. function:: espressopp.io.Checkpoint(system, integrator, filename)
+
+   :param system: the system
+   :type system: espressopp.System
+   :param integrator: the integrator whose step and time step are stored
+   :type integrator: espressopp.integrator.MDIntegrator
+   :param filename: name of the H5MD file, overwritten by ``write``
+   :type filename: str
+
+.. function:: espressopp.io.Checkpoint.addPairs(fpl, name)
+              espressopp.io.Checkpoint.addTriples(ftl, name)
+              espressopp.io.Checkpoint.addQuadruples(fql, name)
+
+   Store the list as ``/connectivity/name``. The list given to ``restore`` has to
+   be empty.
+
+.. function:: espressopp.io.Checkpoint.addObject(name, obj, properties)
+
+   Store the properties (numbers or sequences of numbers) of obj as attributes of
+   ``/checkpoint/objects/name``, e.g. the momentum of a LangevinBarostat.
+
+.. function:: espressopp.io.Checkpoint.write()
+
+.. function:: espressopp.io.Checkpoint.restore()
+
+   Replace the particles, box, step and time step by the ones of the file and set the
+   properties of the objects.
+
+Example
+
+>>> checkpoint = espressopp.io.Checkpoint(system, integrator, 'checkpoint.h5')
+>>> checkpoint.addPairs(fpl, 'bonds')
+>>> checkpoint.addObject('barostat', barostat, ['momentum'])
+>>> checkpoint.write()
+
+and, after setting up the same system and interactions in the next job,
+
+>>> checkpoint.restore()
+>>> integrator.run(steps)
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+from _espressopp import io_Checkpoint
+
+import h5py
+
+
+class CheckpointLocal(io_Checkpoint):
+    def __init__(self, system, integrator, filename):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, io_Checkpoint, system, integrator, filename)
+        self.filename = filename
+
+    def addPairs(self, fpl, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.addPairs(self, fpl, name)
+
+    def addTriples(self, ftl, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.addTriples(self, ftl, name)
+
+    def addQuadruples(self, fql, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.addQuadruples(self, fql, name)
+
+    def write(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.write(self)
+
+    def restore(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.restore(self)
+
+
+if pmi.isController:
+    class Checkpoint(object, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls='espressopp.io.CheckpointLocal',
+            pmicall=['addPairs', 'addTriples', 'addQuadruples'])
+
+        def addObject(self, name, obj, properties):
+            if not hasattr(self, 'objects'):
+                self.objects = []
+            self.objects.append((name, obj, list(properties)))
+
+        def write(self):
+            pmi.call(self.pmiobject, 'write')
+            # the properties are the same on all processes, the controller adds them
+            with h5py.File(self.pmiobject.filename, 'r+') as h5:
+                for name, obj, properties in getattr(self, 'objects', []):
+                    group = h5.require_group('checkpoint/objects/' + name)
+                    for prop in properties:
+                        value = getattr(obj, prop)
+                        group.attrs[prop] = list(value) if hasattr(value, '__iter__') else value
+
+        def restore(self):
+            pmi.call(self.pmiobject, 'restore')
+            with h5py.File(self.pmiobject.filename, 'r') as h5:
+                for name, obj, properties in getattr(self, 'objects', []):
+                    group = h5['checkpoint/objects/' + name]
+                    for prop in properties:
+                        setattr(obj, prop, group.attrs[prop].tolist())
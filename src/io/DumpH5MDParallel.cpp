@@ -20,6 +20,9 @@
 
 #include "DumpH5MDParallel.hpp"
 
+#include "FixedPairList.hpp"
+#include "FixedQuadrupleList.hpp"
+#include "FixedTripleList.hpp"
 #include "bc/BC.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "storage/Storage.hpp"
@@ -35,8 +38,22 @@ void DumpH5MDParallel::writeParallel(hid_t fileId,
                                      const std::vector<hsize_t>& globalDims,
                                      const std::vector<hsize_t>& localDims,
                                      const std::vector<T>& data)
+{
+    std::vector<hsize_t> offset(globalDims.size(), 0);
+    offset[1] = particleOffset;
+    writeParallel(fileId, name, globalDims, localDims, offset, data);
+}
+
+template <typename T>
+void DumpH5MDParallel::writeParallel(hid_t fileId,
+                                     const std::string& name,
+                                     const std::vector<hsize_t>& globalDims,
+                                     const std::vector<hsize_t>& localDims,
+                                     const std::vector<hsize_t>& offset,
+                                     const std::vector<T>& data)
 {
     CHECK_EQUAL(globalDims.size(), localDims.size());
+    CHECK_EQUAL(globalDims.size(), offset.size());
     CHECK_EQUAL(data.size(), std::accumulate(localDims.begin(), localDims.end(), hsize_t(1),
                                              std::multiplies<>()));
 
@@ -45,8 +62,6 @@ void DumpH5MDParallel::writeParallel(hid_t fileId,
     auto dataset = CHECK_HDF5(H5Dcreate(fileId, name.c_str(), typeToHDF5<T>(), dataspace,
                                         H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
 
-    std::vector<hsize_t> offset(globalDims.size(), 0);
-    offset[1] = particleOffset;
     std::vector<hsize_t> stride(globalDims.size(), 1);
     std::vector<hsize_t> count(globalDims.size(), 1);
     for (auto i = 0; i < int_c(globalDims.size()); ++i)
@@ -74,7 +89,7 @@ void DumpH5MDParallel::writeParallel(hid_t fileId,
     CHECK_HDF5(H5Sclose(dataspace));
 }
 
-void DumpH5MDParallel::writeHeader(hid_t fileId) const
+void DumpH5MDParallel::writeHeader(hid_t fileId, const std::string& author)
 {
     auto group1 = CHECK_HDF5(H5Gcreate(fileId, "/h5md", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
     auto group2 =
@@ -403,6 +418,95 @@ void DumpH5MDParallel::writeForce(hid_t fileId)
     CHECK_HDF5(H5Gclose(group));
 }
 
+void DumpH5MDParallel::writeImage(hid_t fileId)
+{
+    using Datatype = int64_t;
+    constexpr int64_t dimensions = 3;  ///< dimensions of the property
+
+    std::string groupName = "/particles/" + particleGroupName + "/" + imageDataset;
+    auto group = H5Gcreate(fileId, groupName.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    std::vector<Datatype> data;
+    data.reserve(numLocalParticles * dimensions);
+    for (iterator::CellListIterator cit(system_->storage->getRealCells()); !cit.isDone(); ++cit)
+    {
+        data.emplace_back(cit->image()[0]);
+        data.emplace_back(cit->image()[1]);
+        data.emplace_back(cit->image()[2]);
+    }
+    CHECK_EQUAL(int64_c(data.size()), numLocalParticles * dimensions);
+
+    std::vector<hsize_t> localDims = {1, uint64_c(numLocalParticles), dimensions};
+    std::vector<hsize_t> globalDims = {1, uint64_c(numTotalParticles), dimensions};
+
+    std::string dataset_name = groupName + "/value";
+    writeParallel(fileId, dataset_name, globalDims, localDims, data);
+
+    std::vector<hsize_t> dims = {1};
+    std::vector<int64_t> step = {0};
+    std::vector<double> time = {0};
+    std::string stepDataset = groupName + "/step";
+    CHECK_HDF5(H5LTmake_dataset(fileId, stepDataset.c_str(), 1, dims.data(), typeToHDF5<int64_t>(),
+                                step.data()));
+    std::string timeDataset = groupName + "/time";
+    CHECK_HDF5(H5LTmake_dataset(fileId, timeDataset.c_str(), 1, dims.data(), typeToHDF5<double>(),
+                                time.data()));
+    CHECK_HDF5(H5Gclose(group));
+}
+
+void DumpH5MDParallel::writeTuples(const std::string& name,
+                                   const std::vector<longint>& tuples,
+                                   hsize_t N)
+{
+    updateCache();
+
+    int64_t numLocalTuples = tuples.size() / N;
+    int64_t numTotalTuples = 0;
+    int64_t tupleOffset = 0;
+    MPI_Allreduce(&numLocalTuples, &numTotalTuples, 1, MPI_INT64_T, MPI_SUM, comm);
+    MPI_Exscan(&numLocalTuples, &tupleOffset, 1, MPI_INT64_T, MPI_SUM, comm);
+    if (rank == 0) tupleOffset = 0;
+
+    auto plist = CHECK_HDF5(H5Pcreate(H5P_FILE_ACCESS));
+    CHECK_HDF5(H5Pset_fapl_mpio(plist, comm, MPI_INFO_NULL));
+    auto fileId = CHECK_HDF5(H5Fopen(filename_.c_str(), H5F_ACC_RDWR, plist));
+    CHECK_HDF5(H5Pclose(plist));
+
+    if (!H5Lexists(fileId, "/connectivity", H5P_DEFAULT))
+    {
+        auto group = CHECK_HDF5(
+            H5Gcreate(fileId, "/connectivity", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+        CHECK_HDF5(H5Gclose(group));
+    }
+
+    std::vector<int64_t> data(tuples.begin(), tuples.end());
+    std::vector<hsize_t> localDims = {uint64_c(numLocalTuples), N};
+    std::vector<hsize_t> globalDims = {uint64_c(numTotalTuples), N};
+    std::vector<hsize_t> offset = {uint64_c(tupleOffset), 0};
+    std::string datasetName = "/connectivity/" + name;
+    writeParallel(fileId, datasetName, globalDims, localDims, offset, data);
+    CHECK_HDF5(H5LTset_attribute_string(fileId, datasetName.c_str(), "particle_group",
+                                        particleGroupName.c_str()));
+
+    CHECK_HDF5(H5Fclose(fileId));
+}
+
+void DumpH5MDParallel::dumpPairs(const shared_ptr<FixedPairList>& fpl, const std::string& name)
+{
+    writeTuples(name, fpl->getPairList(), 2);
+}
+
+void DumpH5MDParallel::dumpTriples(const shared_ptr<FixedTripleList>& ftl, const std::string& name)
+{
+    writeTuples(name, ftl->getTripleList(), 3);
+}
+
+void DumpH5MDParallel::dumpQuadruples(const shared_ptr<FixedQuadrupleList>& fql,
+                                      const std::string& name)
+{
+    writeTuples(name, fql->getQuadrupleList(), 4);
+}
+
 void DumpH5MDParallel::updateCache()
 {
     boost::mpi::communicator world;
@@ -435,7 +539,7 @@ void DumpH5MDParallel::dump()
     auto group2 = CHECK_HDF5(
         H5Gcreate(file_id, particleGroup.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
 
-    writeHeader(file_id);
+    writeHeader(file_id, author);
     writeBox(file_id);
     if (dumpId) writeId(file_id);
     if (dumpType) writeType(file_id);
@@ -445,6 +549,7 @@ void DumpH5MDParallel::dump()
     if (dumpPosition) writePosition(file_id);
     if (dumpVelocity) writeVelocity(file_id);
     if (dumpForce) writeForce(file_id);
+    if (dumpImage) writeImage(file_id);
 
     CHECK_HDF5(H5Gclose(group1));
     CHECK_HDF5(H5Gclose(group2));
@@ -467,6 +572,7 @@ void DumpH5MDParallel::registerPython()
         .def_readonly("dumpPosition", &DumpH5MDParallel::dumpPosition)
         .def_readonly("dumpVelocity", &DumpH5MDParallel::dumpVelocity)
         .def_readonly("dumpForce", &DumpH5MDParallel::dumpForce)
+        .def_readwrite("dumpImage", &DumpH5MDParallel::dumpImage)
         .def_readwrite("idDataset", &DumpH5MDParallel::idDataset)
         .def_readwrite("typeDataset", &DumpH5MDParallel::typeDataset)
         .def_readwrite("massDataset", &DumpH5MDParallel::massDataset)
@@ -475,7 +581,11 @@ void DumpH5MDParallel::registerPython()
         .def_readwrite("positionDataset", &DumpH5MDParallel::positionDataset)
         .def_readwrite("velocityDataset", &DumpH5MDParallel::velocityDataset)
         .def_readwrite("forceDataset", &DumpH5MDParallel::forceDataset)
-        .def("dump", &DumpH5MDParallel::dump);
+        .def_readwrite("imageDataset", &DumpH5MDParallel::imageDataset)
+        .def("dump", &DumpH5MDParallel::dump)
+        .def("dumpPairs", &DumpH5MDParallel::dumpPairs)
+        .def("dumpTriples", &DumpH5MDParallel::dumpTriples)
+        .def("dumpQuadruples", &DumpH5MDParallel::dumpQuadruples);
 }
 }  // namespace io
 }  // namespace espressopp
\ No newline at end of file
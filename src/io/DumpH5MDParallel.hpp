@@ -29,6 +29,10 @@
 
 namespace espressopp
 {
+class FixedPairList;
+class FixedTripleList;
+class FixedQuadrupleList;
+
 namespace io
 {
 class DumpH5MDParallel
@@ -41,6 +45,14 @@ public:
 
     void dump();
 
+    /** Add the tuples of all processes as fixed dataset /connectivity/<name> (N x 2, 3
+        or 4) to the file written by dump(). Every process writes its tuples as one block,
+        in the order of the ranks; RestoreH5MDParallel reads them on any number of ranks.
+    */
+    void dumpPairs(const shared_ptr<FixedPairList>& fpl, const std::string& name);
+    void dumpTriples(const shared_ptr<FixedTripleList>& ftl, const std::string& name);
+    void dumpQuadruples(const shared_ptr<FixedQuadrupleList>& fql, const std::string& name);
+
     std::string author = "xxx";
     std::string particleGroupName = "atoms";
 
@@ -52,6 +64,7 @@ public:
     bool dumpPosition = true;
     bool dumpVelocity = true;
     bool dumpForce = true;
+    bool dumpImage = false;
 
     std::string idDataset = "id";
     std::string typeDataset = "type";
@@ -61,13 +74,16 @@ public:
     std::string positionDataset = "position";
     std::string velocityDataset = "velocity";
     std::string forceDataset = "force";
+    std::string imageDataset = "image";
+
+    /// Write the /h5md group with author and creator.
+    static void writeHeader(hid_t fileId, const std::string& author);
 
     static void registerPython();
 
 private:
     void updateCache();
 
-    void writeHeader(hid_t fileId) const;
     void writeBox(hid_t fileId);
     void writeId(hid_t fileId);
     void writeType(hid_t fileId);
@@ -77,12 +93,25 @@ private:
     void writePosition(hid_t fileId);
     void writeVelocity(hid_t fileId);
     void writeForce(hid_t fileId);
+    void writeImage(hid_t fileId);
+
+    /// write the tuples, N ids each, of all processes to /connectivity/<name>
+    void writeTuples(const std::string& name, const std::vector<longint>& tuples, hsize_t N);
+
+    /// write the local particles at particleOffset along the second dimension
+    template <typename T>
+    void writeParallel(hid_t fileId,
+                       const std::string& name,
+                       const std::vector<hsize_t>& globalDims,
+                       const std::vector<hsize_t>& localDims,
+                       const std::vector<T>& data);
 
     template <typename T>
     void writeParallel(hid_t fileId,
                        const std::string& name,
                        const std::vector<hsize_t>& globalDims,
                        const std::vector<hsize_t>& localDims,
+                       const std::vector<hsize_t>& offset,
                        const std::vector<T>& data);
 
     shared_ptr<System> system_ = nullptr;
@@ -29,13 +29,25 @@ class DumpH5MDLocalParallel(io_DumpH5MDParallel):
         if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.dump(self)
 
+    def dumpPairs(self, fpl, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.dumpPairs(self, fpl, name)
+
+    def dumpTriples(self, ftl, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.dumpTriples(self, ftl, name)
+
+    def dumpQuadruples(self, fql, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.dumpQuadruples(self, fql, name)
+
 
 
 if pmi.isController:
     class DumpH5MDParallel(object, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
             cls='espressopp.io.DumpH5MDLocalParallel',
-            pmicall=['dump'],
+            pmicall=['dump', 'dumpPairs', 'dumpTriples', 'dumpQuadruples'],
             pmiproperty=[
             'dumpId',
             'dumpType',
@@ -45,6 +57,7 @@ if pmi.isController:
             'dumpPosition',
             'dumpVelocity',
             'dumpForce',
+            'dumpImage',
             'idDataset',
             'typeDataset',
             'massDataset',
@@ -53,5 +66,6 @@ if pmi.isController:
             'positionDataset',
             'velocityDataset',
             'forceDataset',
+            'imageDataset',
             'author'
             ])
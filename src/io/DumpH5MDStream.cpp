@@ -0,0 +1,576 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DumpH5MDStream.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <boost/filesystem.hpp>
+
+#include "DumpH5MDParallel.hpp"
+#include "FileBackup.hpp"
+#include "bc/BC.hpp"
+#include "iterator/CellListIterator.hpp"
+#include "storage/Storage.hpp"
+
+namespace espressopp
+{
+namespace io
+{
+namespace
+{
+/// number of particles and of frames of step/time per chunk
+constexpr hsize_t chunkParticles = 65536;
+constexpr hsize_t chunkFrames = 128;
+
+/// Extend dataset along the frame axis and write the frame-th entry of the given shape.
+template <typename T>
+void appendToDataset(hid_t dataset,
+                     hsize_t frame,
+                     const std::vector<hsize_t>& shape,
+                     const T* data)
+{
+    std::vector<hsize_t> dims = {frame + 1};
+    dims.insert(dims.end(), shape.begin(), shape.end());
+    CHECK_HDF5(H5Dset_extent(dataset, dims.data()));
+
+    std::vector<hsize_t> start(dims.size(), 0);
+    start[0] = frame;
+    std::vector<hsize_t> count = dims;
+    count[0] = 1;
+
+    auto fileSpace = CHECK_HDF5(H5Dget_space(dataset));
+    CHECK_HDF5(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start.data(), nullptr,
+                                   count.data(), nullptr));
+    auto memSpace = CHECK_HDF5(H5Screate_simple(int_c(count.size()), count.data(), nullptr));
+    CHECK_HDF5(H5Dwrite(dataset, typeToHDF5<T>(), memSpace, fileSpace, H5P_DEFAULT, data));
+    CHECK_HDF5(H5Sclose(memSpace));
+    CHECK_HDF5(H5Sclose(fileSpace));
+}
+
+/// Extendable, chunked dataset with an empty frame axis.
+hid_t createSeries(hid_t group,
+                   const std::string& name,
+                   hid_t type,
+                   const std::vector<hsize_t>& shape,
+                   const std::vector<hsize_t>& chunk,
+                   int compressionLevel)
+{
+    std::vector<hsize_t> dims = {0};
+    dims.insert(dims.end(), shape.begin(), shape.end());
+    std::vector<hsize_t> maxDims(dims.size(), H5S_UNLIMITED);
+
+    auto space = CHECK_HDF5(H5Screate_simple(int_c(dims.size()), dims.data(), maxDims.data()));
+    auto dcpl = CHECK_HDF5(H5Pcreate(H5P_DATASET_CREATE));
+    CHECK_HDF5(H5Pset_chunk(dcpl, int_c(chunk.size()), chunk.data()));
+    if (compressionLevel > 0)
+    {
+        CHECK_HDF5(H5Pset_shuffle(dcpl));
+        CHECK_HDF5(H5Pset_deflate(dcpl, compressionLevel));
+    }
+    auto dataset = CHECK_HDF5(
+        H5Dcreate(group, name.c_str(), type, space, H5P_DEFAULT, dcpl, H5P_DEFAULT));
+    CHECK_HDF5(H5Pclose(dcpl));
+    CHECK_HDF5(H5Sclose(space));
+    return dataset;
+}
+
+/// Number of entries along the frame axis.
+hsize_t numEntries(hid_t dataset)
+{
+    auto space = CHECK_HDF5(H5Dget_space(dataset));
+    std::vector<hsize_t> dims(CHECK_HDF5(H5Sget_simple_extent_ndims(space)));
+    CHECK_HDF5(H5Sget_simple_extent_dims(space, dims.data(), nullptr));
+    CHECK_HDF5(H5Sclose(space));
+    return dims[0];
+}
+}  // namespace
+
+std::vector<hsize_t> DumpH5MDStream::Element::shape(int64_t numParticles) const
+{
+    // H5MD stores scalar per-particle properties without a trailing dimension
+    std::vector<hsize_t> res;
+    if (perParticle()) res.push_back(uint64_c(numParticles));
+    if (dimension > 1 || !perParticle()) res.push_back(dimension);
+    return res;
+}
+
+DumpH5MDStream::DumpH5MDStream(std::shared_ptr<System> system,
+                               std::shared_ptr<integrator::MDIntegrator> integrator,
+                               const std::string& filename,
+                               bool append,
+                               int compressionLevel)
+    : ParticleAccess(system),
+      compressionLevel(compressionLevel),
+      integrator_(integrator),
+      filename_(filename),
+      append_(append)
+{
+    comm = *system->comm;
+    rank = system->comm->rank();
+
+    if (rank == 0)
+    {
+        hbool_t threadSafe = false;
+        CHECK_HDF5(H5is_library_threadsafe(&threadSafe));
+        background = threadSafe;
+
+        if (!append_) FileBackup backup(filename_);
+        // double buffering, one frame is written while the next one is gathered
+        freeFrames.emplace_back(new Frame);
+        freeFrames.emplace_back(new Frame);
+    }
+}
+
+DumpH5MDStream::~DumpH5MDStream()
+{
+    try
+    {
+        close();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "DumpH5MDStream: " << e.what() << std::endl;
+    }
+}
+
+void DumpH5MDStream::setupLayout()
+{
+    elements.clear();
+    // the id is always gathered, it defines the order of the particles in the file
+    numInts = 1;
+    numReals = 0;
+    if (dumpId) elements.push_back({ID, "id", true, 0, 1});
+
+    auto add = [this](bool enabled, Property property, const std::string& name, bool isInt,
+                      int dimension)
+    {
+        if (!enabled) return;
+        int& columns = isInt ? numInts : numReals;
+        elements.push_back({property, name, isInt, columns, dimension});
+        columns += dimension;
+    };
+    add(dumpType, SPECIES, "species", true, 1);
+    add(dumpImage, IMAGE, "image", true, 3);
+    add(dumpMass, MASS, "mass", false, 1);
+    add(dumpQ, CHARGE, "charge", false, 1);
+    add(dumpPosition, POSITION, "position", false, 3);
+    add(dumpVelocity, VELOCITY, "velocity", false, 3);
+    add(dumpForce, FORCE, "force", false, 3);
+    elements.push_back({EDGES, "box/edges", false, 0, 3});
+
+    layoutDone = true;
+}
+
+void DumpH5MDStream::dump()
+{
+    if (!layoutDone) setupLayout();
+
+    System& system = getSystemRef();
+
+    // pack the local particles, the columns follow the order of the elements
+    int numLocalParticles = system.storage->getNRealParticles();
+    sendInts.clear();
+    sendReals.clear();
+    sendInts.reserve(numLocalParticles * numInts);
+    sendReals.reserve(numLocalParticles * numReals);
+    for (iterator::CellListIterator cit(system.storage->getRealCells()); !cit.isDone(); ++cit)
+    {
+        sendInts.push_back(cit->id());
+        for (const auto& e : elements)
+        {
+            switch (e.property)
+            {
+                case SPECIES:
+                    sendInts.push_back(cit->type());
+                    break;
+                case IMAGE:
+                    for (int d = 0; d < 3; ++d) sendInts.push_back(cit->image()[d]);
+                    break;
+                case MASS:
+                    sendReals.push_back(cit->mass());
+                    break;
+                case CHARGE:
+                    sendReals.push_back(cit->q());
+                    break;
+                case POSITION:
+                    for (int d = 0; d < 3; ++d) sendReals.push_back(cit->position()[d]);
+                    break;
+                case VELOCITY:
+                    for (int d = 0; d < 3; ++d) sendReals.push_back(cit->velocity()[d]);
+                    break;
+                case FORCE:
+                    for (int d = 0; d < 3; ++d) sendReals.push_back(cit->force()[d]);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    CHECK_EQUAL(int64_c(sendInts.size()), int64_c(numLocalParticles) * numInts);
+    CHECK_EQUAL(int64_c(sendReals.size()), int64_c(numLocalParticles) * numReals);
+
+    counts.resize(system.comm->size());
+    displs.resize(system.comm->size());
+    MPI_Allgather(&numLocalParticles, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+    int64_t numParticles = std::accumulate(counts.begin(), counts.end(), int64_t(0));
+    if (numTotalParticles >= 0 && numParticles != numTotalParticles)
+    {
+        std::stringstream msg;
+        msg << "DumpH5MDStream: the number of particles changed from " << numTotalParticles
+            << " to " << numParticles;
+        throw std::runtime_error(msg.str());
+    }
+    numTotalParticles = numParticles;
+
+    // take a free buffer, this only waits if the writer is two frames behind
+    std::unique_ptr<Frame> frame;
+    if (rank == 0)
+    {
+        if (background && !writer.joinable())
+        {
+            stop = false;
+            writer = std::thread(&DumpH5MDStream::writerLoop, this);
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [this] { return !freeFrames.empty(); });
+        frame = std::move(freeFrames.back());
+        freeFrames.pop_back();
+        lock.unlock();
+
+        frame->step = integrator_->getStep();
+        frame->time = frame->step * integrator_->getTimeStep();
+        for (int d = 0; d < 3; ++d) frame->edges[d] = system.bc->getBoxL()[d];
+        frame->ints.resize(numParticles * numInts);
+        frame->reals.resize(numParticles * numReals);
+    }
+
+    auto gather = [&](auto* send, auto* recv, int columns, MPI_Datatype type)
+    {
+        if (columns == 0) return;
+        std::vector<int> columnCounts(counts.size());
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            columnCounts[i] = counts[i] * columns;
+            displs[i] = (i == 0) ? 0 : displs[i - 1] + columnCounts[i - 1];
+        }
+        MPI_Gatherv(send, numLocalParticles * columns, type, recv, columnCounts.data(),
+                    displs.data(), type, 0, comm);
+    };
+    gather(sendInts.data(), frame ? frame->ints.data() : nullptr, numInts, MPI_INT64_T);
+    gather(sendReals.data(), frame ? frame->reals.data() : nullptr, numReals, MPI_DOUBLE);
+
+    if (rank == 0)
+    {
+        if (background)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back(std::move(frame));
+            cond.notify_all();
+        }
+        else
+        {
+            write(std::move(frame));
+        }
+    }
+
+    // dump() is collective, so a failure on rank 0 is raised on all ranks
+    int failed = 0;
+    if (rank == 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        failed = writerError ? 1 : 0;
+    }
+    MPI_Bcast(&failed, 1, MPI_INT, 0, comm);
+    if (failed)
+    {
+        if (rank == 0) rethrowWriterError();
+        throw std::runtime_error("DumpH5MDStream: writing the file on rank 0 failed");
+    }
+}
+
+void DumpH5MDStream::flush()
+{
+    if (rank != 0) return;
+
+    // the writer only touches the file while busy, so it is ours until the next dump()
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [this] { return queue.empty() && !busy; });
+    lock.unlock();
+    rethrowWriterError();
+    if (fileId >= 0) CHECK_HDF5(H5Fflush(fileId, H5F_SCOPE_GLOBAL));
+}
+
+void DumpH5MDStream::close()
+{
+    if (rank != 0) return;
+
+    if (writer.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+            cond.notify_all();
+        }
+        writer.join();
+    }
+    closeFile();
+    // frames dumped after closing go to the end of the same file
+    append_ = true;
+    rethrowWriterError();
+}
+
+void DumpH5MDStream::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        cond.wait(lock, [this] { return stop || !queue.empty(); });
+        // stop only once all queued frames are written
+        if (queue.empty()) break;
+
+        std::unique_ptr<Frame> frame = std::move(queue.front());
+        queue.pop_front();
+        busy = true;
+        lock.unlock();
+
+        write(std::move(frame));
+
+        lock.lock();
+        busy = false;
+        cond.notify_all();
+    }
+}
+
+void DumpH5MDStream::write(std::unique_ptr<Frame> frame)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    // frames after a failure are dropped until the error is raised
+    if (!writerError)
+    {
+        lock.unlock();
+        try
+        {
+            writeFrame(*frame);
+        }
+        catch (...)
+        {
+            // an exception must not leave the writer thread
+            lock.lock();
+            writerError = std::current_exception();
+            lock.unlock();
+        }
+        lock.lock();
+    }
+    freeFrames.push_back(std::move(frame));
+    cond.notify_all();
+}
+
+void DumpH5MDStream::rethrowWriterError()
+{
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::swap(error, writerError);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void DumpH5MDStream::openFile(int64_t numParticles)
+{
+    std::string groupName = "/particles/" + particleGroupName;
+
+    if (append_ && boost::filesystem::exists(filename_))
+    {
+        fileId = H5Fopen(filename_.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+        if (fileId < 0) throw std::runtime_error("DumpH5MDStream: cannot open " + filename_);
+        auto group = CHECK_HDF5(H5Gopen(fileId, groupName.c_str(), H5P_DEFAULT));
+        for (auto& e : elements) openElement(group, e, numParticles);
+        CHECK_HDF5(H5Gclose(group));
+
+        numFrames = numEntries(elements.front().value);
+        for (const auto& e : elements)
+        {
+            CHECK_EQUAL(numEntries(e.value), numFrames, "element " << e.name);
+        }
+        return;
+    }
+
+    fileId = H5Fcreate(filename_.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if (fileId < 0) throw std::runtime_error("DumpH5MDStream: cannot create " + filename_);
+    DumpH5MDParallel::writeHeader(fileId, author);
+
+    auto particles =
+        CHECK_HDF5(H5Gcreate(fileId, "/particles", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    auto group = CHECK_HDF5(
+        H5Gcreate(fileId, groupName.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+
+    auto box = CHECK_HDF5(H5Gcreate(group, "box", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    std::string boxName = groupName + "/box";
+    std::vector<int> dims = {3};
+    CHECK_HDF5(
+        H5LTset_attribute_int(fileId, boxName.c_str(), "dimension", dims.data(), dims.size()));
+    auto boundaryType = CHECK_HDF5(H5Tcopy(H5T_C_S1));
+    CHECK_HDF5(H5Tset_size(boundaryType, 8));
+    CHECK_HDF5(H5Tset_strpad(boundaryType, H5T_STR_NULLPAD));
+    std::vector<hsize_t> boundaryDims = {3};
+    auto space =
+        CHECK_HDF5(H5Screate_simple(int_c(boundaryDims.size()), boundaryDims.data(), nullptr));
+    auto att =
+        CHECK_HDF5(H5Acreate(box, "boundary", boundaryType, space, H5P_DEFAULT, H5P_DEFAULT));
+    CHECK_HDF5(H5Awrite(att, boundaryType, "periodicperiodicperiodic"));
+    CHECK_HDF5(H5Aclose(att));
+    CHECK_HDF5(H5Sclose(space));
+    CHECK_HDF5(H5Tclose(boundaryType));
+    CHECK_HDF5(H5Gclose(box));
+
+    for (auto& e : elements) createElement(group, e, numParticles);
+
+    CHECK_HDF5(H5Gclose(group));
+    CHECK_HDF5(H5Gclose(particles));
+    numFrames = 0;
+}
+
+void DumpH5MDStream::createElement(hid_t group, Element& e, int64_t numParticles)
+{
+    auto elementGroup =
+        CHECK_HDF5(H5Gcreate(group, e.name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+
+    std::vector<hsize_t> shape = e.shape(numParticles);
+    std::vector<hsize_t> chunk = {1};
+    for (auto n : shape) chunk.push_back(std::max<hsize_t>(n, 1));
+    if (e.perParticle()) chunk[1] = std::min(chunk[1], chunkParticles);
+
+    hid_t type = e.isInt ? typeToHDF5<int64_t>() : typeToHDF5<double>();
+    e.value = createSeries(elementGroup, "value", type, shape, chunk, compressionLevel);
+    e.step = createSeries(elementGroup, "step", typeToHDF5<int64_t>(), {}, {chunkFrames}, 0);
+    e.time = createSeries(elementGroup, "time", typeToHDF5<double>(), {}, {chunkFrames}, 0);
+
+    CHECK_HDF5(H5Gclose(elementGroup));
+}
+
+void DumpH5MDStream::openElement(hid_t group, Element& e, int64_t numParticles)
+{
+    auto elementGroup = CHECK_HDF5(H5Gopen(group, e.name.c_str(), H5P_DEFAULT));
+    e.value = CHECK_HDF5(H5Dopen(elementGroup, "value", H5P_DEFAULT));
+    e.step = CHECK_HDF5(H5Dopen(elementGroup, "step", H5P_DEFAULT));
+    e.time = CHECK_HDF5(H5Dopen(elementGroup, "time", H5P_DEFAULT));
+    CHECK_HDF5(H5Gclose(elementGroup));
+
+    // the shape has to match the particles of this run
+    std::vector<hsize_t> shape = e.shape(numParticles);
+    auto space = CHECK_HDF5(H5Dget_space(e.value));
+    std::vector<hsize_t> dims(CHECK_HDF5(H5Sget_simple_extent_ndims(space)));
+    CHECK_HDF5(H5Sget_simple_extent_dims(space, dims.data(), nullptr));
+    CHECK_HDF5(H5Sclose(space));
+    CHECK_EQUAL(dims.size(), shape.size() + 1, "element " << e.name);
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+        CHECK_EQUAL(dims[i + 1], shape[i], "element " << e.name);
+    }
+}
+
+void DumpH5MDStream::writeFrame(const Frame& frame)
+{
+    int64_t numParticles = int64_c(frame.ints.size()) / numInts;
+    if (fileId < 0) openFile(numParticles);
+
+    // particles are stored in the order of their ids
+    order.resize(numParticles);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int64_t a, int64_t b)
+              { return frame.ints[a * numInts] < frame.ints[b * numInts]; });
+
+    for (auto& e : elements)
+    {
+        std::vector<hsize_t> shape = e.shape(numParticles);
+        if (!e.perParticle())
+        {
+            appendToDataset(e.value, numFrames, shape, frame.edges);
+        }
+        else if (e.isInt)
+        {
+            scratchInts.resize(numParticles * e.dimension);
+            for (int64_t i = 0; i < numParticles; ++i)
+            {
+                const int64_t* src = &frame.ints[order[i] * numInts + e.offset];
+                std::copy(src, src + e.dimension, &scratchInts[i * e.dimension]);
+            }
+            appendToDataset(e.value, numFrames, shape, scratchInts.data());
+        }
+        else
+        {
+            scratchReals.resize(numParticles * e.dimension);
+            for (int64_t i = 0; i < numParticles; ++i)
+            {
+                const double* src = &frame.reals[order[i] * numReals + e.offset];
+                std::copy(src, src + e.dimension, &scratchReals[i * e.dimension]);
+            }
+            appendToDataset(e.value, numFrames, shape, scratchReals.data());
+        }
+        appendToDataset(e.step, numFrames, {}, &frame.step);
+        appendToDataset(e.time, numFrames, {}, &frame.time);
+    }
+    ++numFrames;
+}
+
+void DumpH5MDStream::closeFile()
+{
+    if (fileId < 0) return;
+    for (auto& e : elements)
+    {
+        CHECK_HDF5(H5Dclose(e.value));
+        CHECK_HDF5(H5Dclose(e.step));
+        CHECK_HDF5(H5Dclose(e.time));
+        e.value = e.step = e.time = -1;
+    }
+    CHECK_HDF5(H5Fclose(fileId));
+    fileId = -1;
+}
+
+void DumpH5MDStream::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<DumpH5MDStream, bases<ParticleAccess>, boost::noncopyable>(
+        "io_DumpH5MDStream",
+        init<std::shared_ptr<System>, std::shared_ptr<integrator::MDIntegrator>, std::string,
+             bool, int>())
+        .def_readwrite("author", &DumpH5MDStream::author)
+        .def_readwrite("particleGroupName", &DumpH5MDStream::particleGroupName)
+        .def_readwrite("dumpId", &DumpH5MDStream::dumpId)
+        .def_readwrite("dumpType", &DumpH5MDStream::dumpType)
+        .def_readwrite("dumpMass", &DumpH5MDStream::dumpMass)
+        .def_readwrite("dumpQ", &DumpH5MDStream::dumpQ)
+        .def_readwrite("dumpPosition", &DumpH5MDStream::dumpPosition)
+        .def_readwrite("dumpImage", &DumpH5MDStream::dumpImage)
+        .def_readwrite("dumpVelocity", &DumpH5MDStream::dumpVelocity)
+        .def_readwrite("dumpForce", &DumpH5MDStream::dumpForce)
+        .def_readwrite("compressionLevel", &DumpH5MDStream::compressionLevel)
+        .add_property("background", &DumpH5MDStream::getBackground)
+        .def("dump", &DumpH5MDStream::dump)
+        .def("flush", &DumpH5MDStream::flush)
+        .def("close", &DumpH5MDStream::close);
+}
+}  // namespace io
+}  // namespace espressopp
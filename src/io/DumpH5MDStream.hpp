@@ -0,0 +1,188 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "ParticleAccess.hpp"
+#include "System.hpp"
+#include "hdf5.hpp"
+#include "integrator/MDIntegrator.hpp"
+#include "types.hpp"
+
+namespace espressopp
+{
+namespace io
+{
+/**
+ * Trajectory writer that appends frames to a single H5MD file.
+ *
+ * Every particle property is a time-dependent H5MD element with chunked, extendable
+ * value/step/time datasets, optionally deflate compressed. dump() gathers the local
+ * particles to rank 0 and returns as soon as the data is copied. The sorting by id and
+ * the HDF5 calls are done by a background thread on rank 0, which works on one frame
+ * while the next one is gathered into a second buffer. The thread does not use MPI.
+ *
+ * The thread is only used if the HDF5 library is built thread-safe, otherwise other
+ * HDF5 users of the process (DumpH5MDParallel, h5py, ...) could run at the same time and
+ * rank 0 writes each frame within dump(). An error of the writer is raised by the next
+ * dump() on all ranks, or by flush() or close() on rank 0.
+ *
+ * The file stays open until close() (or destruction). Use flush() before reading the
+ * file in the same process.
+ */
+class DumpH5MDStream : public ParticleAccess
+{
+public:
+    DumpH5MDStream(std::shared_ptr<System> system,
+                   std::shared_ptr<integrator::MDIntegrator> integrator,
+                   const std::string& filename,
+                   bool append,
+                   int compressionLevel);
+    ~DumpH5MDStream() override;
+
+    void perform_action() override { dump(); }
+
+    /// Gather the current configuration and queue it for writing.
+    void dump();
+    /// Wait until all queued frames are written and flush the file.
+    void flush();
+    /// Write the queued frames and close the file. A later dump() appends to it.
+    void close();
+
+    /// Whether frames are written by a background thread, see the class description.
+    bool getBackground() const { return background; }
+
+    std::string author = "xxx";
+    std::string particleGroupName = "atoms";
+
+    /// Which properties to write, fixed by the first dump() to a new file.
+    bool dumpId = true;
+    bool dumpType = true;
+    bool dumpMass = true;
+    bool dumpQ = true;
+    bool dumpPosition = true;
+    bool dumpImage = true;
+    bool dumpVelocity = true;
+    bool dumpForce = false;
+
+    /// Deflate level of the value datasets, 0 disables compression.
+    int compressionLevel = 0;
+
+    static void registerPython();
+
+private:
+    /// One configuration, interleaved per particle in the order it was gathered.
+    struct Frame
+    {
+        int64_t step = 0;
+        double time = 0.;
+        double edges[3] = {0., 0., 0.};
+        std::vector<int64_t> ints;  ///< id, type, image
+        std::vector<double> reals;  ///< mass, charge, position, velocity, force
+    };
+
+    enum Property
+    {
+        ID,
+        SPECIES,
+        IMAGE,
+        MASS,
+        CHARGE,
+        POSITION,
+        VELOCITY,
+        FORCE,
+        EDGES
+    };
+
+    /// H5MD time-dependent element, its columns are taken from ints or reals of a frame.
+    struct Element
+    {
+        Property property;
+        std::string name;
+        bool isInt;
+        int offset;
+        int dimension;
+        hid_t value = -1;
+        hid_t step = -1;
+        hid_t time = -1;
+
+        bool perParticle() const { return property != EDGES; }
+        /// shape of the value dataset without the frame axis
+        std::vector<hsize_t> shape(int64_t numParticles) const;
+    };
+
+    void setupLayout();
+    void writerLoop();
+    /// Write a frame unless an earlier one failed, then hand its buffer back.
+    void write(std::unique_ptr<Frame> frame);
+    void rethrowWriterError();
+    void openFile(int64_t numParticles);
+    void createElement(hid_t group, Element& e, int64_t numParticles);
+    void openElement(hid_t group, Element& e, int64_t numParticles);
+    void writeFrame(const Frame& frame);
+    void closeFile();
+
+    shared_ptr<integrator::MDIntegrator> integrator_;
+    std::string filename_;
+    bool append_;
+
+    MPI_Comm comm = MPI_COMM_NULL;
+    int rank = -1;
+
+    // layout of the gathered data, number of int and real columns per particle
+    bool layoutDone = false;
+    int numInts = 0;
+    int numReals = 0;
+    std::vector<Element> elements;
+    int64_t numTotalParticles = -1;
+
+    // gather buffers
+    std::vector<int64_t> sendInts;
+    std::vector<double> sendReals;
+    std::vector<int> counts, displs;
+
+    // frames handed to the writer and free buffers, guarded by mutex
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<std::unique_ptr<Frame>> queue;
+    std::vector<std::unique_ptr<Frame>> freeFrames;
+    bool busy = false;
+    bool stop = false;
+    std::exception_ptr writerError;
+    bool background = false;
+    std::thread writer;
+
+    // state of the writer thread
+    hid_t fileId = -1;
+    hsize_t numFrames = 0;
+    std::vector<int64_t> order;
+    std::vector<int64_t> scratchInts;
+    std::vector<double> scratchReals;
+};
+
+}  // namespace io
+}  // namespace espressopp
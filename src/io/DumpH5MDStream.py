@@ -0,0 +1,108 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+******************************
+espressopp.io.DumpH5MDStream
+******************************
+
+Writes a trajectory into a single H5MD file. Every selected property is stored as a
+time-dependent element ``/particles/<particleGroupName>/<name>/{value,step,time}``
+with chunked datasets that grow by one frame per dump, the particles ordered by id.
+The box edges are stored as the element ``box/edges``.
+
+``dump()`` only gathers the particles to the first rank and returns; the frame is
+written by a background thread there while the simulation continues. ``flush()``
+waits for all frames to be written, ``close()`` also closes the file.
+
+The background thread needs an HDF5 library built thread-safe, otherwise it could call
+HDF5 while DumpH5MDParallel or h5py do; ``background`` tells whether it is used. Without
+it ``dump()`` writes the frame itself. A failed write is raised by the next ``dump()``,
+``flush()`` or ``close()``.
+
+.. function:: espressopp.io.DumpH5MDStream(system, integrator, filename, append=False, compression=0)
+
+    :param system: the system
+    :param integrator: the integrator, provides step and time of the frames
+    :param str filename: name of the H5MD file
+    :param bool append: append to an existing file instead of backing it up and starting
+        a new one; the file has to hold the same properties and number of particles
+    :param int compression: deflate level 1-9 of the value datasets, 0 disables compression
+
+Properties, to be set before the first dump():
+
+* ``dumpId``, ``dumpType``, ``dumpMass``, ``dumpQ``, ``dumpPosition``, ``dumpImage``,
+  ``dumpVelocity`` (all True), ``dumpForce`` (False): write the element ``id``, ``species``,
+  ``mass``, ``charge``, ``position``, ``image``, ``velocity``, ``force``
+* ``author``, ``particleGroupName`` (``atoms``)
+* ``compressionLevel``
+* ``background`` (read-only): whether a background thread writes the frames
+
+Example, a frame every 100 steps:
+
+>>> traj = espressopp.io.DumpH5MDStream(system, integrator, 'traj.h5', compression=4)
+>>> ext_dump = espressopp.integrator.ExtAnalyze(traj, 100)
+>>> integrator.addExtension(ext_dump)
+>>> integrator.run(100000)
+>>> traj.close()
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.ParticleAccess import *
+from _espressopp import io_DumpH5MDStream
+
+
+class DumpH5MDStreamLocal(ParticleAccessLocal, io_DumpH5MDStream):
+    def __init__(self, system, integrator, filename, append=False, compression=0):
+        if pmi.workerIsActive():
+            cxxinit(self, io_DumpH5MDStream, system, integrator, filename, append, compression)
+
+    def dump(self):
+        if pmi.workerIsActive():
+            self.cxxclass.dump(self)
+
+    def flush(self):
+        if pmi.workerIsActive():
+            self.cxxclass.flush(self)
+
+    def close(self):
+        if pmi.workerIsActive():
+            self.cxxclass.close(self)
+
+
+if pmi.isController:
+    class DumpH5MDStream(ParticleAccess, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls='espressopp.io.DumpH5MDStreamLocal',
+            pmicall=['dump', 'flush', 'close'],
+            pmiproperty=[
+            'dumpId',
+            'dumpType',
+            'dumpMass',
+            'dumpQ',
+            'dumpPosition',
+            'dumpImage',
+            'dumpVelocity',
+            'dumpForce',
+            'compressionLevel',
+            'background',
+            'particleGroupName',
+            'author'
+            ])
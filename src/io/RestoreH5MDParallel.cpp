@@ -20,6 +20,14 @@
 
 #include "RestoreH5MDParallel.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "FixedPairList.hpp"
+#include "FixedQuadrupleList.hpp"
+#include "FixedTripleList.hpp"
+#include "esutil/Collectives.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "storage/Storage.hpp"
 
@@ -30,7 +38,8 @@ namespace io
 template <typename T>
 void RestoreH5MDParallel::readParallel(hid_t fileId,
                                        const std::string& dataset,
-                                       std::vector<T>& data)
+                                       std::vector<T>& data,
+                                       bool timeDependent)
 {
     auto dset = CHECK_HDF5(H5Dopen(fileId, dataset.c_str(), H5P_DEFAULT));
     auto dspace = CHECK_HDF5(H5Dget_space(dset));
@@ -43,21 +52,23 @@ void RestoreH5MDParallel::readParallel(hid_t fileId,
     CHECK_HDF5(H5Sget_simple_extent_dims(dspace, globalDims.data(), nullptr));
 
     // get local dimensions and offset
+    const std::size_t axis = timeDependent ? 1 : 0;
+    CHECK_GREATER(int_c(globalDims.size()), int_c(axis));
     std::vector<hsize_t> localDims = globalDims;
     hsize_t localOffset = 0;
     for (auto rk = 0; rk < rank; ++rk)
     {
-        localOffset += globalDims[1] / uint_c(numProcesses) +
-                       (globalDims[1] % uint_c(numProcesses) > uint_c(rk) ? 1ul : 0ul);
+        localOffset += globalDims[axis] / uint_c(numProcesses) +
+                       (globalDims[axis] % uint_c(numProcesses) > uint_c(rk) ? 1ul : 0ul);
     }
-    auto localSize = globalDims[1] / uint_c(numProcesses) +
-                     (globalDims[1] % uint_c(numProcesses) > uint_c(rank) ? 1ul : 0ul);
-    localDims[0] = 1;  // only read one timeframe
-    localDims[1] = localSize;
+    auto localSize = globalDims[axis] / uint_c(numProcesses) +
+                     (globalDims[axis] % uint_c(numProcesses) > uint_c(rank) ? 1ul : 0ul);
+    if (timeDependent) localDims[0] = 1;  // only read one timeframe
+    localDims[axis] = localSize;
 
     // set up local part of the input file
     std::vector<hsize_t> offset(globalDims.size(), 0);
-    offset[1] = localOffset;
+    offset[axis] = localOffset;
     std::vector<hsize_t> stride(globalDims.size(), 1);
     std::vector<hsize_t> count(globalDims.size(), 1);
     // check if in bounds
@@ -97,7 +108,7 @@ void RestoreH5MDParallel::updateCache()
     rank = world.rank();
 }
 
-void RestoreH5MDParallel::restore()
+hid_t RestoreH5MDParallel::openFile()
 {
     updateCache();
 
@@ -107,92 +118,209 @@ void RestoreH5MDParallel::restore()
     CHECK_HDF5(H5Pset_fapl_mpio(plist, comm, info));
 
     auto fileId = CHECK_HDF5(H5Fopen(filename_.c_str(), H5F_ACC_RDONLY, plist));
-    std::vector<int64_t> id;
-    if (restoreId)
-    {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + idDataset + "/value", id);
-        CHECK_EQUAL(id.size() * 1, id.size());
-    }
-    std::vector<int64_t> type;
+    CHECK_HDF5(H5Pclose(plist));
+    return fileId;
+}
+
+void RestoreH5MDParallel::restore()
+{
+    CHECK_TRUE(restoreId && restorePosition, "particles need an id and a position");
+
+    auto fileId = openFile();
+    auto group = "/particles/" + particleGroupName + "/";
+
+    // longint is narrower than the int64 datasets, so the integer columns are copied
+    storage::Storage::ParticleArrays arrays;
+
+    std::vector<int64_t> id64;
+    readParallel(fileId, group + idDataset + "/value", id64);
+    std::vector<longint> id(id64.begin(), id64.end());
+    arrays.n = id.size();
+    arrays.id = id.data();
+
+    std::vector<real> position;
+    readParallel(fileId, group + positionDataset + "/value", position);
+    CHECK_EQUAL(id.size() * 3, position.size());
+    arrays.pos = position.data();
+
+    std::vector<longint> type;
     if (restoreType)
     {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + typeDataset + "/value",
-                     type);
-        CHECK_EQUAL(id.size() * 1, type.size());
+        std::vector<int64_t> type64;
+        readParallel(fileId, group + typeDataset + "/value", type64);
+        CHECK_EQUAL(id.size() * 1, type64.size());
+        type.assign(type64.begin(), type64.end());
+        arrays.type = type.data();
     }
-    std::vector<double> mass;
+    std::vector<real> mass;
     if (restoreMass)
     {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + massDataset + "/value",
-                     mass);
+        readParallel(fileId, group + massDataset + "/value", mass);
         CHECK_EQUAL(id.size() * 1, mass.size());
+        arrays.mass = mass.data();
     }
-    std::vector<double> q;
+    std::vector<real> q;
     if (restoreQ)
     {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + qDataset + "/value", q);
+        readParallel(fileId, group + qDataset + "/value", q);
         CHECK_EQUAL(id.size() * 1, q.size());
+        arrays.q = q.data();
     }
-    std::vector<int8_t> ghost;
-    if (restoreGhost)
-    {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + ghostDataset + "/value",
-                     ghost);
-        CHECK_EQUAL(id.size() * 1, ghost.size());
-    }
-    std::vector<double> position;
-    if (restorePosition)
-    {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + positionDataset + "/value",
-                     position);
-        CHECK_EQUAL(id.size() * 3, position.size());
-    }
-    std::vector<double> velocity;
+    std::vector<real> velocity;
     if (restoreVelocity)
     {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + velocityDataset + "/value",
-                     velocity);
+        readParallel(fileId, group + velocityDataset + "/value", velocity);
         CHECK_EQUAL(id.size() * 3, velocity.size());
+        arrays.v = velocity.data();
     }
-    std::vector<double> force;
+    std::vector<real> force;
     if (restoreForce)
     {
-        readParallel(fileId, "/particles/" + particleGroupName + "/" + forceDataset + "/value",
-                     force);
+        readParallel(fileId, group + forceDataset + "/value", force);
         CHECK_EQUAL(id.size() * 3, force.size());
+        arrays.f = force.data();
+    }
+    std::vector<longint> image;
+    if (restoreImage)
+    {
+        std::vector<int64_t> image64;
+        readParallel(fileId, group + imageDataset + "/value", image64);
+        CHECK_EQUAL(id.size() * 3, image64.size());
+        image.assign(image64.begin(), image64.end());
+        arrays.image = image.data();
     }
 
-    for (auto i = 0; i < int_c(id.size()); ++i)
+    CHECK_HDF5(H5Fclose(fileId));
+
+    // one all-to-all exchange moves every particle to the process of its subdomain
+    auto numParticles = boost::mpi::all_reduce(*system_->comm, longint(id.size()),
+                                               std::plus<longint>());
+    auto numAdded = system_->storage->addParticleArrays(arrays, true);
+    CHECK_EQUAL(numAdded, numParticles, "particle ids in " << filename_ << " are not unique");
+}
+
+template <std::size_t N>
+std::vector<std::array<longint, N>> RestoreH5MDParallel::readTuples(const std::string& name)
+{
+    auto fileId = openFile();
+    auto path = "/connectivity/" + name;
+
+    // a time dependent dataset is a group with step, time and value
+    auto object = CHECK_HDF5(H5Oopen(fileId, path.c_str(), H5P_DEFAULT));
+    bool timeDependent = H5Iget_type(object) == H5I_GROUP;
+    CHECK_HDF5(H5Oclose(object));
+
+    std::vector<int64_t> data;
+    readParallel(fileId, timeDependent ? path + "/value" : path, data, timeDependent);
+    CHECK_HDF5(H5Fclose(fileId));
+    CHECK_EQUAL(data.size() % N, 0ul, path << " does not hold tuples of " << N);
+
+    std::vector<std::array<longint, N>> tuples;
+    tuples.reserve(data.size() / N);
+    for (std::size_t i = 0; i < data.size(); i += N)
     {
-        auto pos = Real3D(position[i * 3 + 0], position[i * 3 + 1], position[i * 3 + 2]);
-        auto particle = system_->storage->addParticle(int_c(id[i]), pos, false);
-        CHECK_NOT_NULLPTR(particle, "particle creation was rejected!");
-        if (restoreId) particle->id() = id[i];
-        if (restoreType) particle->type() = type[i];
-        if (restoreMass) particle->mass() = mass[i];
-        if (restoreQ) particle->q() = q[i];
-        if (restoreGhost) particle->ghost() = ghost[i];
-        if (restorePosition)
-        {
-            particle->position()[0] = position[i * 3 + 0];
-            particle->position()[1] = position[i * 3 + 1];
-            particle->position()[2] = position[i * 3 + 2];
-        }
-        if (restoreVelocity)
-        {
-            particle->velocity()[0] = velocity[i * 3 + 0];
-            particle->velocity()[1] = velocity[i * 3 + 1];
-            particle->velocity()[2] = velocity[i * 3 + 2];
-        }
-        if (restoreForce)
+        if (std::any_of(&data[i], &data[i] + N, [](int64_t pid) { return pid < 0; })) continue;
+        std::array<longint, N> tuple;
+        std::copy(&data[i], &data[i] + N, tuple.begin());
+        tuples.push_back(tuple);
+    }
+    return tuples;
+}
+
+template <std::size_t N, class AddFunction>
+void RestoreH5MDParallel::distributeTuples(std::vector<std::array<longint, N>>& tuples,
+                                           std::size_t key,
+                                           AddFunction add)
+{
+    auto& storage = *system_->storage;
+    auto& world = *system_->comm;
+    int size = world.size();
+    int me = world.rank();
+
+    // the ghost layer has to be up to date for the non-key particles
+    storage.decompose();
+
+    // the owner of particle id is registered on process id % size, and the tuples are
+    // routed over that process to the owner of their key particle
+    std::vector<std::vector<std::pair<longint, int>>> owners(size);
+    for (iterator::CellListIterator cit(storage.getRealCells()); !cit.isDone(); ++cit)
+    {
+        longint pid = cit->id();
+        owners[pid % size].emplace_back(pid, me);
+    }
+    std::vector<std::pair<longint, int>> send, recv;
+    std::vector<int> counts(size);
+    for (int i = 0; i < size; i++)
+    {
+        send.insert(send.end(), owners[i].begin(), owners[i].end());
+        counts[i] = owners[i].size();
+    }
+    esutil::Collectives::alltoallv(world, send, counts, recv);
+    std::unordered_map<longint, int> ownerOf(recv.begin(), recv.end());
+
+    auto exchange = [&](auto destination)
+    {
+        std::vector<std::vector<std::array<longint, N>>> blocks(size);
+        for (auto& tuple : tuples) blocks[destination(tuple)].push_back(tuple);
+        std::vector<std::array<longint, N>> sendTuples;
+        for (int i = 0; i < size; i++)
         {
-            particle->force()[0] = force[i * 3 + 0];
-            particle->force()[1] = force[i * 3 + 1];
-            particle->force()[2] = force[i * 3 + 2];
+            sendTuples.insert(sendTuples.end(), blocks[i].begin(), blocks[i].end());
+            counts[i] = blocks[i].size();
         }
+        esutil::Collectives::alltoallv(world, sendTuples, counts, tuples);
+    };
+
+    exchange([&](const std::array<longint, N>& tuple) { return tuple[key] % size; });
+
+    longint numUnknown = std::count_if(tuples.begin(), tuples.end(),
+                                       [&](const std::array<longint, N>& tuple)
+                                       { return ownerOf.count(tuple[key]) == 0; });
+    numUnknown = boost::mpi::all_reduce(world, numUnknown, std::plus<longint>());
+    if (numUnknown > 0)
+    {
+        throw std::runtime_error("RestoreH5MDParallel: " + std::to_string(numUnknown) +
+                                 " tuples refer to particles that do not exist");
     }
 
-    CHECK_HDF5(H5Fclose(fileId));
+    exchange([&](const std::array<longint, N>& tuple) { return ownerOf[tuple[key]]; });
+
+    // add() of the lists may check for errors collectively, so all processes call it
+    // equally often; the id -1 does not exist and such a call adds nothing
+    longint numCalls =
+        boost::mpi::all_reduce(world, longint(tuples.size()), boost::mpi::maximum<longint>());
+    std::array<longint, N> none;
+    none.fill(-1);
+    for (longint i = 0; i < numCalls; i++)
+    {
+        add(i < longint(tuples.size()) ? tuples[i] : none);
+    }
+}
+
+void RestoreH5MDParallel::restorePairs(const shared_ptr<FixedPairList>& fpl,
+                                       const std::string& name)
+{
+    auto pairs = readTuples<2>(name);
+    // the pair belongs to the particle with the lower id
+    for (auto& pair : pairs)
+        if (pair[0] > pair[1]) std::swap(pair[0], pair[1]);
+    distributeTuples(pairs, 0, [&](const std::array<longint, 2>& t) { fpl->add(t[0], t[1]); });
+}
+
+void RestoreH5MDParallel::restoreTriples(const shared_ptr<FixedTripleList>& ftl,
+                                         const std::string& name)
+{
+    auto triples = readTuples<3>(name);
+    distributeTuples(triples, 1,
+                     [&](const std::array<longint, 3>& t) { ftl->add(t[0], t[1], t[2]); });
+}
+
+void RestoreH5MDParallel::restoreQuadruples(const shared_ptr<FixedQuadrupleList>& fql,
+                                            const std::string& name)
+{
+    auto quadruples = readTuples<4>(name);
+    distributeTuples(quadruples, 0, [&](const std::array<longint, 4>& t)
+                     { fql->add(t[0], t[1], t[2], t[3]); });
 }
 
 void RestoreH5MDParallel::registerPython()
@@ -209,6 +337,7 @@ void RestoreH5MDParallel::registerPython()
         .def_readwrite("restorePosition", &RestoreH5MDParallel::restorePosition)
         .def_readwrite("restoreVelocity", &RestoreH5MDParallel::restoreVelocity)
         .def_readwrite("restoreForce", &RestoreH5MDParallel::restoreForce)
+        .def_readwrite("restoreImage", &RestoreH5MDParallel::restoreImage)
         .def_readwrite("idDataset", &RestoreH5MDParallel::idDataset)
         .def_readwrite("typeDataset", &RestoreH5MDParallel::typeDataset)
         .def_readwrite("massDataset", &RestoreH5MDParallel::massDataset)
@@ -217,7 +346,11 @@ void RestoreH5MDParallel::registerPython()
         .def_readwrite("positionDataset", &RestoreH5MDParallel::positionDataset)
         .def_readwrite("velocityDataset", &RestoreH5MDParallel::velocityDataset)
         .def_readwrite("forceDataset", &RestoreH5MDParallel::forceDataset)
-        .def("restore", &RestoreH5MDParallel::restore);
+        .def_readwrite("imageDataset", &RestoreH5MDParallel::imageDataset)
+        .def("restore", &RestoreH5MDParallel::restore)
+        .def("restorePairs", &RestoreH5MDParallel::restorePairs)
+        .def("restoreTriples", &RestoreH5MDParallel::restoreTriples)
+        .def("restoreQuadruples", &RestoreH5MDParallel::restoreQuadruples);
 }
 }  // namespace io
 }  // namespace espressopp
\ No newline at end of file
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 
 #include "System.hpp"
@@ -29,8 +30,16 @@
 
 namespace espressopp
 {
+class FixedPairList;
+class FixedTripleList;
+class FixedQuadrupleList;
+
 namespace io
 {
+/** Loads particles and connectivity from an H5MD file. Every process reads an equal
+    share of the particle and tuple datasets, the particles and tuples are then sent to
+    the processes owning them in one collective step.
+*/
 class RestoreH5MDParallel
 {
 public:
@@ -39,8 +48,17 @@ public:
     {
     }
 
+    /// Add the particles of the first timeframe, ids and positions are mandatory.
     void restore();
 
+    /** Add the tuples of /connectivity/<name> to the list. The dataset is either fixed
+        (N x 2) or time dependent, then the first timeframe is used. Rows with negative
+        ids are padding and skipped. The particles have to be restored before.
+    */
+    void restorePairs(const shared_ptr<FixedPairList>& fpl, const std::string& name);
+    void restoreTriples(const shared_ptr<FixedTripleList>& ftl, const std::string& name);
+    void restoreQuadruples(const shared_ptr<FixedQuadrupleList>& fql, const std::string& name);
+
     std::string author = "xxx";
     std::string particleGroupName = "atoms";
 
@@ -48,10 +66,12 @@ public:
     bool restoreType = true;
     bool restoreMass = true;
     bool restoreQ = true;
+    /// restored particles are always real, the flag is kept for existing scripts
     bool restoreGhost = true;
     bool restorePosition = true;
     bool restoreVelocity = true;
     bool restoreForce = true;
+    bool restoreImage = false;
 
     std::string idDataset = "id";
     std::string typeDataset = "type";
@@ -61,14 +81,36 @@ public:
     std::string positionDataset = "position";
     std::string velocityDataset = "velocity";
     std::string forceDataset = "force";
+    std::string imageDataset = "image";
 
     static void registerPython();
 
 private:
     void updateCache();
 
+    hid_t openFile();
+
+    /** Read the local share of a dataset. The particles (or tuples) are distributed
+        along the second dimension of a time dependent dataset, of which only the first
+        timeframe is read, and along the first dimension of a fixed one.
+    */
     template <typename T>
-    void readParallel(hid_t fileId, const std::string& name, std::vector<T>& data);
+    void readParallel(hid_t fileId,
+                      const std::string& name,
+                      std::vector<T>& data,
+                      bool timeDependent = true);
+
+    /// local share of the valid tuples of /connectivity/<name>
+    template <std::size_t N>
+    std::vector<std::array<longint, N>> readTuples(const std::string& name);
+
+    /** Send every tuple to the process owning the real particle tuple[key] and add the
+        tuples received there with add(tuple).
+    */
+    template <std::size_t N, class AddFunction>
+    void distributeTuples(std::vector<std::array<longint, N>>& tuples,
+                          std::size_t key,
+                          AddFunction add);
 
     shared_ptr<System> system_ = nullptr;
     std::string filename_ = "";  ///<  output filename
@@ -29,12 +29,24 @@ class RestoreH5MDLocalParallel(io_RestoreH5MDParallel):
         if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.restore(self)
 
+    def restorePairs(self, fpl, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.restorePairs(self, fpl, name)
+
+    def restoreTriples(self, ftl, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.restoreTriples(self, ftl, name)
+
+    def restoreQuadruples(self, fql, name):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive() ) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.restoreQuadruples(self, fql, name)
+
 
 if pmi.isController:
     class RestoreH5MDParallel(object, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
             cls='espressopp.io.RestoreH5MDLocalParallel',
-            pmicall=['restore'],
+            pmicall=['restore', 'restorePairs', 'restoreTriples', 'restoreQuadruples'],
             pmiproperty=[
             'restoreId',
             'restoreType',
@@ -44,6 +56,7 @@ if pmi.isController:
             'restorePosition',
             'restoreVelocity',
             'restoreForce',
+            'restoreImage',
             'idDataset',
             'typeDataset',
             'massDataset',
@@ -52,5 +65,6 @@ if pmi.isController:
             'positionDataset',
             'velocityDataset',
             'forceDataset',
+            'imageDataset',
             'author'
             ])
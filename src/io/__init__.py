@@ -40,6 +40,8 @@ except ImportError:
 
 from espressopp.io.DumpH5MD import *
 from espressopp.io.DumpH5MDParallel import *
+from espressopp.io.DumpH5MDStream import *
 from espressopp.io.DumpTopology import *
 
 from espressopp.io.RestoreH5MDParallel import *
+from espressopp.io.Checkpoint import *
@@ -25,11 +25,13 @@
 */
 
 #include "bindings.hpp"
+#include "Checkpoint.hpp"
 #include "DumpXYZ.hpp"
 #include "DumpGRO.hpp"
 #include "DumpGROAdress.hpp"
 #include "DumpH5MD.hpp"
 #include "DumpH5MDParallel.hpp"
+#include "DumpH5MDStream.hpp"
 #include "DumpTopology.hpp"
 #include "FileBackup.hpp"
 #include "RestoreH5MDParallel.hpp"
@@ -50,12 +52,14 @@ void registerPython()
     DumpGROAdress::registerPython();
     DumpH5MD::registerPython();
     DumpH5MDParallel::registerPython();
+    DumpH5MDStream::registerPython();
     DumpTopology::registerPython();
 #ifdef HAS_GROMACS
     DumpXTC::registerPython();
     DumpXTCAdress::registerPython();
 #endif
     RestoreH5MDParallel::registerPython();
+    Checkpoint::registerPython();
 }
 }  // namespace io
 }  // namespace espressopp
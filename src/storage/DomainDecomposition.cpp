@@ -85,11 +85,28 @@ DomainDecomposition::DomainDecomposition(std::shared_ptr<System> _system,
 }
 
 void DomainDecomposition::createCellGrid(const Int3D& _nodeGrid, const Int3D& _cellGrid)
+{
+    setEvenCellBorders(_nodeGrid, _cellGrid);
+    createCellGrid(_nodeGrid);
+}
+
+void DomainDecomposition::setEvenCellBorders(const Int3D& _nodeGrid, const Int3D& _cellGrid)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        cellBorders[i].resize(_nodeGrid[i] + 1);
+        for (int k = 0; k <= _nodeGrid[i]; ++k) cellBorders[i][k] = k * _cellGrid[i];
+    }
+}
+
+void DomainDecomposition::createCellGrid(const Int3D& _nodeGrid)
 {
     real myLeft[3];
     real myRight[3];
+    Int3D _cellGrid;
 
-    nodeGrid = NodeGrid(_nodeGrid, getSystem()->comm->rank(), getSystem()->bc->getBoxL());
+    Real3D boxL = getSystem()->bc->getBoxL();
+    nodeGrid = NodeGrid(_nodeGrid, getSystem()->comm->rank(), boxL);
 
     if (nodeGrid.getNumberOfCells() != getSystem()->comm->size())
     {
@@ -110,6 +127,16 @@ void DomainDecomposition::createCellGrid(const Int3D& _nodeGrid, const Int3D& _c
 
     for (int i = 0; i < 3; ++i)
     {
+        // the borders are multiples of the cell size of the whole box
+        std::vector<real> borders(cellBorders[i].size());
+        for (size_t k = 0; k < borders.size(); ++k)
+        {
+            borders[k] = boxL[i] * cellBorders[i][k] / cellBorders[i].back();
+        }
+        nodeGrid.setBorders(i, borders);
+
+        int pos = nodeGrid.getNodePosition(i);
+        _cellGrid[i] = cellBorders[i][pos + 1] - cellBorders[i][pos];
         myLeft[i] = nodeGrid.getMyLeft(i);
         myRight[i] = nodeGrid.getMyRight(i);
     }
@@ -270,6 +297,22 @@ void DomainDecomposition::cellAdjust(bool withShear = false)
     // if (getSystem()->comm->rank() == 0)
     //  std::cout << " Corrected DOMDEC [" << getInt3DNodeGrid() << "](" << _newCellGrid << ") \n";
 
+    setEvenCellBorders(_nodeGrid, _newCellGrid);
+    rebuildCells(_nodeGrid);
+    // the borders may have been moved by rebalance()
+    decomposeRealParticles();
+
+    exchangeGhosts();
+
+    /// modify cell structure first before resorting
+    /// particles and rebuilding neighbor lists
+    onCellAdjust();
+
+    onParticlesChanged();
+}
+
+void DomainDecomposition::rebuildCells(const Int3D& _nodeGrid)
+{
     // save all particles to temporary vector
     std::vector<ParticleList> tmp_pl;
     size_t _N = realCells.size();
@@ -292,7 +335,7 @@ void DomainDecomposition::cellAdjust(bool withShear = false)
     }
 
     // creating new grids
-    createCellGrid(_nodeGrid, _newCellGrid);
+    createCellGrid(_nodeGrid);
     initCellInteractions();
     prepareGhostCommunication();
 
@@ -312,14 +355,97 @@ void DomainDecomposition::cellAdjust(bool withShear = false)
     {
         updateLocalParticles((*it)->particles);
     }
+}
+
+bool DomainDecomposition::rebalance(real cost)
+{
+    System& system = getSystemRef();
+    if (system.ifShear)
+    {
+        esutil::Error err(system.comm);
+        err.setException("DomainDecomposition: load balancing does not support shear flow");
+        err.checkException();
+    }
 
+    // the cost profile along each axis in cells of the whole box, all axes in one array.
+    // The cost of this node goes to its cells in proportion to their particles plus one,
+    // so that empty cells are not for free
+    int offset[4] = {0};
+    for (int i = 0; i < 3; ++i) offset[i + 1] = offset[i] + getGlobalCellGridSize(i);
+
+    vector<real> profile(offset[3], 0.0), totProfile(offset[3]);
+    real weight = cost / (getNRealParticles() + realCells.size());
+    int frame = cellGrid.getFrameWidth();
+    Int3D c;
+    for (c[2] = cellGrid.getInnerCellsBegin(2); c[2] < cellGrid.getInnerCellsEnd(2); ++c[2])
+    {
+        for (c[1] = cellGrid.getInnerCellsBegin(1); c[1] < cellGrid.getInnerCellsEnd(1); ++c[1])
+        {
+            for (c[0] = cellGrid.getInnerCellsBegin(0); c[0] < cellGrid.getInnerCellsEnd(0);
+                 ++c[0])
+            {
+                const Cell& cell = cells[cellGrid.mapPositionToIndex(c)];
+                real w = weight * (cell.particles.size() + 1);
+                for (int i = 0; i < 3; ++i)
+                {
+                    int pos = nodeGrid.getNodePosition(i);
+                    profile[offset[i] + cellBorders[i][pos] + c[i] - frame] += w;
+                }
+            }
+        }
+    }
+    mpi::all_reduce(*system.comm, profile.data(), offset[3], totProfile.data(), plus<real>());
+
+    // every node layer needs at least as many cells as the ghost frame is wide
+    bool moved = false;
+    for (int i = 0; i < 3; ++i)
+    {
+        int n = nodeGrid.getGridSize(i);
+        int G = getGlobalCellGridSize(i);
+        const real* p = &totProfile[offset[i]];
+
+        vector<real> sum(G + 1, 0.0);
+        for (int k = 0; k < G; ++k) sum[k + 1] = sum[k] + p[k];
+        if (sum[G] <= 0.0) continue;
+
+        int border = 0;
+        for (int k = 1; k < n; ++k)
+        {
+            // the cell border closest to an equal share of the cost
+            real target = sum[G] * k / n;
+            int b = int(upper_bound(sum.begin(), sum.end(), target) - sum.begin()) - 1;
+            if (b < G && target - sum[b] > sum[b + 1] - target) ++b;
+
+            b = max(b, border + frame);
+            b = min(b, G - (n - k) * frame);
+            moved = moved || b != cellBorders[i][k];
+            cellBorders[i][k] = border = b;
+        }
+    }
+    if (!moved) return false;
+
+    rebuildCells(getInt3DNodeGrid());
+    LOG4ESPP_INFO(logger, "load balancing, new local cell grid " << getInt3DCellGrid());
+
+    // particles outside of their new domain travel to their new owners
+    decomposeRealParticles();
     exchangeGhosts();
 
-    /// modify cell structure first before resorting
-    /// particles and rebuilding neighbor lists
     onCellAdjust();
-
     onParticlesChanged();
+    return true;
+}
+
+python::list DomainDecomposition::getCellBorders() const
+{
+    python::list borders;
+    for (int i = 0; i < 3; ++i)
+    {
+        python::list axis;
+        for (int b : cellBorders[i]) axis.append(b);
+        borders.append(axis);
+    }
+    return borders;
 }
 
 void DomainDecomposition::initCellInteractions()
@@ -1188,6 +1314,7 @@ void DomainDecomposition::updateGhosts()
 {
     LOG4ESPP_DEBUG(logger, "updateGhosts -> ghost communication no sizes, real->ghost");
     doGhostCommunication(false, true, dataOfUpdateGhosts);
+    onParticlesModified();
 }
 
 void DomainDecomposition::updateGhostsV()
@@ -1928,6 +2055,8 @@ void DomainDecomposition::registerPython()
         .def("mapPositionToNodeClipped", &DomainDecomposition::mapPositionToNodeClipped)
         .def("getCellGrid", &DomainDecomposition::getInt3DCellGrid)
         .def("getNodeGrid", &DomainDecomposition::getInt3DNodeGrid)
+        .def("getCellBorders", &DomainDecomposition::getCellBorders)
+        .def("rebalance", &DomainDecomposition::rebalance)
         // .def("cellAdjust", &DomainDecomposition::cellAdjust);
         .def("cellAdjust", pyCellAdjust);
 }
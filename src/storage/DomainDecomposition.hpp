@@ -73,6 +73,22 @@ public:
     const NodeGrid& getNodeGrid() const { return nodeGrid; }
     const CellGrid& getCellGrid() const { return cellGrid; }
 
+    /// global index of the first cell of node layer k along an axis
+    int getCellBorder(int axis, int k) const { return cellBorders[axis][k]; }
+    /// number of cells of the whole box along an axis
+    int getGlobalCellGridSize(int axis) const { return cellBorders[axis].back(); }
+    /// the cell borders of all axes, mainly in order to use from python
+    python::list getCellBorders() const;
+
+    /** Dynamic load balancing: move the node borders so that the work is spread
+        evenly. cost is the work of this node, e.g. the time spent on the forces
+        since the last call. It is shared out to the cells in proportion to their
+        particles, and along every axis the borders are shifted by whole cells so
+        that each node layer gets the same part of the total. Particles outside of
+        their new domain are sent to their new owners. Has to be called on all nodes;
+        returns true if a border has moved. cellAdjust() returns to even borders. */
+    bool rebalance(real cost);
+
     virtual real getLocalBoxXMin() { return nodeGrid.getMyLeft(0); }
     virtual real getLocalBoxYMin() { return nodeGrid.getMyLeft(1); }
     virtual real getLocalBoxZMin() { return nodeGrid.getMyLeft(2); }
@@ -101,8 +117,14 @@ protected:
     void initCellInteractions();
     /// reset connection of neighbour cells
     void remapNeighbourCells(int cell_shift);
-    /// set the grids and allocate space accordingly
+    /// set the grids and allocate space accordingly, cellGrid cells per node
     void createCellGrid(const Int3D& nodeGrid, const Int3D& cellGrid);
+    /// set the grids with the node borders in cellBorders
+    void createCellGrid(const Int3D& nodeGrid);
+    /// give every node cellGrid cells
+    void setEvenCellBorders(const Int3D& nodeGrid, const Int3D& cellGrid);
+    /// create the cells again, e.g. after changing the grids, and put the real particles back
+    void rebuildCells(const Int3D& nodeGrid);
     /// sort cells into local/ghost cell arrays
     void markCells();
     /// fill a list of cells with the cells from a certain region of the domain grid
@@ -121,6 +143,9 @@ protected:
     /// spatial domain decomposition on node in cells
     CellGrid cellGrid;
 
+    /// borders of the node layers along each axis in cells of the whole box
+    std::vector<int> cellBorders[3];
+
     /// expected capacity of send/recv buffers for neighbor communication
     size_t exchangeBufferSize;
 
@@ -45,6 +45,21 @@ espressopp.storage.DomainDecomposition
 .. function:: espressopp.storage.DomainDecomposition.getNodeGrid()
 
                 :rtype:
+
+.. function:: espressopp.storage.DomainDecomposition.getCellBorders()
+
+                :return: for each axis the borders of the node layers, in cells of the whole box
+                :rtype: list of three lists of ints
+
+.. function:: espressopp.storage.DomainDecomposition.rebalance(cost)
+
+                moves the node borders so that the work is spread evenly, see
+                espressopp.integrator.LoadBalancer which calls it during a run
+
+                :param cost: work of this CPU, e.g. the force time since the last call
+                :type cost: real
+                :return: whether a border has moved
+                :rtype: bool
 """
 from espressopp import pmi
 from espressopp.esutil import cxxinit
@@ -74,11 +89,19 @@ class DomainDecompositionLocal(StorageLocal, storage_DomainDecomposition):
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.cellAdjust(self, shear)
 
+    def getCellBorders(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getCellBorders(self)
+
+    def rebalance(self, cost):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.rebalance(self, cost)
+
 if pmi.isController:
     class DomainDecomposition(Storage):
         pmiproxydefs = dict(
           cls = 'espressopp.storage.DomainDecompositionLocal',
-          pmicall = ['getCellGrid', 'getNodeGrid', 'cellAdjust'],
+          pmicall = ['getCellGrid', 'getNodeGrid', 'cellAdjust', 'getCellBorders', 'rebalance'],
           pmiproperty = ['shear']
         )
         def __init__(self, system,
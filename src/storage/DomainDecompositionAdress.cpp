@@ -1002,6 +1002,7 @@ void DomainDecompositionAdress::updateGhosts()
 {
     LOG4ESPP_DEBUG(logger, "updateGhosts -> ghost communication no sizes, real->ghost");
     doGhostCommunication(false, true, dataOfUpdateGhosts);
+    onParticlesModified();
 }
 
 void DomainDecompositionAdress::updateGhostsV()
@@ -42,6 +42,8 @@ namespace espressopp
 namespace storage
 {
 const int DD_COMM_TAG = 0xab;
+// the ghost messages to the 26 neighbors use the tags DD_GHOST_TAG + neighbor index
+const int DD_GHOST_TAG = 0x100;
 
 DomainDecompositionNonBlocking::DomainDecompositionNonBlocking(std::shared_ptr<System> _system,
                                                                const Int3D& _nodeGrid,
@@ -50,13 +52,19 @@ DomainDecompositionNonBlocking::DomainDecompositionNonBlocking(std::shared_ptr<S
                           _nodeGrid,
                           _cellGrid,
                           1 /*in DD nonblocking we do not allow halfcell at the moment*/),
+      pendingSizesFirst(false),
+      pendingRealToGhosts(false),
+      pendingExtradata(0),
       inBufferL(*_system->comm),
       inBufferR(*_system->comm),
       outBufferL(*_system->comm),
-      outBufferR(*_system->comm),
-      inBufferG(*_system->comm),
-      outBufferG(*_system->comm)
+      outBufferR(*_system->comm)
 {
+    for (int i = 0; i < 27; ++i)
+    {
+        inBuffers.emplace_back(new InBuffer(*_system->comm));
+        outBuffers.emplace_back(new OutBuffer(*_system->comm));
+    }
 }
 
 void DomainDecompositionNonBlocking::decomposeRealParticles()
@@ -280,177 +288,194 @@ void DomainDecompositionNonBlocking::decomposeRealParticles()
     LOG4ESPP_DEBUG(logger, "done");
 }
 
-void DomainDecompositionNonBlocking::doGhostCommunication(bool sizesFirst,
-                                                          bool realToGhosts,
-                                                          int extradata)
+void DomainDecompositionNonBlocking::prepareNeighborCommunication()
 {
-    LOG4ESPP_DEBUG(logger, "do ghost communication "
-                               << (sizesFirst ? "with sizes " : "")
-                               << (realToGhosts ? "reals to ghosts " : "ghosts to reals ")
-                               << extradata);
+    const Real3D& boxL = getSystem()->bc->getBoxL();
 
-    /* direction loop: x, y, z.
-   Here we could in principle build in a one sided ghost
-   communication, simply by taking the lr loop only over one
-   value. */
-    for (int _coord = 0; _coord < 3; ++_coord)
+    for (int dz = -1; dz <= 1; ++dz)
     {
-        /* inverted processing order for ghost force communication,
-          since the corner ghosts have to be collected via several
-          nodes. We now add back the corner ghost forces first again
-          to ghost forces, which only eventually go back to the real
-          particle.
-        */
-        int coord = realToGhosts ? _coord : (2 - _coord);
-        real curCoordBoxL = getSystem()->bc->getBoxL()[coord];
-
-        // lr loop: left right
-        for (int lr = 0; lr < 2; ++lr)
+        for (int dy = -1; dy <= 1; ++dy)
         {
-            int dir = 2 * coord + lr;
-            int oppositeDir = 2 * coord + (1 - lr);
-
-            Real3D shift(0, 0, 0);
-
-            shift[coord] = nodeGrid.getBoundary(dir) * curCoordBoxL;
-
-            LOG4ESPP_DEBUG(logger, "direction " << dir);
-
-            if (nodeGrid.getGridSize(coord) == 1)
+            for (int dx = -1; dx <= 1; ++dx)
             {
-                LOG4ESPP_DEBUG(logger, "local communication");
-
-                // copy operation, we have to receive as many cells as we send
-                if (commCells[dir].ghosts.size() != commCells[dir].reals.size())
+                int i = neighborIndex(dx, dy, dz);
+                NeighborCells& nc = neighborCells[i];
+                nc.reals.clear();
+                nc.ghosts.clear();
+                if (i == neighborIndex(0, 0, 0)) continue;
+
+                const int d[3] = {dx, dy, dz};
+                int realLeft[3], realRight[3], ghostLeft[3], ghostRight[3];
+                Int3D pos;
+                for (int coord = 0; coord < 3; ++coord)
                 {
-                    throw std::runtime_error(
-                        "DomainDecomposition::doGhostCommunication: send/recv cell structure "
-                        "mismatch during local copy");
-                }
+                    int begin = cellGrid.getInnerCellsBegin(coord);
+                    int end = cellGrid.getInnerCellsEnd(coord);
+                    int n = nodeGrid.getGridSize(coord);
+                    pos[coord] = (nodeGrid.getNodePosition(coord) + d[coord] + n) % n;
+                    nc.shift[coord] = 0.0;
 
-                for (int i = 0, end = commCells[dir].ghosts.size(); i < end; ++i)
-                {
-                    if (realToGhosts)
+                    if (d[coord] == 0)
+                    {
+                        realLeft[coord] = ghostLeft[coord] = begin;
+                        realRight[coord] = ghostRight[coord] = end;
+                    }
+                    else if (d[coord] < 0)
                     {
-                        copyRealsToGhosts(*commCells[dir].reals[i], *commCells[dir].ghosts[i],
-                                          extradata, shift);
+                        // the first real layer is the last ghost layer of the left neighbor
+                        realLeft[coord] = begin;
+                        realRight[coord] = begin + 1;
+                        ghostLeft[coord] = begin - 1;
+                        ghostRight[coord] = begin;
+                        nc.shift[coord] = nodeGrid.getBoundary(2 * coord) * boxL[coord];
                     }
                     else
                     {
-                        addGhostForcesToReals(*commCells[dir].ghosts[i], *commCells[dir].reals[i]);
+                        realLeft[coord] = end - 1;
+                        realRight[coord] = end;
+                        ghostLeft[coord] = end;
+                        ghostRight[coord] = end + 1;
+                        nc.shift[coord] = nodeGrid.getBoundary(2 * coord + 1) * boxL[coord];
                     }
                 }
+                nc.node = nodeGrid.mapPositionToIndex(pos);
+                fillCells(nc.reals, realLeft, realRight);
+                fillCells(nc.ghosts, ghostLeft, ghostRight);
             }
-            else
-            {
-                // exchange size information, if necessary
-                if (sizesFirst)
-                {
-                    LOG4ESPP_DEBUG(logger, "exchanging ghost cell sizes");
+        }
+    }
+}
 
-                    // prepare buffers
-                    std::vector<longint> sendSizes, recvSizes;
-                    sendSizes.reserve(commCells[dir].reals.size());
-                    for (int i = 0, end = commCells[dir].reals.size(); i < end; ++i)
-                    {
-                        sendSizes.push_back(commCells[dir].reals[i]->particles.size());
-                    }
-                    recvSizes.resize(commCells[dir].ghosts.size());
+void DomainDecompositionNonBlocking::doGhostCommunication(bool sizesFirst,
+                                                          bool realToGhosts,
+                                                          int extradata)
+{
+    startGhostCommunication(sizesFirst, realToGhosts, extradata);
+    finishGhostCommunication();
+}
 
-                    mpi::request reqs[2];
+void DomainDecompositionNonBlocking::beginUpdateGhosts()
+{
+    LOG4ESPP_DEBUG(logger, "beginUpdateGhosts -> post ghost update, real->ghost");
+    startGhostCommunication(false, true, dataOfUpdateGhosts);
+}
 
-                    // exchange sizes, odd-even rule
-                    if (nodeGrid.getNodePosition(coord) % 2 == 0)
-                    {
-                        LOG4ESPP_DEBUG(logger, "sending to node "
-                                                   << nodeGrid.getNodeNeighborIndex(dir)
-                                                   << ", then receiving from node "
-                                                   << nodeGrid.getNodeNeighborIndex(oppositeDir));
-                        reqs[0] = getSystem()->comm->isend(nodeGrid.getNodeNeighborIndex(dir),
-                                                           DD_COMM_TAG, &(sendSizes[0]),
-                                                           sendSizes.size());
-                        reqs[1] = getSystem()->comm->irecv(
-                            nodeGrid.getNodeNeighborIndex(oppositeDir), DD_COMM_TAG,
-                            &(recvSizes[0]), recvSizes.size());
-                    }
-                    else
-                    {
-                        LOG4ESPP_DEBUG(logger, "receiving from node "
-                                                   << nodeGrid.getNodeNeighborIndex(oppositeDir)
-                                                   << ", then sending to node "
-                                                   << nodeGrid.getNodeNeighborIndex(dir));
-                        reqs[0] = getSystem()->comm->irecv(
-                            nodeGrid.getNodeNeighborIndex(oppositeDir), DD_COMM_TAG,
-                            &(recvSizes[0]), recvSizes.size());
-                        reqs[1] = getSystem()->comm->isend(nodeGrid.getNodeNeighborIndex(dir),
-                                                           DD_COMM_TAG, &(sendSizes[0]),
-                                                           sendSizes.size());
-                    }
+void DomainDecompositionNonBlocking::endUpdateGhosts()
+{
+    LOG4ESPP_DEBUG(logger, "endUpdateGhosts -> wait for ghost update");
+    finishGhostCommunication();
+    onParticlesModified();
+}
+
+void DomainDecompositionNonBlocking::startGhostCommunication(bool sizesFirst,
+                                                             bool realToGhosts,
+                                                             int extradata)
+{
+    LOG4ESPP_DEBUG(logger, "start ghost communication "
+                               << (sizesFirst ? "with sizes " : "")
+                               << (realToGhosts ? "reals to ghosts " : "ghosts to reals ")
+                               << extradata);
 
-                    mpi::wait_all(reqs, reqs + 2);
+    if (sizesFirst || neighborCells[0].reals.empty()) prepareNeighborCommunication();
 
-                    // resize according to received information
-                    for (int i = 0, end = commCells[dir].ghosts.size(); i < end; ++i)
-                    {
-                        commCells[dir].ghosts[i]->particles.resize(recvSizes[i]);
-                    }
-                    LOG4ESPP_DEBUG(logger, "exchanging ghost cell sizes done");
-                }
+    pendingSizesFirst = sizesFirst;
+    pendingRealToGhosts = realToGhosts;
+    pendingExtradata = extradata;
+    requests.clear();
+
+    const longint self = getSystem()->comm->rank();
+
+    /* every ghost cell is the image of exactly one real cell of one of the 26
+       neighbors, so there is no ordering between the messages, and forces go back
+       to the real particles directly. The node of the opposite displacement
+       26 - i has the matching cells, and the message from displacement i is
+       tagged with the index of the displacement seen from its sender. */
+    for (int i = 0; i < 27; ++i)
+    {
+        NeighborCells& nc = neighborCells[i];
+        if (nc.reals.empty()) continue;
 
-                // prepare send and receive buffers
-                longint receiver, sender;
-                outBufferG.reset();
+        if (nc.node == self)
+        {
+            // the neighbor is our own periodic image
+            NeighborCells& opposite = neighborCells[26 - i];
+            for (size_t k = 0; k < nc.reals.size(); ++k)
+            {
                 if (realToGhosts)
-                {
-                    receiver = nodeGrid.getNodeNeighborIndex(dir);
-                    sender = nodeGrid.getNodeNeighborIndex(oppositeDir);
-                    for (int i = 0, end = commCells[dir].reals.size(); i < end; ++i)
-                    {
-                        packPositionsEtc(outBufferG, *commCells[dir].reals[i], extradata, shift);
-                    }
-                }
+                    copyRealsToGhosts(*nc.reals[k], *opposite.ghosts[k], extradata, nc.shift);
                 else
-                {
-                    receiver = nodeGrid.getNodeNeighborIndex(oppositeDir);
-                    sender = nodeGrid.getNodeNeighborIndex(dir);
-                    for (int i = 0, end = commCells[dir].ghosts.size(); i < end; ++i)
-                    {
-                        packForces(outBufferG, *commCells[dir].ghosts[i]);
-                    }
-                }
+                    addGhostForcesToReals(*nc.ghosts[k], *opposite.reals[k]);
+            }
+            continue;
+        }
 
-                mpi::request reqs[2];
+        OutBuffer& out = *outBuffers[i];
+        out.reset();
+        if (realToGhosts)
+        {
+            if (sizesFirst)
+            {
+                for (Cell* cell : nc.reals) out.write(int(cell->particles.size()));
+            }
+            for (Cell* cell : nc.reals) packPositionsEtc(out, *cell, extradata, nc.shift);
+        }
+        else
+        {
+            for (Cell* cell : nc.ghosts) packForces(out, *cell);
+        }
+        requests.push_back(out.isend(nc.node, DD_GHOST_TAG + i));
+    }
 
-                // exchange particles, odd-even rule
-                if (nodeGrid.getNodePosition(coord) % 2 == 0)
-                {
-                    reqs[0] = outBufferG.isend(receiver, DD_COMM_TAG);
-                    reqs[1] = inBufferG.irecv(sender, DD_COMM_TAG);
-                }
-                else
-                {
-                    reqs[0] = inBufferG.irecv(sender, DD_COMM_TAG);
-                    reqs[1] = outBufferG.isend(receiver, DD_COMM_TAG);
-                }
+    for (int i = 0; i < 27; ++i)
+    {
+        NeighborCells& nc = neighborCells[i];
+        if (nc.reals.empty() || nc.node == self) continue;
 
-                mpi::wait_all(reqs, reqs + 2);
+        int tag = DD_GHOST_TAG + 26 - i;
+        InBuffer& in = *inBuffers[i];
+        if (sizesFirst || (realToGhosts && (extradata & DATA_PROPERTIES)))
+        {
+            // size not known in advance, probe. All sends are posted already.
+            requests.push_back(in.irecv(nc.node, tag));
+        }
+        else
+        {
+            longint n = 0;
+            for (Cell* cell : realToGhosts ? nc.ghosts : nc.reals) n += cell->particles.size();
+            int size = n * (realToGhosts ? ghostUpdateSize(extradata) : ghostForceSize());
+            requests.push_back(in.irecv(nc.node, tag, size));
+        }
+    }
+}
 
-                // unpack received data
-                if (realToGhosts)
-                {
-                    for (int i = 0, end = commCells[dir].reals.size(); i < end; ++i)
-                    {
-                        unpackPositionsEtc(*commCells[dir].ghosts[i], inBufferG, extradata);
-                    }
-                }
-                else
+void DomainDecompositionNonBlocking::finishGhostCommunication()
+{
+    mpi::wait_all(requests.begin(), requests.end());
+    requests.clear();
+
+    const longint self = getSystem()->comm->rank();
+    for (int i = 0; i < 27; ++i)
+    {
+        NeighborCells& nc = neighborCells[i];
+        if (nc.reals.empty() || nc.node == self) continue;
+
+        InBuffer& in = *inBuffers[i];
+        if (pendingRealToGhosts)
+        {
+            if (pendingSizesFirst)
+            {
+                for (Cell* cell : nc.ghosts)
                 {
-                    for (int i = 0, end = commCells[dir].reals.size(); i < end; ++i)
-                    {
-                        unpackAndAddForces(*commCells[dir].reals[i], inBufferG);
-                    }
+                    int size;
+                    in.read(size);
+                    cell->particles.resize(size);
                 }
             }
+            for (Cell* cell : nc.ghosts) unpackPositionsEtc(*cell, in, pendingExtradata);
+        }
+        else
+        {
+            for (Cell* cell : nc.reals) unpackAndAddForces(*cell, in);
         }
     }
     LOG4ESPP_DEBUG(logger, "ghost communication finished");
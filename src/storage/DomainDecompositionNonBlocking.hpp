@@ -23,6 +23,8 @@
 // ESPP_CLASS
 #ifndef _STORAGE_DOMAINDECOMPOSITIONNONBLOCKING_HPP
 #define _STORAGE_DOMAINDECOMPOSITIONNONBLOCKING_HPP
+#include <memory>
+#include <vector>
 #include "DomainDecomposition.hpp"
 // #include "types.hpp"
 
@@ -30,6 +32,13 @@ namespace espressopp
 {
 namespace storage
 {
+/** Domain decomposition with non-blocking communication. The ghosts are
+    exchanged directly with all 26 neighbors of the node grid instead of the
+    three staged sweeps of DomainDecomposition: all messages are posted at once,
+    and the ghost update can be split into beginUpdateGhosts() and
+    endUpdateGhosts(), so that the integrator computes the forces between real
+    particles while the ghosts are in flight.
+*/
 class DomainDecompositionNonBlocking : public DomainDecomposition
 {
 public:
@@ -37,6 +46,11 @@ public:
                                    const Int3D& _nodeGrid,
                                    const Int3D& _cellGrid);
     virtual ~DomainDecompositionNonBlocking() {}
+
+    void beginUpdateGhosts() override;
+    void endUpdateGhosts() override;
+    bool overlapsGhostUpdate() const override { return true; }
+
     static void registerPython();
 
 protected:
@@ -48,13 +62,46 @@ protected:
     mpi::request irecvParticles_initiate(InBuffer& data, longint node);
     void irecvParticles_finish(InBuffer& data, ParticleList& list);
 
+    /// set up the cells exchanged with the 26 neighbors for the current cell grid
+    void prepareNeighborCommunication();
+    /// copy to the local ghosts and post all messages of a ghost communication
+    void startGhostCommunication(bool sizesFirst, bool realToGhosts, int extradata);
+    /// wait for the messages of startGhostCommunication() and unpack them
+    void finishGhostCommunication();
+
 private:
+    /** the cells exchanged with the node at one displacement (dx, dy, dz) in
+        {-1, 0, 1}^3 of the node grid. The reals are ghosts on that node, the
+        ghosts are images of its reals, in the same order on both nodes.
+    */
+    struct NeighborCells
+    {
+        longint node;
+        Real3D shift;  // added to the positions sent to the node
+        std::vector<Cell*> reals;
+        std::vector<Cell*> ghosts;
+    };
+    /// index of a displacement, the opposite displacement has index 26 - i
+    static int neighborIndex(int dx, int dy, int dz)
+    {
+        return (dx + 1) + 3 * (dy + 1) + 9 * (dz + 1);
+    }
+
+    /// indexed by neighborIndex(), the entry of the own node (13) is unused
+    NeighborCells neighborCells[27];
+    std::vector<std::unique_ptr<InBuffer> > inBuffers;
+    std::vector<std::unique_ptr<OutBuffer> > outBuffers;
+    std::vector<mpi::request> requests;
+
+    // the ghost communication in flight
+    bool pendingSizesFirst;
+    bool pendingRealToGhosts;
+    int pendingExtradata;
+
     InBuffer inBufferL;
     InBuffer inBufferR;
     OutBuffer outBufferL;
     OutBuffer outBufferR;
-    InBuffer inBufferG;    // used for ghost communication
-    OutBuffer outBufferG;  // used for ghost communication
 };
 }  // namespace storage
 }  // namespace espressopp
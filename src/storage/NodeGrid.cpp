@@ -20,6 +20,8 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+
 #include "log4espp.hpp"
 
 #include "Real3D.hpp"
@@ -44,15 +46,28 @@ NodeGrid::NodeGrid(const Int3D& grid, const longint nodeId, const Real3D& domain
         throw NodeGridIllegal();
     }
 
+    calcNodeNeighbors(nodeId);
+
+    localBoxSize = domainSize;
     for (int i = 0; i < 3; ++i)
     {
-        localBoxSize[i] = domainSize[i] / static_cast<real>(getGridSize(i));
-        invLocalBoxSize[i] = 1.0 / localBoxSize[i];
+        std::vector<real> even(getGridSize(i) + 1);
+        for (int k = 0; k <= getGridSize(i); ++k)
+        {
+            even[k] = k * (domainSize[i] / static_cast<real>(getGridSize(i)));
+        }
+        setBorders(i, even);
     }
+}
+
+void NodeGrid::setBorders(int axis, const std::vector<real>& _borders)
+{
+    borders[axis] = _borders;
+
+    localBoxSize[axis] = getMyRight(axis) - getMyLeft(axis);
+    invLocalBoxSize[axis] = 1.0 / localBoxSize[axis];
     smallestLocalBoxDiameter =
         std::min(std::min(localBoxSize[0], localBoxSize[1]), localBoxSize[2]);
-
-    calcNodeNeighbors(nodeId);
 }
 
 longint NodeGrid::mapPositionToNodeClipped(const Real3D& pos) const
@@ -61,15 +76,9 @@ longint NodeGrid::mapPositionToNodeClipped(const Real3D& pos) const
 
     for (int i = 0; i < 3; ++i)
     {
-        cpos[i] = static_cast<int>(pos[i] * invLocalBoxSize[i]);
-        if (cpos[i] < 0)
-        {
-            cpos[i] = 0;
-        }
-        else if (cpos[i] >= getGridSize(i))
-        {
-            cpos[i] = getGridSize(i) - 1;
-        }
+        // first inner border right of pos; the outer borders are left out, which clips
+        const std::vector<real>& b = borders[i];
+        cpos[i] = std::upper_bound(b.begin() + 1, b.end() - 1, pos[i]) - b.begin() - 1;
     }
     return mapPositionToIndex(cpos);
 }
@@ -29,6 +29,7 @@
 */
 
 #include <stdexcept>
+#include <vector>
 #include "types.hpp"
 #include "logging.hpp"
 #include "esutil/Grid.hpp"
@@ -46,7 +47,8 @@ public:
 
 /** Node grid point. This represents the node grid of the domain
     decomposition, as well as the location of this processor in the
-    grid.
+    grid. The nodes of one layer along an axis share the same borders
+    along this axis, which divide the box evenly unless set otherwise.
 */
 class NodeGrid : public esutil::Grid
 {
@@ -76,6 +78,12 @@ public:
     /// map coordinate to a node. Positions outside are clipped back
     longint mapPositionToNodeClipped(const Real3D& pos) const;
 
+    /** set the borders of the node layers along an axis: layer k spans
+        [borders[k], borders[k+1]), borders has getGridSize(axis) + 1 entries */
+    void setBorders(int axis, const std::vector<real>& borders);
+    /// left border of node layer k along an axis, k = getGridSize(axis) is the box end
+    real getBorder(int axis, int k) const { return borders[axis][k]; }
+
     /// get this node's coordinates
     longint getNodePosition(int axis) const { return nodePos[axis]; }
     /// size of the local box
@@ -84,11 +92,11 @@ public:
     real getInverseLocalBoxSize(int axis) const { return invLocalBoxSize[axis]; }
 
     /// calculate start of local box
-    real getMyLeft(int axis) const { return nodePos[axis] * localBoxSize[axis]; }
+    real getMyLeft(int axis) const { return borders[axis][nodePos[axis]]; }
     Real3D getMyLeft() const { return Real3D(getMyLeft(0), getMyLeft(1), getMyLeft(2)); }
 
     /// calculate end of local box
-    real getMyRight(int axis) const { return (nodePos[axis] + 1) * localBoxSize[axis]; }
+    real getMyRight(int axis) const { return borders[axis][nodePos[axis] + 1]; }
     Real3D getMyRight() const { return Real3D(getMyRight(0), getMyRight(1), getMyRight(2)); }
 
     Real3D getMyCenter() const
@@ -120,6 +128,7 @@ public:
             {
                 localBoxSize[i] *= s;
                 invLocalBoxSize[i] /= s;
+                for (real& b : borders[i]) b *= s;
             }
             smallestLocalBoxDiameter *= s;
         }
@@ -137,6 +146,7 @@ public:
             {
                 localBoxSize[i] *= s[i];
                 invLocalBoxSize[i] /= s[i];
+                for (real& b : borders[i]) b *= s[i];
             }
             smallestLocalBoxDiameter =
                 std::min(std::min(localBoxSize[0], localBoxSize[1]), localBoxSize[2]);
@@ -158,6 +168,9 @@ private:
     /// where to fold particles that leave local box in direction i
     int boundaries[6];
 
+    /// borders of the node layers along each axis
+    std::vector<real> borders[3];
+
     /// cell size
     Real3D localBoxSize;
     /// inverse domain size
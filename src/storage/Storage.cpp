@@ -39,7 +39,9 @@
 #include "Particle.hpp"
 #include "Buffer.hpp"
 #include "esutil/Error.hpp"
+#include "esutil/Collectives.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <boost/unordered/unordered_map.hpp>
 #include <boost/python/numpy.hpp>
@@ -64,7 +66,8 @@ Storage::Storage(std::shared_ptr<System> system, int halfCellInt)
     : SystemAccess(system),
       halfCellInt(halfCellInt),
       inBuffer(*system->comm),
-      outBuffer(*system->comm)
+      outBuffer(*system->comm),
+      ghostFields(0)
 {
     // logger.setLevel(log4espp::Logger::TRACE);
     LOG4ESPP_INFO(logger, "Created new storage object for a system, has buffers");
@@ -614,12 +617,98 @@ void Storage::packPositionsEtc(OutBuffer& buf, Cell& _reals, int extradata, cons
     LOG4ESPP_DEBUG(logger,
                    "positions are shifted by " << shift[0] << "," << shift[1] << "," << shift[2]);
 
-    for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src)
+    if (extradata & DATA_PROPERTIES)
     {
-        buf.write(*src, extradata, shift);
+        for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src)
+        {
+            buf.write(*src, extradata, shift);
+        }
+    }
+    else
+    {
+        packGhostUpdate(buf, reals, extradata, shift, 0.0);
+    }
+}
+
+void Storage::packGhostUpdate(
+    OutBuffer& buf, ParticleList& reals, int extradata, const Real3D& shift, real offset)
+{
+    // one contiguous block per field and cell instead of the full ParticlePosition
+    // per particle. Every block is filled before the next one is reserved, since
+    // reserving may move the buffer.
+    int n = reals.size();
+
+    Real3D* pos = buf.writeBlock<Real3D>(n);
+    for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src, ++pos)
+    {
+        *pos = src->position() + shift;
+        (*pos)[0] += offset;
+    }
+    if (ghostFields & GHOST_RADIUS)
+    {
+        real* radius = buf.writeBlock<real>(n);
+        for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src)
+            *radius++ = src->radius();
+    }
+    if (extradata & DATA_MOMENTUM)
+    {
+        ParticleMomentum* m = buf.writeBlock<ParticleMomentum>(n);
+        for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src)
+            *m++ = src->particleMomentum();
+    }
+    if (extradata & DATA_LOCAL)
+    {
+        ParticleLocal* l = buf.writeBlock<ParticleLocal>(n);
+        for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src)
+            *l++ = src->particleLocal();
     }
 }
 
+void Storage::unpackGhostUpdate(ParticleList& ghosts, InBuffer& buf, int extradata)
+{
+    int n = ghosts.size();
+
+    const Real3D* pos = buf.readBlock<Real3D>(n);
+    for (ParticleList::iterator dst = ghosts.begin(), end = ghosts.end(); dst != end; ++dst)
+        dst->position() = *pos++;
+    if (ghostFields & GHOST_RADIUS)
+    {
+        const real* radius = buf.readBlock<real>(n);
+        for (ParticleList::iterator dst = ghosts.begin(), end = ghosts.end(); dst != end; ++dst)
+            dst->radius() = *radius++;
+    }
+    if (extradata & DATA_MOMENTUM)
+    {
+        const ParticleMomentum* m = buf.readBlock<ParticleMomentum>(n);
+        for (ParticleList::iterator dst = ghosts.begin(), end = ghosts.end(); dst != end; ++dst)
+            dst->particleMomentum() = *m++;
+    }
+    if (extradata & DATA_LOCAL)
+    {
+        const ParticleLocal* l = buf.readBlock<ParticleLocal>(n);
+        for (ParticleList::iterator dst = ghosts.begin(), end = ghosts.end(); dst != end; ++dst)
+            dst->particleLocal() = *l++;
+    }
+    for (ParticleList::iterator dst = ghosts.begin(), end = ghosts.end(); dst != end; ++dst)
+        dst->ghost() = 1;
+}
+
+int Storage::ghostUpdateSize(int extradata) const
+{
+    int size = sizeof(Real3D);
+    if (ghostFields & GHOST_RADIUS) size += sizeof(real);
+    if (extradata & DATA_MOMENTUM) size += sizeof(ParticleMomentum);
+    if (extradata & DATA_LOCAL) size += sizeof(ParticleLocal);
+    return size;
+}
+
+int Storage::ghostForceSize() const
+{
+    int size = sizeof(Real3D);
+    if (ghostFields & GHOST_FRADIUS) size += sizeof(real);
+    return size;
+}
+
 void Storage::packPositionsEtc_LEBC(
     OutBuffer& buf, Cell& _reals, int extradata, const Real3D& shift, real offset)
 {
@@ -633,6 +722,12 @@ void Storage::packPositionsEtc_LEBC(
     LOG4ESPP_DEBUG(logger,
                    "positions are shifted by " << shift[0] << "," << shift[1] << "," << shift[2]);
 
+    if (!(extradata & DATA_PROPERTIES))
+    {
+        packGhostUpdate(buf, reals, extradata, shift, offset);
+        return;
+    }
+
     for (ParticleList::iterator src = reals.begin(), end = reals.end(); src != end; ++src)
     {
         cpy_tmp = src->position()[0];
@@ -651,15 +746,16 @@ void Storage::unpackPositionsEtc(Cell& _ghosts, InBuffer& buf, int extradata)
                                              << ((extradata & DATA_MOMENTUM) ? "momentum " : "")
                                              << ((extradata & DATA_LOCAL) ? "local " : ""));
 
+    if (!(extradata & DATA_PROPERTIES))
+    {
+        unpackGhostUpdate(ghosts, buf, extradata);
+        return;
+    }
+
     for (ParticleList::iterator dst = ghosts.begin(), end = ghosts.end(); dst != end; ++dst)
     {
         buf.read(*dst, extradata);
-
-        if (extradata & DATA_PROPERTIES)
-        {
-            updateInLocalParticles(&(*dst), true);
-        }
-
+        updateInLocalParticles(&(*dst), true);
         dst->ghost() = 1;
     }
 }
@@ -742,13 +838,21 @@ void Storage::packForces(OutBuffer& buf, Cell& _ghosts)
     LOG4ESPP_DEBUG(logger, "pack ghost forces to buffer from cell " << (&_ghosts - getFirstCell()));
 
     ParticleList& ghosts = _ghosts.particles;
+    int n = ghosts.size();
 
+    Real3D* f = buf.writeBlock<Real3D>(n);
     for (ParticleList::iterator src = ghosts.begin(), end = ghosts.end(); src != end; ++src)
     {
-        buf.write(src->particleForce());
+        *f++ = src->force();
 
         LOG4ESPP_TRACE(logger, "from particle " << src->id() << ": packing force " << src->force());
     }
+    if (ghostFields & GHOST_FRADIUS)
+    {
+        real* fradius = buf.writeBlock<real>(n);
+        for (ParticleList::iterator src = ghosts.begin(), end = ghosts.end(); src != end; ++src)
+            *fradius++ = src->fradius();
+    }
 }
 
 void Storage::unpackForces(Cell& _reals, InBuffer& buf)
@@ -756,13 +860,19 @@ void Storage::unpackForces(Cell& _reals, InBuffer& buf)
     LOG4ESPP_DEBUG(logger, "add forces from buffer to cell " << (&_reals - getFirstCell()));
 
     ParticleList& reals = _reals.particles;
+    int n = reals.size();
 
+    const Real3D* f = buf.readBlock<Real3D>(n);
     for (ParticleList::iterator dst = reals.begin(), end = reals.end(); dst != end; ++dst)
     {
-        ParticleForce f;
-        buf.read(f);
-        LOG4ESPP_TRACE(logger, "for particle " << dst->id() << ": unpacking force " << f.f);
-        dst->particleForce() = f;
+        LOG4ESPP_TRACE(logger, "for particle " << dst->id() << ": unpacking force " << *f);
+        dst->force() = *f++;
+    }
+    if (ghostFields & GHOST_FRADIUS)
+    {
+        const real* fradius = buf.readBlock<real>(n);
+        for (ParticleList::iterator dst = reals.begin(), end = reals.end(); dst != end; ++dst)
+            dst->fradius() = *fradius++;
     }
 }
 
@@ -771,14 +881,20 @@ void Storage::unpackAndAddForces(Cell& _reals, InBuffer& buf)
     LOG4ESPP_DEBUG(logger, "add forces from buffer to cell " << (&_reals - getFirstCell()));
 
     ParticleList& reals = _reals.particles;
+    int n = reals.size();
 
+    const Real3D* f = buf.readBlock<Real3D>(n);
     for (ParticleList::iterator dst = reals.begin(), end = reals.end(); dst != end; ++dst)
     {
-        ParticleForce f;
-        buf.read(f);
-        LOG4ESPP_TRACE(logger, "for particle " << dst->id() << ": unpacking force " << f.f
+        LOG4ESPP_TRACE(logger, "for particle " << dst->id() << ": unpacking force " << *f
                                                << " and adding to " << dst->force());
-        dst->particleForce() += f;
+        dst->force() += *f++;
+    }
+    if (ghostFields & GHOST_FRADIUS)
+    {
+        const real* fradius = buf.readBlock<real>(n);
+        for (ParticleList::iterator dst = reals.begin(), end = reals.end(); dst != end; ++dst)
+            dst->fradius() += *fradius++;
     }
 }
 
@@ -1022,6 +1138,350 @@ void Storage::addParticlesFromArrayImpl(const real* part,
         if (index_state >= 0) sp->state() = int(part[offset + index_state]);
     }
 }
+
+namespace
+{
+// a particle with the properties of entry i of the arrays and the folded position
+Particle makeParticle(const Storage::ParticleArrays& a,
+                      size_t i,
+                      const Real3D& pos,
+                      const Int3D& image)
+{
+    Particle p;
+    p.init();
+    p.id() = a.id[i];
+    p.position() = pos;
+    p.image() = image;
+    if (a.v) p.velocity() = Real3D(a.v[3 * i], a.v[3 * i + 1], a.v[3 * i + 2]);
+    if (a.f) p.force() = Real3D(a.f[3 * i], a.f[3 * i + 1], a.f[3 * i + 2]);
+    if (a.modepos)
+        p.modepos() = Real3D(a.modepos[3 * i], a.modepos[3 * i + 1], a.modepos[3 * i + 2]);
+    if (a.modemom)
+        p.modemom() = Real3D(a.modemom[3 * i], a.modemom[3 * i + 1], a.modemom[3 * i + 2]);
+    if (a.fm) p.forcem() = Real3D(a.fm[3 * i], a.fm[3 * i + 1], a.fm[3 * i + 2]);
+    if (a.type) p.type() = a.type[i];
+    if (a.pib) p.pib() = a.pib[i];
+    if (a.state) p.state() = a.state[i];
+    if (a.mass) p.mass() = a.mass[i];
+    if (a.varmass) p.varmass() = a.varmass[i];
+    if (a.q) p.q() = a.q[i];
+    if (a.radius) p.radius() = a.radius[i];
+    if (a.fradius) p.fradius() = a.fradius[i];
+    if (a.vradius) p.vradius() = a.vradius[i];
+    if (a.lambda) p.lambda() = a.lambda[i];
+    if (a.lambdaDeriv) p.lambdaDeriv() = a.lambdaDeriv[i];
+    return p;
+}
+
+// sort the values by their node, counting sort with the number of values per node
+template <class T>
+void sortByNode(const std::vector<T>& values,
+                const std::vector<int>& node,
+                std::vector<T>& sorted,
+                std::vector<int>& counts)
+{
+    std::fill(counts.begin(), counts.end(), 0);
+    for (int n : node) counts[n]++;
+    std::vector<size_t> offset(counts.size(), 0);
+    for (size_t n = 1; n < counts.size(); n++) offset[n] = offset[n - 1] + counts[n - 1];
+    sorted.resize(values.size());
+    for (size_t i = 0; i < values.size(); i++) sorted[offset[node[i]]++] = values[i];
+}
+}  // namespace
+
+longint Storage::addParticleArrays(const ParticleArrays& a, bool distributed)
+{
+    boost::mpi::communicator& comm = *(getSystem()->comm);
+    int size = comm.size();
+    std::vector<int> counts(size);
+
+    // the new particles of this CPU
+    std::vector<Particle> particles;
+    {
+        std::vector<Particle> mine;
+        std::vector<int> node;
+        for (size_t i = 0; i < a.n; i++)
+        {
+            Real3D pos(a.pos[3 * i], a.pos[3 * i + 1], a.pos[3 * i + 2]);
+            Int3D image(0);
+            if (a.image) image = Int3D(a.image[3 * i], a.image[3 * i + 1], a.image[3 * i + 2]);
+            getSystem()->bc->foldPosition(pos, image);
+
+            if (distributed)
+                node.push_back(mapPositionToNodeClipped(pos));
+            else if (!checkIsRealParticle(a.id[i], pos))
+                continue;
+            mine.push_back(makeParticle(a, i, pos, image));
+        }
+
+        if (distributed)
+        {
+            std::vector<Particle> send;
+            sortByNode(mine, node, send, counts);
+            esutil::Collectives::alltoallv(comm, send, counts, particles);
+        }
+        else
+        {
+            particles.swap(mine);
+        }
+    }
+
+    // duplicates, checked by the CPU id % size for the new and the existing ids
+    {
+        std::vector<longint> ids, newIds, oldIds;
+        std::vector<int> node;
+        for (const Particle& p : particles)
+        {
+            ids.push_back(p.id());
+            node.push_back(p.id() % size);
+        }
+        std::vector<longint> send;
+        sortByNode(ids, node, send, counts);
+        esutil::Collectives::alltoallv(comm, send, counts, newIds);
+
+        longint nOld = getNRealParticles();
+        if (boost::mpi::all_reduce(comm, nOld, std::plus<longint>()) > 0)
+        {
+            ids.clear();
+            node.clear();
+            for (CellListIterator it(realCells); !it.isDone(); ++it)
+            {
+                ids.push_back(it->id());
+                node.push_back(it->id() % size);
+            }
+            sortByNode(ids, node, send, counts);
+            esutil::Collectives::alltoallv(comm, send, counts, oldIds);
+        }
+
+        std::sort(newIds.begin(), newIds.end());
+        std::sort(oldIds.begin(), oldIds.end());
+        longint nDuplicates = 0;
+        for (size_t i = 1; i < newIds.size(); i++) nDuplicates += (newIds[i] == newIds[i - 1]);
+        auto oldIt = oldIds.begin();
+        for (longint id : newIds)
+        {
+            oldIt = std::lower_bound(oldIt, oldIds.end(), id);
+            if (oldIt != oldIds.end() && *oldIt == id) nDuplicates++;
+        }
+
+        if (boost::mpi::all_reduce(comm, nDuplicates, std::plus<longint>()) > 0)
+        {
+            if (comm.rank() == 0)
+                std::cout << "WARNING: Some particles already exist or are given twice. The "
+                             "particles were not added."
+                          << std::endl;
+            return 0;
+        }
+    }
+
+    // count the particles per cell first, so that every cell grows once
+    std::vector<Cell*> cellOf(particles.size());
+    std::vector<size_t> perCell(cells.size(), 0);
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        cellOf[i] = mapPositionToCellClipped(particles[i].position());
+        perCell[cellOf[i] - &cells[0]]++;
+    }
+    for (size_t c = 0; c < cells.size(); c++)
+        if (perCell[c] > 0) cells[c].particles.reserve(cells[c].particles.size() + perCell[c]);
+
+    for (size_t i = 0; i < particles.size(); i++)
+        appendUnindexedParticle(cellOf[i]->particles, particles[i]);
+
+    localParticles.reserve(localParticles.size() + particles.size());
+    for (size_t c = 0; c < cells.size(); c++)
+        if (perCell[c] > 0) updateLocalParticles(cells[c].particles);
+
+    longint nAdded = particles.size();
+    return boost::mpi::all_reduce(comm, nAdded, std::plus<longint>());
+}
+
+namespace
+{
+// the array of a property as T, converted if necessary; it is kept alive in keep
+template <class T>
+const T* getColumn(python::dict& columns,
+                   const char* name,
+                   int width,
+                   size_t& n,
+                   std::vector<python::numpy::ndarray>& keep)
+{
+    using namespace espressopp::python;
+    if (!columns.has_key(name)) return nullptr;
+
+    numpy::ndarray arr = extract<numpy::ndarray>(columns[name]);
+    numpy::dtype dtype = numpy::dtype::get_builtin<T>();
+    if (!(arr.get_dtype() == dtype)) arr = arr.astype(dtype);
+    if (!(arr.get_flags() & numpy::ndarray::C_CONTIGUOUS))
+        throw std::runtime_error(std::string("addParticlesFromArrays: ") + name +
+                                 " must be C contiguous");
+
+    int nd = arr.get_nd();
+    if (nd < 1 || nd > 2 || (nd == 2 ? arr.shape(1) : 1) != width)
+        throw std::runtime_error(std::string("addParticlesFromArrays: ") + name +
+                                 (width == 1 ? " must have one value per particle"
+                                             : " must have the shape (n, 3)"));
+    if (size_t(arr.shape(0)) != n)
+        throw std::runtime_error(std::string("addParticlesFromArrays: ") + name +
+                                 " has another number of particles than id");
+
+    keep.push_back(arr);
+    return reinterpret_cast<const T*>(arr.get_data());
+}
+}  // namespace
+
+longint addParticlesFromArrays(class Storage* obj, python::dict columns, bool distributed)
+{
+    using namespace espressopp::python;
+
+    static const char* names[] = {"id", "pos", "image", "v", "f", "modepos", "modemom",
+                                  "fm", "type", "pib", "state", "mass", "varmass", "q",
+                                  "radius", "fradius", "vradius", "lambda_adr", "lambda_adrd"};
+    python::list keys = columns.keys();
+    for (int k = 0; k < len(keys); k++)
+    {
+        std::string key = extract<std::string>(keys[k]);
+        if (std::find(std::begin(names), std::end(names), key) == std::end(names))
+            throw std::runtime_error("addParticlesFromArrays: unknown particle property " + key);
+    }
+    if (!columns.has_key("id") || !columns.has_key("pos"))
+        throw std::runtime_error("addParticlesFromArrays: the particle properties id and pos are "
+                                 "mandatory");
+
+    std::vector<numpy::ndarray> keep;
+    Storage::ParticleArrays a;
+    a.n = len(columns["id"]);
+    a.id = getColumn<longint>(columns, "id", 1, a.n, keep);
+    a.pos = getColumn<real>(columns, "pos", 3, a.n, keep);
+    a.image = getColumn<longint>(columns, "image", 3, a.n, keep);
+    a.v = getColumn<real>(columns, "v", 3, a.n, keep);
+    a.f = getColumn<real>(columns, "f", 3, a.n, keep);
+    a.modepos = getColumn<real>(columns, "modepos", 3, a.n, keep);
+    a.modemom = getColumn<real>(columns, "modemom", 3, a.n, keep);
+    a.fm = getColumn<real>(columns, "fm", 3, a.n, keep);
+    a.type = getColumn<longint>(columns, "type", 1, a.n, keep);
+    a.pib = getColumn<longint>(columns, "pib", 1, a.n, keep);
+    a.state = getColumn<longint>(columns, "state", 1, a.n, keep);
+    a.mass = getColumn<real>(columns, "mass", 1, a.n, keep);
+    a.varmass = getColumn<real>(columns, "varmass", 1, a.n, keep);
+    a.q = getColumn<real>(columns, "q", 1, a.n, keep);
+    a.radius = getColumn<real>(columns, "radius", 1, a.n, keep);
+    a.fradius = getColumn<real>(columns, "fradius", 1, a.n, keep);
+    a.vradius = getColumn<real>(columns, "vradius", 1, a.n, keep);
+    a.lambda = getColumn<real>(columns, "lambda_adr", 1, a.n, keep);
+    a.lambdaDeriv = getColumn<real>(columns, "lambda_adrd", 1, a.n, keep);
+
+    return obj->addParticleArrays(a, distributed);
+}
+
+namespace
+{
+// columns of the particle properties returned to Python, vectors with three values each
+const char* intColumns[] = {"id", "type", "image"};
+const int intWidths[] = {1, 1, 3};
+const char* realColumns[] = {"mass", "q", "pos", "v", "f"};
+const int realWidths[] = {1, 1, 3, 3, 3};
+
+// write the properties of the real particles into the columns, in cell order
+void packColumns(Storage& storage, longint* ints[3], real* reals[5])
+{
+    size_t i = 0;
+    for (iterator::CellListIterator cit(storage.getRealCells()); !cit.isDone(); ++cit, ++i)
+    {
+        const Particle& p = *cit;
+        ints[0][i] = p.id();
+        ints[1][i] = p.type();
+        reals[0][i] = p.mass();
+        reals[1][i] = p.q();
+        for (int d = 0; d < 3; d++)
+        {
+            ints[2][3 * i + d] = p.image()[d];
+            reals[2][3 * i + d] = p.position()[d];
+            reals[3][3 * i + d] = p.velocity()[d];
+            reals[4][3 * i + d] = p.force()[d];
+        }
+    }
+}
+
+template <class T>
+python::numpy::ndarray emptyColumn(size_t n, int width)
+{
+    using namespace espressopp::python;
+    python::tuple shape = width == 1 ? python::make_tuple(n) : python::make_tuple(n, width);
+    return numpy::empty(shape, numpy::dtype::get_builtin<T>());
+}
+}  // namespace
+
+python::dict getLocalArrays(class Storage* obj)
+{
+    using namespace espressopp::python;
+
+    size_t n = obj->getNRealParticles();
+    python::dict arrays;
+    longint* ints[3];
+    real* reals[5];
+    for (int c = 0; c < 3; c++)
+    {
+        numpy::ndarray arr = emptyColumn<longint>(n, intWidths[c]);
+        ints[c] = reinterpret_cast<longint*>(arr.get_data());
+        arrays[intColumns[c]] = arr;
+    }
+    for (int c = 0; c < 5; c++)
+    {
+        numpy::ndarray arr = emptyColumn<real>(n, realWidths[c]);
+        reals[c] = reinterpret_cast<real*>(arr.get_data());
+        arrays[realColumns[c]] = arr;
+    }
+    packColumns(*obj, ints, reals);
+    return arrays;
+}
+
+python::object gatherArrays(class Storage* obj)
+{
+    using namespace espressopp::python;
+
+    boost::mpi::communicator& comm = *(obj->getSystem()->comm);
+    size_t n = obj->getNRealParticles();
+    std::vector<longint> localInts[3], allInts[3];
+    std::vector<real> localReals[5], allReals[5];
+    longint* ints[3];
+    real* reals[5];
+    for (int c = 0; c < 3; c++)
+    {
+        localInts[c].resize(n * intWidths[c]);
+        ints[c] = localInts[c].data();
+    }
+    for (int c = 0; c < 5; c++)
+    {
+        localReals[c].resize(n * realWidths[c]);
+        reals[c] = localReals[c].data();
+    }
+    packColumns(*obj, ints, reals);
+
+    for (int c = 0; c < 3; c++) esutil::Collectives::gatherv(comm, localInts[c], allInts[c]);
+    for (int c = 0; c < 5; c++) esutil::Collectives::gatherv(comm, localReals[c], allReals[c]);
+    if (comm.rank() != 0) return object();
+
+    // sorted by id, as Configurations
+    const std::vector<longint>& ids = allInts[0];
+    std::vector<size_t> order(ids.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return ids[a] < ids[b]; });
+
+    python::dict arrays;
+    auto addSorted = [&](const char* name, const auto& data, int width)
+    {
+        using T = typename std::decay_t<decltype(data)>::value_type;
+        numpy::ndarray arr = emptyColumn<T>(order.size(), width);
+        T* out = reinterpret_cast<T*>(arr.get_data());
+        for (size_t i = 0; i < order.size(); i++)
+            std::copy_n(&data[order[i] * width], width, &out[i * width]);
+        arrays[name] = arr;
+    };
+    for (int c = 0; c < 3; c++) addSorted(intColumns[c], allInts[c], intWidths[c]);
+    for (int c = 0; c < 5; c++) addSorted(realColumns[c], allReals[c], realWidths[c]);
+    return arrays;
+}
 ///////////////////////////////////////////////////////////////////////////
 
 //////////////////////////////////////////////////
@@ -1047,9 +1507,13 @@ void Storage::registerPython()
         .def("lookupRealParticle", &Storage::lookupRealParticle,
              return_value_policy<reference_existing_object>())
         .def("decompose", &Storage::decompose)
+        .def("particlesModified", &Storage::particlesModified)
         .def("getRealParticleIDs", &Storage::getRealParticleIDs)
         .add_property("system", &Storage::getSystem)
-        .def("addParticlesFromArray", &addParticlesFromArray);
+        .def("addParticlesFromArray", &addParticlesFromArray)
+        .def("addParticlesFromArrays", &addParticlesFromArrays)
+        .def("getLocalArrays", &getLocalArrays)
+        .def("gatherArrays", &gatherArrays);
 }
 }  // namespace storage
 }  // namespace espressopp
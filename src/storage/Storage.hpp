@@ -87,6 +87,47 @@ public:
     */
     Particle* addParticle(longint id, const Real3D& pos, bool checkIfRealParticle = true);
 
+    /** properties of n particles for addParticleArrays(). id and pos are mandatory, the
+        other arrays are NULL if the property is not given. Vector properties have three
+        values per particle.
+    */
+    struct ParticleArrays
+    {
+        size_t n = 0;
+        const longint* id = nullptr;
+        const real* pos = nullptr;
+        const longint* image = nullptr;
+        const real* v = nullptr;
+        const real* f = nullptr;
+        const real* modepos = nullptr;
+        const real* modemom = nullptr;
+        const real* fm = nullptr;
+        const longint* type = nullptr;
+        const longint* pib = nullptr;
+        const longint* state = nullptr;
+        const real* mass = nullptr;
+        const real* varmass = nullptr;
+        const real* q = nullptr;
+        const real* radius = nullptr;
+        const real* fradius = nullptr;
+        const real* vradius = nullptr;
+        const real* lambda = nullptr;
+        const real* lambdaDeriv = nullptr;
+    };
+
+    /** add many particles at once. SPMD.
+
+        Without distributed, all CPUs get the same arrays and keep the particles in their
+        domain. With distributed, every CPU gets other particles and sends them to their
+        CPU by one all-to-all exchange. The new ids are sent to the CPU id % size, which
+        sorts them and compares them with the ids of the existing particles; if an id is
+        given twice or exists already, no particle is added. The cells and the map of the
+        local particles are updated once at the end.
+
+        \return the number of particles added on all CPUs
+    */
+    longint addParticleArrays(const ParticleArrays& arrays, bool distributed);
+
     // remove particle from the system
     int removeParticle(longint id);
 
@@ -193,6 +234,10 @@ public:
         outside the domain of this node, return 0. */
     virtual Cell* mapPositionToCellChecked(const Real3D& pos) = 0;
 
+    /** map a position to the node whose domain contains it, or the closest one if the
+        position is outside the box. */
+    virtual longint mapPositionToNodeClipped(const Real3D& pos) = 0;
+
     /** (Re-)Decompose the system, i.e. redistribute the particles
         to the correct processors.
 
@@ -220,6 +265,15 @@ public:
     */
     virtual void updateGhosts() = 0;
 
+    /** updateGhosts() split in two for overlapping it with computation: the
+        ghosts must not be accessed between the two calls. Storages that cannot
+        overlap the update do all of it in beginUpdateGhosts().
+    */
+    virtual void beginUpdateGhosts() { updateGhosts(); }
+    virtual void endUpdateGhosts() {}
+    /// whether beginUpdateGhosts() returns before the ghosts have arrived
+    virtual bool overlapsGhostUpdate() const { return false; }
+
     /**
      * Copies just velocites of real particles to their ghosts.
      * Needed for DPD thermostat for example.
@@ -235,6 +289,25 @@ public:
     */
     virtual void collectGhostForces() = 0;
 
+    /** bitmask: optional particle fields of the ghost update and force collect
+        packets. The position and the force are always sent.
+    */
+    enum GhostFields
+    {
+        GHOST_RADIUS = 1,
+        GHOST_FRADIUS = 2
+    };
+
+    /** request fields that interactions or extensions read from ghosts (radius)
+        or accumulate on ghosts (fradius). The requests of all users are
+        combined; the layout of the packets is fixed by the mask, no per-packet
+        header is sent. Requests are made while setting up the system, so all CPUs
+        make the same requests at the same time.
+    */
+    void requestGhostFields(int fields) { ghostFields |= fields; }
+    /// the optional fields sent with ghost updates and forces
+    int getGhostFields() const { return ghostFields; }
+
     /** Ths signal will be called whenever the storage was modified
         such that particle pointers have become invalid, e.g. at the
         end of decompose().  Classes that connect to this signal can
@@ -242,6 +315,12 @@ public:
         lookupLocalParticle() and lookupRealParticle().
      */
     boost::signals2::signal<void()> onParticlesChanged;
+    /** This signal is called when particle data changed while the pointers stay
+        valid: after a ghost update, or by particlesModified() after a particle
+        was changed from Python. */
+    boost::signals2::signal<void()> onParticlesModified;
+    /// emits onParticlesModified, to be called on all CPUs
+    void particlesModified() { onParticlesModified(); }
     boost::signals2::signal<void(ParticleList&, class OutBuffer&)> beforeSendParticles;
     boost::signals2::signal<void(ParticleList&, class InBuffer&)> afterRecvParticles;
 
@@ -321,6 +400,17 @@ protected:
     /** unpack received data for ghosts. */
     virtual void unpackPositionsEtc(Cell& ghosts, class InBuffer& buf, int extradata);
 
+    /** slim ghost update without DATA_PROPERTIES: the positions and the requested
+        ghost fields as one block per field, followed by momentum and local data if
+        in extradata. offset is added to the x coordinate (Lees-Edwards).
+    */
+    void packGhostUpdate(
+        OutBuffer& buf, ParticleList& reals, int extradata, const Real3D& shift, real offset);
+    void unpackGhostUpdate(ParticleList& ghosts, InBuffer& buf, int extradata);
+    /// bytes per particle of a ghost update without DATA_PROPERTIES and of the forces
+    int ghostUpdateSize(int extradata) const;
+    int ghostForceSize() const;
+
     /** copy specified data elements between a real cell and one of its ghosts
 
         @param shift how to adjust the positions of the particles when sending
@@ -415,6 +505,9 @@ protected:
     InBuffer inBuffer;
     OutBuffer outBuffer;
 
+    /// optional fields of the ghost update and force packets, see GhostFields
+    int ghostFields;
+
     // used for AdResS
     std::shared_ptr<FixedTupleListAdress> fixedtupleList;
     void clearAdrATParticlesG()
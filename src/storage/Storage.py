@@ -75,6 +75,47 @@ All derived classes implement at least the following methods:
 
    >>> addParticles([[id, pos, type, ... ], ...], 'id', 'pos', 'type', ...)
 
+* `addParticlesFromArrays(arrays, distributed=False)`:
+
+   This routine adds many particles at once from NumPy arrays, without a loop
+   over the particles in Python.
+
+   :param arrays: dictionary of the property names (the same as for addParticles,
+                  plus 'image') and the arrays with one value per particle, or one
+                  row of three values for the vector properties; 'id' and 'pos' are
+                  mandatory
+   :param distributed: False if all CPUs get the same arrays, which is the case
+                       when called from the script; True if every CPU passes other
+                       particles, which are then sent to their CPUs
+   :rtype: the number of added particles
+
+   Nothing is added if an id is given twice or exists already.
+
+   Example:
+
+   >>> n = system.storage.addParticlesFromArrays({'id': ids, 'pos': xyz, 'type': types})
+   >>> system.storage.decompose()
+
+* `getLocalArrays()`:
+
+   The id, type, mass, q, image, pos, v and f of the real particles of each CPU
+   as NumPy arrays, filled in one pass over the cells without Python calls per
+   particle. From the script it returns a list with the arrays of every CPU;
+   code that runs on the CPUs, e.g. analysis with mpi4py, gets the local ones.
+   With vectorization, `espressopp.vec.Vectorization.getParticleArrays()` gives
+   the SoA arrays, as views without copying if asked for.
+
+* `gatherArrays()`:
+
+   The same arrays of all particles, gathered on the first CPU with one
+   MPI_Gatherv per property and sorted by id. This routine is collective; the
+   other CPUs get None.
+
+   Example:
+
+   >>> arrays = system.storage.gatherArrays()
+   >>> com = (arrays['mass'][:, None] * arrays['pos']).sum(axis=0) / arrays['mass'].sum()
+
 * `modifyParticle(pid, property, value, decompose='yes')`
 
    This routine allows to modify any properties of an already existing particle.
@@ -123,10 +164,26 @@ Examples:
                 :type \*properties:
                 :rtype:
 
+.. function:: espressopp.storage.Storage.addParticlesFromArrays(arrays, distributed=False)
+
+                :param arrays:
+                :param distributed:
+                :type arrays: dict
+                :type distributed: bool
+                :rtype: int
+
 .. function:: espressopp.storage.Storage.clearSavedPositions()
 
                 :rtype:
 
+.. function:: espressopp.storage.Storage.gatherArrays()
+
+                :rtype: dict
+
+.. function:: espressopp.storage.Storage.getLocalArrays()
+
+                :rtype: dict
+
 .. function:: espressopp.storage.Storage.getParticle(pid)
 
                 :param pid:
@@ -398,6 +455,8 @@ class StorageLocal(object):
                 elif property.lower() == "lambda_adrd" : particle.lambda_adrd = value
                 elif property.lower() == "state" : particle.state = value
                 else: raise SyntaxError( 'unknown particle property: %s' % property) # UnknownParticleProperty exception is not implemented
+            # on all CPUs, also those without the particle
+            self.cxxclass.particlesModified(self)
                 #except ParticleDoesNotExistHere:
              # self.logger.debug("ParticleDoesNotExistHere pid=% rank=%i" % (pid, pmi.rank))
              # pass
@@ -534,12 +593,26 @@ class StorageLocal(object):
                 ], dtype=np.int32)
             self.cxxclass.addParticlesFromArray(self, particleList, indices)
 
+    def addParticlesFromArrays(self, arrays, distributed=False):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            columns = dict((name.lower(), np.ascontiguousarray(a)) for name, a in arrays.items())
+            return self.cxxclass.addParticlesFromArrays(self, columns, distributed)
+
+    def getLocalArrays(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getLocalArrays(self)
+
+    def gatherArrays(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.gatherArrays(self)
+
 if pmi.isController:
     class Storage(metaclass=pmi.Proxy):
         pmiproxydefs = dict(
-            pmicall = [ "decompose", "addParticles", "setFixedTuplesAdress", "removeAllParticles", "addParticlesArray"],
+            pmicall = [ "decompose", "addParticles", "setFixedTuplesAdress", "removeAllParticles", "addParticlesArray",
+                        "addParticlesFromArrays", "gatherArrays"],
             pmiproperty = [ "system" ],
-            pmiinvoke = ["getRealParticleIDs", "printRealParticles"]
+            pmiinvoke = ["getRealParticleIDs", "printRealParticles", "getLocalArrays"]
             )
 
         def particleExists(self, pid):
@@ -29,7 +29,7 @@ def to_dict(alltimers):
 
     t = []
     nprocs = len(alltimers)
-    for ntimer in range(10):
+    for ntimer in range(len(alltimers[0])):
         t.append(0.0)
         for k in range(nprocs):
             t[ntimer] += alltimers[k][ntimer]
@@ -47,6 +47,9 @@ def to_dict(alltimers):
         'Resort': t[8],
         'Other': t[9]
     }
+    # number of Verlet list rebuilds, if the integrator counts them
+    if len(t) > 10:
+        stats['Rebuilds'] = t[10]
     return stats
 
 
@@ -59,7 +62,7 @@ def show(alltimers, precision=1):
     fmt2 = '%.' + str(precision) + 'f (%.' + str(precision) + 'f)\n'
     t = []
     nprocs = len(alltimers)
-    for ntimer in range(10):
+    for ntimer in range(len(alltimers[0])):
         t.append(0.0)
         for k in range(nprocs):
             t[ntimer] += alltimers[k][ntimer]
@@ -75,4 +78,6 @@ def show(alltimers, precision=1):
     sys.stdout.write('Int2   time (%) = ' + fmt2 % (t[7], 100 * t[7] / t[0]))
     sys.stdout.write('Resort time (%) = ' + fmt2 % (t[8], 100 * t[8] / t[0]))
     sys.stdout.write('Other  time (%) = ' + fmt2 % (t[9], 100 * t[9] / t[0]))
+    if len(t) > 10:
+        sys.stdout.write('Rebuilds         = %d\n' % t[10])
     sys.stdout.write('\n')
@@ -0,0 +1,108 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+**********************************
+espressopp.vec.FixedQuadrupleList
+**********************************
+
+Fixed quadruples of particles in the vectorized storage, e.g. for dihedral potentials.
+The first particle of a quadruple is the reference particle: the quadruple is stored on
+the CPU that owns it.
+
+.. function:: espressopp.vec.FixedQuadrupleList(storage)
+
+                :param storage: the storage of the system
+                :type storage: espressopp.storage.Storage
+
+.. function:: espressopp.vec.FixedQuadrupleList.add(pid1, pid2, pid3, pid4)
+
+                :param pid1: id of the reference particle
+                :param pid2:
+                :param pid3:
+                :param pid4:
+                :type pid1: int
+                :type pid2: int
+                :type pid3: int
+                :type pid4: int
+                :rtype: bool
+
+.. function:: espressopp.vec.FixedQuadrupleList.addQuadruples(quadruplelist)
+
+                :param quadruplelist: list of quadruples (pid1, pid2, pid3, pid4)
+                :type quadruplelist: list
+
+.. function:: espressopp.vec.FixedQuadrupleList.getQuadruples()
+
+                :rtype: list of quadruples
+
+.. function:: espressopp.vec.FixedQuadrupleList.size()
+
+                :rtype: int
+
+.. function:: espressopp.vec.FixedQuadrupleList.remove()
+
+    remove the FixedQuadrupleList and disconnect
+"""
+
+from espressopp import pmi
+import _espressopp
+import espressopp
+from espressopp.esutil import cxxinit
+
+class FixedQuadrupleListLocal(_espressopp.vec_FixedQuadrupleList):
+
+    def __init__(self, storage):
+        if pmi.workerIsActive():
+            cxxinit(self, _espressopp.vec_FixedQuadrupleList, storage)
+
+    def add(self, pid1, pid2, pid3, pid4):
+        if pmi.workerIsActive():
+            return self.cxxclass.add(self, pid1, pid2, pid3, pid4)
+
+    def addQuadruples(self, quadruplelist):
+        """
+        Each processor takes the broadcasted quadruplelist and
+        adds those quadruples whose first particle is owned by
+        this processor.
+        """
+        if pmi.workerIsActive():
+            for quadruple in quadruplelist:
+                pid1, pid2, pid3, pid4 = quadruple
+                self.cxxclass.add(self, pid1, pid2, pid3, pid4)
+
+    def size(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.size(self)
+
+    def remove(self):
+        if pmi.workerIsActive():
+            self.cxxclass.remove(self)
+
+    def getQuadruples(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.getQuadruples(self)
+
+if pmi.isController:
+    class FixedQuadrupleList(metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls = 'espressopp.vec.FixedQuadrupleListLocal',
+            localcall = [ "add" ],
+            pmicall = [ "addQuadruples", "remove" ],
+            pmiinvoke = [ "getQuadruples", "size" ]
+        )
@@ -18,12 +18,15 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include "python.hpp"
 #include "Vectorization.hpp"
 #include "vec/integrator/MDIntegratorVec.hpp"
 #include "vec/storage/StorageVec.hpp"
 
 #include "storage/Storage.hpp"
 
+#include <boost/python/numpy.hpp>
+
 namespace espressopp
 {
 namespace vec
@@ -123,6 +126,54 @@ void Vectorization::updateForces()
     particles.addToForceOnly(getSystem()->storage->getLocalCells());
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+template <class T>
+python::numpy::ndarray view(AlignedVector<T>& data, size_t n, python::object& owner, bool copy)
+{
+    using namespace espressopp::python;
+    numpy::ndarray array = numpy::from_data(data.data(), numpy::dtype::get_builtin<T>(),
+                                            make_tuple(n), make_tuple(sizeof(T)), owner);
+    return copy ? array.copy() : array;
+}
+}  // namespace
+
+/// NumPy arrays of the SoA arrays of the local cells. They include ghost cells and the
+/// padding after every cell, "real" marks the real particles. Without copy, the arrays are
+/// views on the memory of the ParticleArray and are only valid until the particles are
+/// resorted; NumPy cannot tell that a view has become stale.
+python::dict getParticleArrays(python::object self, bool copy)
+{
+    using namespace espressopp::python;
+    ParticleArray& pa = extract<Vectorization&>(self)().particles;
+
+    const std::vector<size_t>& range = pa.cellRange();
+    size_t n = range.empty() ? 0 : range.back();
+
+    numpy::ndarray realMask = numpy::zeros(make_tuple(n), numpy::dtype::get_builtin<bool>());
+    bool* isReal = reinterpret_cast<bool*>(realMask.get_data());
+    for (size_t ic : pa.realCells())
+        std::fill_n(isReal + range[ic], pa.sizes()[ic], true);
+
+    python::dict arrays;
+    arrays["real"] = realMask;
+    arrays["id"] = view(pa.id, n, self, copy);
+    arrays["type"] = view(pa.type, n, self, copy);
+    arrays["mass"] = view(pa.mass, n, self, copy);
+    arrays["q"] = view(pa.q, n, self, copy);
+    arrays["p_x"] = view(pa.p_x, n, self, copy);
+    arrays["p_y"] = view(pa.p_y, n, self, copy);
+    arrays["p_z"] = view(pa.p_z, n, self, copy);
+    arrays["v_x"] = view(pa.v_x, n, self, copy);
+    arrays["v_y"] = view(pa.v_y, n, self, copy);
+    arrays["v_z"] = view(pa.v_z, n, self, copy);
+    arrays["f_x"] = view(pa.f_x, n, self, copy);
+    arrays["f_y"] = view(pa.f_y, n, self, copy);
+    arrays["f_z"] = view(pa.f_z, n, self, copy);
+    return arrays;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /// Registration with python
 void Vectorization::registerPython()
@@ -133,6 +184,7 @@ void Vectorization::registerPython()
         "vec_Vectorization", init<std::shared_ptr<System>, std::shared_ptr<MDIntegrator>>())
         .def(init<std::shared_ptr<System>>())
         .add_property("level", &Vectorization::getVecLevel)
+        .def("getParticleArrays", &getParticleArrays)
         .def_readwrite("storageVec", &Vectorization::storageVec);
 }
 }  // namespace vec
@@ -31,6 +31,23 @@ espressopp.vec.Vectorization
     :param system: system object
     :param integrator: integrator object
 
+.. function:: espressopp.vec.Vectorization.getParticleArrays(copy=True)
+
+    NumPy arrays of the structure of arrays of each CPU: id, type, mass, q, p_x,
+    p_y, p_z, v_x, v_y, v_z, f_x, f_y and f_z. They cover the ghost cells and the
+    padding after each cell; the boolean array 'real' marks the real particles.
+    With level 1 the arrays hold the state of the last force calculation; with
+    level 2 they are up to date after a run.
+
+    With copy=False the arrays are views on the memory of the particle arrays
+    instead of copies. Such views are only valid until the particles are resorted,
+    i.e. they have to be taken again after each run; reading or writing a stale
+    view is undefined and is not detected.
+
+    :param copy: return copies (default) or views
+    :type copy: bool
+    :rtype: dict (list of dicts of all CPUs when called from the script)
+
 """
 
 class VectorizationLocal(_espressopp.vec_Vectorization):
@@ -54,9 +71,14 @@ class VectorizationLocal(_espressopp.vec_Vectorization):
             else:
                 raise RuntimeError("Invalid vectorization level: {}".format(self.level))
 
+    def getParticleArrays(self, copy=True):
+        if pmi.workerIsActive():
+            return self.cxxclass.getParticleArrays(self, copy)
+
 if pmi.isController:
     class Vectorization(object, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
             cls = 'espressopp.vec.VectorizationLocal',
-            pmiproperty = ['storageVec']
+            pmiproperty = ['storageVec'],
+            pmiinvoke = ['getParticleArrays']
         )
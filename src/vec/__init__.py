@@ -20,6 +20,7 @@ from espressopp.esutil import pmiimport
 pmiimport('espressopp.vec')
 
 from espressopp.vec.FixedPairList import *
+from espressopp.vec.FixedQuadrupleList import *
 from espressopp.vec.FixedTripleList import *
 from espressopp.vec.Vectorization import *
 from espressopp.vec.VerletList import *
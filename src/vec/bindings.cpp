@@ -22,6 +22,7 @@
 #include "bindings.hpp"
 
 #include "vec/FixedPairList.hpp"
+#include "vec/FixedQuadrupleList.hpp"
 #include "vec/FixedTripleList.hpp"
 #include "vec/Vectorization.hpp"
 #include "vec/VerletList.hpp"
@@ -37,6 +38,7 @@ namespace vec
 void registerPython()
 {
     vec::FixedPairList::registerPython();
+    vec::FixedQuadrupleList::registerPython();
     vec::FixedTripleList::registerPython();
     vec::Vectorization::registerPython();
     vec::VerletList::registerPython();
@@ -0,0 +1,76 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "vec/Vectorization.hpp"
+
+#include "python.hpp"
+#include "Angular.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+using espressopp::interaction::Interaction;
+using espressopp::interaction::AngularCosineSquared;
+using espressopp::interaction::AngularHarmonic;
+using espressopp::interaction::TabulatedAngular;
+
+namespace
+{
+template <class FixedTripleListInteraction, class Potential>
+void registerFixedTripleList(const char* name)
+{
+    using namespace espressopp::python;
+
+    class_<FixedTripleListInteraction, bases<Interaction> >(
+        name, init<std::shared_ptr<System>, std::shared_ptr<FixedTripleList>,
+                   std::shared_ptr<Potential> >())
+        .def("setPotential", &FixedTripleListInteraction::setPotential)
+        .def("getPotential", &FixedTripleListInteraction::getPotential)
+        .def("setFixedTripleList", &FixedTripleListInteraction::setFixedTripleList)
+        .def("getFixedTripleList", &FixedTripleListInteraction::getFixedTripleList);
+}
+}  // namespace
+
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void FixedTripleListAngularHarmonic::registerPython()
+{
+    registerFixedTripleList<FixedTripleListAngularHarmonic, AngularHarmonic>(
+        "vec_interaction_FixedTripleListAngularHarmonic");
+}
+
+void FixedTripleListAngularCosineSquared::registerPython()
+{
+    registerFixedTripleList<FixedTripleListAngularCosineSquared, AngularCosineSquared>(
+        "vec_interaction_FixedTripleListAngularCosineSquared");
+}
+
+void FixedTripleListTabulatedAngular::registerPython()
+{
+    registerFixedTripleList<FixedTripleListTabulatedAngular, TabulatedAngular>(
+        "vec_interaction_FixedTripleListTabulatedAngular");
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
@@ -0,0 +1,68 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_ANGULAR_HPP
+#define VEC_INTERACTION_ANGULAR_HPP
+
+#include "interaction/AngularHarmonic.hpp"
+#include "interaction/AngularCosineSquared.hpp"
+#include "interaction/TabulatedAngular.hpp"
+#include "FixedTripleListInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Angular potentials of espressopp::interaction on the fixed triples of the vectorized
+    storage */
+class FixedTripleListAngularHarmonic
+    : public FixedTripleListInteractionTemplate<espressopp::interaction::AngularHarmonic>
+{
+public:
+    using FixedTripleListInteractionTemplate::FixedTripleListInteractionTemplate;
+
+    static void registerPython();
+};
+
+class FixedTripleListAngularCosineSquared
+    : public FixedTripleListInteractionTemplate<espressopp::interaction::AngularCosineSquared>
+{
+public:
+    using FixedTripleListInteractionTemplate::FixedTripleListInteractionTemplate;
+
+    static void registerPython();
+};
+
+class FixedTripleListTabulatedAngular
+    : public FixedTripleListInteractionTemplate<espressopp::interaction::TabulatedAngular>
+{
+public:
+    using FixedTripleListInteractionTemplate::FixedTripleListInteractionTemplate;
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_ANGULAR_HPP
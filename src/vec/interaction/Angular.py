@@ -0,0 +1,132 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+**********************************
+espressopp.vec.interaction.Angular
+**********************************
+
+Angular potentials on the fixed triples of the vectorized storage. The potentials are those of
+:class:`espressopp.interaction.AngularHarmonic`,
+:class:`espressopp.interaction.AngularCosineSquared` and
+:class:`espressopp.interaction.TabulatedAngular`.
+
+.. py:class:: espressopp.vec.interaction.FixedTripleListAngularHarmonic(system, ftl, potential)
+.. py:class:: espressopp.vec.interaction.FixedTripleListAngularCosineSquared(system, ftl, potential)
+.. py:class:: espressopp.vec.interaction.FixedTripleListTabulatedAngular(system, ftl, potential)
+
+    :param system: the system
+    :param ftl: the triples
+    :type ftl: espressopp.vec.FixedTripleList
+    :param potential: the angular potential
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+
+from _espressopp import \
+    vec_interaction_FixedTripleListAngularHarmonic, \
+    vec_interaction_FixedTripleListAngularCosineSquared, \
+    vec_interaction_FixedTripleListTabulatedAngular
+
+class FixedTripleListAngularHarmonicLocal(InteractionLocal, vec_interaction_FixedTripleListAngularHarmonic):
+
+    def __init__(self, system, fixedtriplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedTripleListAngularHarmonic, system, fixedtriplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedTripleList(self, fixedtriplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedTripleList(self, fixedtriplelist)
+
+    def getFixedTripleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedTripleList(self)
+
+class FixedTripleListAngularCosineSquaredLocal(InteractionLocal, vec_interaction_FixedTripleListAngularCosineSquared):
+
+    def __init__(self, system, fixedtriplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedTripleListAngularCosineSquared, system, fixedtriplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedTripleList(self, fixedtriplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedTripleList(self, fixedtriplelist)
+
+    def getFixedTripleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedTripleList(self)
+
+class FixedTripleListTabulatedAngularLocal(InteractionLocal, vec_interaction_FixedTripleListTabulatedAngular):
+
+    def __init__(self, system, fixedtriplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedTripleListTabulatedAngular, system, fixedtriplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedTripleList(self, fixedtriplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedTripleList(self, fixedtriplelist)
+
+    def getFixedTripleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedTripleList(self)
+
+if pmi.isController:
+    class FixedTripleListAngularHarmonic(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedTripleListAngularHarmonicLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedTripleList', 'getFixedTripleList']
+            )
+
+    class FixedTripleListAngularCosineSquared(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedTripleListAngularCosineSquaredLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedTripleList', 'getFixedTripleList']
+            )
+
+    class FixedTripleListTabulatedAngular(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedTripleListTabulatedAngularLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedTripleList', 'getFixedTripleList']
+            )
@@ -0,0 +1,45 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "CoulombRSpace.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void VerletListCoulombRSpace::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<VerletListCoulombRSpace, bases<Interaction> >(
+        "vec_interaction_VerletListCoulombRSpace", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListCoulombRSpace::getVerletList)
+        .def("setPotential", &VerletListCoulombRSpace::setPotential)
+        .def("getPotential", &VerletListCoulombRSpace::getPotentialPtr);
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
@@ -0,0 +1,102 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_COULOMBRSPACE_HPP
+#define VEC_INTERACTION_COULOMBRSPACE_HPP
+
+#include <cmath>
+
+#include "interaction/CoulombRSpace.hpp"
+#include "VerletListKernelInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** erfc(x) for x >= 0, given exp(-x^2), with the rational approximation 7.1.26 of
+    Abramowitz and Stegun. The absolute error is below 1.5e-7. Unlike std::erfc it is a plain
+    polynomial that the compiler can vectorize, and it reuses the exponential that the force
+    needs anyway.
+*/
+inline real erfcExp(real x, real expmx2)
+{
+    const real t = 1.0 / (1.0 + 0.3275911 * x);
+    return t * (0.254829592 +
+                t * (-0.284496736 + t * (1.421413741 + t * (-1.453152027 + t * 1.061405429)))) *
+           expmx2;
+}
+
+/** SoA kernel of the real space part of the Ewald sum,
+    \f$ V(r) = C q_1 q_2 \mathrm{erfc}(\alpha r) / r \f$.
+*/
+struct CoulombRSpaceKernel
+{
+    typedef espressopp::interaction::CoulombRSpace Potential;
+    static constexpr bool charged = true;
+
+    struct Coefficients
+    {
+        real prefactor;
+        real alpha, alpha2;
+        real factor;  // 2 alpha / sqrt(pi)
+    };
+
+    Coefficients coefficients(const Potential& p) const
+    {
+        const real alpha = p.getAlpha();
+        return {p.getPrefactor(), alpha, alpha * alpha, alpha * M_2_SQRTPI};
+    }
+
+    static real cutoffSqr(const Potential& p) { return p.getCutoff() * p.getCutoff(); }
+
+    real forceFactor(const Coefficients& c, real distSqr, real qq) const
+    {
+        const real r = std::sqrt(distSqr);
+        const real expmx2 = std::exp(-c.alpha2 * distSqr);
+        return c.prefactor * qq * (c.factor * expmx2 + erfcExp(c.alpha * r, expmx2) / r) / distSqr;
+    }
+
+    real energy(const Coefficients& c, real distSqr, real qq) const
+    {
+        const real r = std::sqrt(distSqr);
+        return c.prefactor * qq * erfcExp(c.alpha * r, std::exp(-c.alpha2 * distSqr)) / r;
+    }
+};
+
+class VerletListCoulombRSpace
+    : public VerletListKernelInteractionTemplate<espressopp::interaction::CoulombRSpace,
+                                                 CoulombRSpaceKernel>
+{
+public:
+    VerletListCoulombRSpace(std::shared_ptr<VerletList> _verletList)
+        : VerletListKernelInteractionTemplate(_verletList)
+    {
+    }
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_COULOMBRSPACE_HPP
@@ -0,0 +1,78 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+****************************************
+espressopp.vec.interaction.CoulombRSpace
+****************************************
+
+Real space part of the Ewald sum on the Verlet list of the vectorized storage, with the
+potentials of :class:`espressopp.interaction.CoulombRSpace`. The complementary error function is
+evaluated with the rational approximation 7.1.26 of Abramowitz and Stegun, whose absolute error
+is below 1.5e-7, so that the kernel vectorizes. Unlike the Verlet list interaction of the
+standard storage, pairs beyond the cutoff of the potential do not contribute.
+
+.. py:class:: espressopp.vec.interaction.VerletListCoulombRSpace(vl)
+
+    :param vl: Verlet list
+    :type vl: espressopp.vec.VerletList
+
+    .. py:method:: setPotential(type1, type2, potential)
+
+        :param int type1:
+        :param int type2:
+        :param potential: the potential between the particle types
+        :type potential: espressopp.interaction.CoulombRSpace
+
+    .. py:method:: getPotential(type1, type2)
+
+        :rtype: espressopp.interaction.CoulombRSpace
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+
+from _espressopp import \
+    vec_interaction_VerletListCoulombRSpace
+
+class VerletListCoulombRSpaceLocal(InteractionLocal, vec_interaction_VerletListCoulombRSpace):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_VerletListCoulombRSpace, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+if pmi.isController:
+    class VerletListCoulombRSpace(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.VerletListCoulombRSpaceLocal',
+            pmicall = ['setPotential', 'getPotential', 'getVerletList']
+            )
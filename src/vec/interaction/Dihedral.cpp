@@ -0,0 +1,90 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "vec/Vectorization.hpp"
+
+#include "python.hpp"
+#include "Dihedral.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+using espressopp::interaction::Interaction;
+using espressopp::interaction::DihedralHarmonic;
+using espressopp::interaction::DihedralHarmonicCos;
+using espressopp::interaction::DihedralHarmonicNCos;
+using espressopp::interaction::DihedralRB;
+using espressopp::interaction::TabulatedDihedral;
+
+namespace
+{
+template <class FixedQuadrupleListInteraction, class Potential>
+void registerFixedQuadrupleList(const char* name)
+{
+    using namespace espressopp::python;
+
+    class_<FixedQuadrupleListInteraction, bases<Interaction> >(
+        name, init<std::shared_ptr<System>, std::shared_ptr<FixedQuadrupleList>,
+                   std::shared_ptr<Potential> >())
+        .def("setPotential", &FixedQuadrupleListInteraction::setPotential)
+        .def("getPotential", &FixedQuadrupleListInteraction::getPotential)
+        .def("setFixedQuadrupleList", &FixedQuadrupleListInteraction::setFixedQuadrupleList)
+        .def("getFixedQuadrupleList", &FixedQuadrupleListInteraction::getFixedQuadrupleList);
+}
+}  // namespace
+
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void FixedQuadrupleListDihedralHarmonic::registerPython()
+{
+    registerFixedQuadrupleList<FixedQuadrupleListDihedralHarmonic, DihedralHarmonic>(
+        "vec_interaction_FixedQuadrupleListDihedralHarmonic");
+}
+
+void FixedQuadrupleListDihedralHarmonicCos::registerPython()
+{
+    registerFixedQuadrupleList<FixedQuadrupleListDihedralHarmonicCos, DihedralHarmonicCos>(
+        "vec_interaction_FixedQuadrupleListDihedralHarmonicCos");
+}
+
+void FixedQuadrupleListDihedralHarmonicNCos::registerPython()
+{
+    registerFixedQuadrupleList<FixedQuadrupleListDihedralHarmonicNCos, DihedralHarmonicNCos>(
+        "vec_interaction_FixedQuadrupleListDihedralHarmonicNCos");
+}
+
+void FixedQuadrupleListDihedralRB::registerPython()
+{
+    registerFixedQuadrupleList<FixedQuadrupleListDihedralRB, DihedralRB>(
+        "vec_interaction_FixedQuadrupleListDihedralRB");
+}
+
+void FixedQuadrupleListTabulatedDihedral::registerPython()
+{
+    registerFixedQuadrupleList<FixedQuadrupleListTabulatedDihedral, TabulatedDihedral>(
+        "vec_interaction_FixedQuadrupleListTabulatedDihedral");
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
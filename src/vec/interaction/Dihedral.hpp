@@ -0,0 +1,88 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_DIHEDRAL_HPP
+#define VEC_INTERACTION_DIHEDRAL_HPP
+
+#include "interaction/DihedralHarmonic.hpp"
+#include "interaction/DihedralHarmonicCos.hpp"
+#include "interaction/DihedralHarmonicNCos.hpp"
+#include "interaction/DihedralRB.hpp"
+#include "interaction/TabulatedDihedral.hpp"
+#include "FixedQuadrupleListInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Dihedral potentials of espressopp::interaction on the fixed quadruples of the vectorized
+    storage */
+class FixedQuadrupleListDihedralHarmonic
+    : public FixedQuadrupleListInteractionTemplate<espressopp::interaction::DihedralHarmonic>
+{
+public:
+    using FixedQuadrupleListInteractionTemplate::FixedQuadrupleListInteractionTemplate;
+
+    static void registerPython();
+};
+
+class FixedQuadrupleListDihedralHarmonicCos
+    : public FixedQuadrupleListInteractionTemplate<espressopp::interaction::DihedralHarmonicCos>
+{
+public:
+    using FixedQuadrupleListInteractionTemplate::FixedQuadrupleListInteractionTemplate;
+
+    static void registerPython();
+};
+
+class FixedQuadrupleListDihedralHarmonicNCos
+    : public FixedQuadrupleListInteractionTemplate<espressopp::interaction::DihedralHarmonicNCos>
+{
+public:
+    using FixedQuadrupleListInteractionTemplate::FixedQuadrupleListInteractionTemplate;
+
+    static void registerPython();
+};
+
+class FixedQuadrupleListDihedralRB
+    : public FixedQuadrupleListInteractionTemplate<espressopp::interaction::DihedralRB>
+{
+public:
+    using FixedQuadrupleListInteractionTemplate::FixedQuadrupleListInteractionTemplate;
+
+    static void registerPython();
+};
+
+class FixedQuadrupleListTabulatedDihedral
+    : public FixedQuadrupleListInteractionTemplate<espressopp::interaction::TabulatedDihedral>
+{
+public:
+    using FixedQuadrupleListInteractionTemplate::FixedQuadrupleListInteractionTemplate;
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_DIHEDRAL_HPP
@@ -0,0 +1,193 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+***********************************
+espressopp.vec.interaction.Dihedral
+***********************************
+
+Dihedral potentials on the fixed quadruples of the vectorized storage. The potentials are those
+of :class:`espressopp.interaction.DihedralHarmonic`,
+:class:`espressopp.interaction.DihedralHarmonicCos`,
+:class:`espressopp.interaction.DihedralHarmonicNCos`, :class:`espressopp.interaction.DihedralRB`
+and :class:`espressopp.interaction.TabulatedDihedral`.
+
+.. py:class:: espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonic(system, fql, potential)
+.. py:class:: espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonicCos(system, fql, potential)
+.. py:class:: espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonicNCos(system, fql, potential)
+.. py:class:: espressopp.vec.interaction.FixedQuadrupleListDihedralRB(system, fql, potential)
+.. py:class:: espressopp.vec.interaction.FixedQuadrupleListTabulatedDihedral(system, fql, potential)
+
+    :param system: the system
+    :param fql: the quadruples
+    :type fql: espressopp.vec.FixedQuadrupleList
+    :param potential: the dihedral potential
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+
+from _espressopp import \
+    vec_interaction_FixedQuadrupleListDihedralHarmonic, \
+    vec_interaction_FixedQuadrupleListDihedralHarmonicCos, \
+    vec_interaction_FixedQuadrupleListDihedralHarmonicNCos, \
+    vec_interaction_FixedQuadrupleListDihedralRB, \
+    vec_interaction_FixedQuadrupleListTabulatedDihedral
+
+class FixedQuadrupleListDihedralHarmonicLocal(InteractionLocal, vec_interaction_FixedQuadrupleListDihedralHarmonic):
+
+    def __init__(self, system, fixedquadruplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedQuadrupleListDihedralHarmonic, system, fixedquadruplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedQuadrupleList(self, fixedquadruplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedQuadrupleList(self, fixedquadruplelist)
+
+    def getFixedQuadrupleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedQuadrupleList(self)
+
+class FixedQuadrupleListDihedralHarmonicCosLocal(InteractionLocal, vec_interaction_FixedQuadrupleListDihedralHarmonicCos):
+
+    def __init__(self, system, fixedquadruplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedQuadrupleListDihedralHarmonicCos, system, fixedquadruplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedQuadrupleList(self, fixedquadruplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedQuadrupleList(self, fixedquadruplelist)
+
+    def getFixedQuadrupleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedQuadrupleList(self)
+
+class FixedQuadrupleListDihedralHarmonicNCosLocal(InteractionLocal, vec_interaction_FixedQuadrupleListDihedralHarmonicNCos):
+
+    def __init__(self, system, fixedquadruplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedQuadrupleListDihedralHarmonicNCos, system, fixedquadruplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedQuadrupleList(self, fixedquadruplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedQuadrupleList(self, fixedquadruplelist)
+
+    def getFixedQuadrupleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedQuadrupleList(self)
+
+class FixedQuadrupleListDihedralRBLocal(InteractionLocal, vec_interaction_FixedQuadrupleListDihedralRB):
+
+    def __init__(self, system, fixedquadruplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedQuadrupleListDihedralRB, system, fixedquadruplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedQuadrupleList(self, fixedquadruplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedQuadrupleList(self, fixedquadruplelist)
+
+    def getFixedQuadrupleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedQuadrupleList(self)
+
+class FixedQuadrupleListTabulatedDihedralLocal(InteractionLocal, vec_interaction_FixedQuadrupleListTabulatedDihedral):
+
+    def __init__(self, system, fixedquadruplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedQuadrupleListTabulatedDihedral, system, fixedquadruplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedQuadrupleList(self, fixedquadruplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedQuadrupleList(self, fixedquadruplelist)
+
+    def getFixedQuadrupleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedQuadrupleList(self)
+
+if pmi.isController:
+    class FixedQuadrupleListDihedralHarmonic(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonicLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedQuadrupleList', 'getFixedQuadrupleList']
+            )
+
+    class FixedQuadrupleListDihedralHarmonicCos(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonicCosLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedQuadrupleList', 'getFixedQuadrupleList']
+            )
+
+    class FixedQuadrupleListDihedralHarmonicNCos(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonicNCosLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedQuadrupleList', 'getFixedQuadrupleList']
+            )
+
+    class FixedQuadrupleListDihedralRB(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedQuadrupleListDihedralRBLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedQuadrupleList', 'getFixedQuadrupleList']
+            )
+
+    class FixedQuadrupleListTabulatedDihedral(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedQuadrupleListTabulatedDihedralLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedQuadrupleList', 'getFixedQuadrupleList']
+            )
@@ -0,0 +1,323 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_FIXEDQUADRUPLELISTINTERACTIONTEMPLATE_HPP
+#define VEC_INTERACTION_FIXEDQUADRUPLELISTINTERACTIONTEMPLATE_HPP
+
+#include "vec/Vectorization.hpp"
+#include "vec/FixedQuadrupleList.hpp"
+
+#include "mpi.hpp"
+#include "interaction/Interaction.hpp"
+#include "Real3D.hpp"
+#include "Tensor.hpp"
+#include "Particle.hpp"
+#include "bc/BC.hpp"
+#include "SystemAccess.hpp"
+#include "types.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+template <typename _DihedralPotential>
+class FixedQuadrupleListInteractionTemplate : public espressopp::interaction::Interaction,
+                                              SystemAccess
+{
+protected:
+    typedef _DihedralPotential Potential;
+
+public:
+    FixedQuadrupleListInteractionTemplate(
+        std::shared_ptr<System> _system,
+        std::shared_ptr<vec::FixedQuadrupleList> _fixedquadrupleList,
+        std::shared_ptr<Potential> _potential)
+        : SystemAccess(_system),
+          vectorization(getSystem()->vectorization),
+          fixedquadrupleList(_fixedquadrupleList),
+          potential(_potential)
+    {
+        if (!potential)
+        {
+            LOG4ESPP_ERROR(theLogger, "NULL potential");
+        }
+    }
+
+    virtual ~FixedQuadrupleListInteractionTemplate(){};
+
+    void setFixedQuadrupleList(std::shared_ptr<FixedQuadrupleList> _fixedquadrupleList)
+    {
+        fixedquadrupleList = _fixedquadrupleList;
+    }
+
+    std::shared_ptr<FixedQuadrupleList> getFixedQuadrupleList() { return fixedquadrupleList; }
+
+    void setPotential(std::shared_ptr<Potential> _potential)
+    {
+        if (_potential)
+        {
+            potential = _potential;
+        }
+        else
+        {
+            LOG4ESPP_ERROR(theLogger, "NULL potential");
+        }
+    }
+
+    std::shared_ptr<Potential> getPotential() { return potential; }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeEnergyDeriv();
+    virtual real computeEnergyAA();
+    virtual real computeEnergyCG();
+    virtual real computeEnergyAA(int atomtype);
+    virtual real computeEnergyCG(int atomtype);
+    virtual void computeVirialX(std::vector<real>& p_xx_total, int bins);
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+    virtual void computeVirialTensor(Tensor& w, real z);
+    virtual void computeVirialTensor(Tensor* w, int n);
+    virtual real getMaxCutoff();
+    virtual int bondType() { return espressopp::interaction::Dihedral; }
+
+protected:
+    /// minimum image bond vectors 2-1, 3-2 and 4-3 of a quadruple
+    void getDistances(const Quadruple& quadruple, Real3D& dist21, Real3D& dist32, Real3D& dist43);
+
+    /// the forces on the four particles of a quadruple
+    void getForces(const Quadruple& quadruple,
+                   Real3D& dist21,
+                   Real3D& dist32,
+                   Real3D& dist43,
+                   Real3D* force);
+
+    std::shared_ptr<vec::Vectorization> vectorization;
+    std::shared_ptr<FixedQuadrupleList> fixedquadrupleList;
+    std::shared_ptr<Potential> potential;
+};
+
+//////////////////////////////////////////////////
+// INLINE IMPLEMENTATION
+//////////////////////////////////////////////////
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::getDistances(
+    const Quadruple& quadruple, Real3D& dist21, Real3D& dist32, Real3D& dist43)
+{
+    auto const& bc = *getSystemRef().bc;
+    const auto& particles = vectorization->particles;
+    const Real3D pos1 = particles.getPosition(std::get<0>(quadruple));
+    const Real3D pos2 = particles.getPosition(std::get<1>(quadruple));
+    const Real3D pos3 = particles.getPosition(std::get<2>(quadruple));
+    const Real3D pos4 = particles.getPosition(std::get<3>(quadruple));
+
+    bc.getMinimumImageVectorBox(dist21, pos2, pos1);
+    bc.getMinimumImageVectorBox(dist32, pos3, pos2);
+    bc.getMinimumImageVectorBox(dist43, pos4, pos3);
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::getForces(
+    const Quadruple& quadruple,
+    Real3D& dist21,
+    Real3D& dist32,
+    Real3D& dist43,
+    Real3D* force)
+{
+    getDistances(quadruple, dist21, dist32, dist43);
+    potential->computeColVarWeights(dist21, dist32, dist43, *getSystemRef().bc);
+    potential->_computeForce(force[0], force[1], force[2], force[3], dist21, dist32, dist43);
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::addForces()
+{
+    LOG4ESPP_INFO(theLogger, "add forces computed by FixedQuadrupleList");
+
+    auto& particles = vectorization->particles;
+    real* __restrict f_x = particles.f_x.data();
+    real* __restrict f_y = particles.f_y.data();
+    real* __restrict f_z = particles.f_z.data();
+
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        const size_t p[4] = {std::get<0>(quadruple), std::get<1>(quadruple),
+                             std::get<2>(quadruple), std::get<3>(quadruple)};
+        Real3D dist21, dist32, dist43;
+        Real3D force[4];
+        getForces(quadruple, dist21, dist32, dist43, force);
+        for (int i = 0; i < 4; i++)
+        {
+            f_x[p[i]] += force[i][0];
+            f_y[p[i]] += force[i][1];
+            f_z[p[i]] += force[i][2];
+        }
+    }
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergy()
+{
+    LOG4ESPP_INFO(theLogger, "compute energy of the quadruples");
+
+    real e = 0.0;
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        getDistances(quadruple, dist21, dist32, dist43);
+        potential->computeColVarWeights(dist21, dist32, dist43, *getSystemRef().bc);
+        e += potential->_computeEnergy(dist21, dist32, dist43);
+    }
+
+    real esum;
+    boost::mpi::all_reduce(*mpiWorld, e, esum, std::plus<real>());
+    return esum;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyDeriv()
+{
+    std::cout << "Warning! At the moment computeEnergyDeriv() in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyAA()
+{
+    std::cout << "Warning! At the moment computeEnergyAA() in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyAA(int atomtype)
+{
+    std::cout << "Warning! At the moment computeEnergyAA(int atomtype) in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyCG()
+{
+    std::cout << "Warning! At the moment computeEnergyCG() in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyCG(int atomtype)
+{
+    std::cout << "Warning! At the moment computeEnergyCG(int atomtype) in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialX(
+    std::vector<real>& p_xx_total, int bins)
+{
+    std::cout << "Warning! At the moment computeVirialX in FixedQuadrupleListInteractionTemplate "
+                 "does not work."
+              << std::endl
+              << "Therefore, the corresponding interactions won't be included in calculation."
+              << std::endl;
+}
+
+// the virial sum_i r_i f_i of a quadruple, with the positions relative to the first particle
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirial()
+{
+    LOG4ESPP_INFO(theLogger, "compute scalar virial of the quadruples");
+
+    real w = 0.0;
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        Real3D force[4];
+        getForces(quadruple, dist21, dist32, dist43, force);
+        const Real3D r2 = dist21, r3 = r2 + dist32, r4 = r3 + dist43;
+        w += r2 * force[1] + r3 * force[2] + r4 * force[3];
+    }
+
+    real wsum;
+    boost::mpi::all_reduce(*mpiWorld, w, wsum, std::plus<real>());
+    return wsum;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialTensor(
+    Tensor& w)
+{
+    LOG4ESPP_INFO(theLogger, "compute the virial tensor of the quadruples");
+
+    Tensor wlocal(0.0);
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        Real3D force[4];
+        getForces(quadruple, dist21, dist32, dist43, force);
+        const Real3D r2 = dist21, r3 = r2 + dist32, r4 = r3 + dist43;
+        wlocal += Tensor(r2, force[1]) + Tensor(r3, force[2]) + Tensor(r4, force[3]);
+    }
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialTensor(
+    Tensor& w, real z)
+{
+    std::cout << "Warning!!! computeVirialTensor in specified volume doesn't work for "
+                 "FixedQuadrupleListInteractionTemplate at the moment"
+              << std::endl;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialTensor(
+    Tensor* w, int n)
+{
+    std::cout << "Warning!!! computeVirialTensor in specified volume doesn't work for "
+                 "FixedQuadrupleListInteractionTemplate at the moment"
+              << std::endl;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::getMaxCutoff()
+{
+    return potential->getCutoff();
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_FIXEDQUADRUPLELISTINTERACTIONTEMPLATE_HPP
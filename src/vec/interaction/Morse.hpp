@@ -0,0 +1,89 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_MORSE_HPP
+#define VEC_INTERACTION_MORSE_HPP
+
+#include <cmath>
+
+#include "interaction/Morse.hpp"
+#include "VerletListKernelInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** SoA kernel of the Morse potential
+    \f$ V(r) = \varepsilon (e^{-2\alpha(r - r_{min})} - 2 e^{-\alpha(r - r_{min})}) \f$,
+    which needs one exponential per pair.
+*/
+struct MorseKernel
+{
+    typedef espressopp::interaction::Morse Potential;
+    static constexpr bool charged = false;
+
+    struct Coefficients
+    {
+        real alpha, rMin;
+        real ff;  // 2 alpha epsilon
+        real epsilon, shift;
+    };
+
+    Coefficients coefficients(const Potential& p) const
+    {
+        return {p.getAlpha(), p.getRMin(), 2.0 * p.getAlpha() * p.getEpsilon(), p.getEpsilon(),
+                p.getShift()};
+    }
+
+    static real cutoffSqr(const Potential& p) { return p.getCutoff() * p.getCutoff(); }
+
+    real forceFactor(const Coefficients& c, real distSqr, real) const
+    {
+        const real r = std::sqrt(distSqr);
+        const real e = std::exp(-c.alpha * (r - c.rMin));
+        return c.ff * (e * e - e) / r;
+    }
+
+    real energy(const Coefficients& c, real distSqr, real) const
+    {
+        const real e = std::exp(-c.alpha * (std::sqrt(distSqr) - c.rMin));
+        return c.epsilon * (e * e - 2.0 * e) - c.shift;
+    }
+};
+
+class VerletListMorse
+    : public VerletListKernelInteractionTemplate<espressopp::interaction::Morse, MorseKernel>
+{
+public:
+    VerletListMorse(std::shared_ptr<VerletList> _verletList)
+        : VerletListKernelInteractionTemplate(_verletList)
+    {
+    }
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_MORSE_HPP
@@ -0,0 +1,81 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+********************************
+espressopp.vec.interaction.Morse
+********************************
+
+Morse interaction on the Verlet list of the vectorized storage. The potentials are those of
+:class:`espressopp.interaction.Morse`, the forces are computed by a SoA kernel with one
+exponential per pair.
+
+.. py:class:: espressopp.vec.interaction.VerletListMorse(vl)
+
+    :param vl: Verlet list
+    :type vl: espressopp.vec.VerletList
+
+    .. py:method:: setPotential(type1, type2, potential)
+
+        :param int type1:
+        :param int type2:
+        :param potential: the potential between the particle types
+        :type potential: espressopp.interaction.Morse
+
+    .. py:method:: getPotential(type1, type2)
+
+        :rtype: espressopp.interaction.Morse
+
+>>> vl = espressopp.vec.VerletList(system, cutoff=rc)
+>>> morse = espressopp.vec.interaction.VerletListMorse(vl)
+>>> morse.setPotential(0, 0, espressopp.interaction.Morse(epsilon=1.0, alpha=1.0, rMin=1.5, cutoff=rc))
+>>> system.addInteraction(morse)
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+
+from _espressopp import \
+    vec_interaction_VerletListMorse
+
+class VerletListMorseLocal(InteractionLocal, vec_interaction_VerletListMorse):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_VerletListMorse, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+if pmi.isController:
+    class VerletListMorse(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.VerletListMorseLocal',
+            pmicall = ['setPotential', 'getPotential', 'getVerletList']
+            )
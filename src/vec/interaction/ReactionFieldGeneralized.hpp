@@ -0,0 +1,84 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_REACTIONFIELDGENERALIZED_HPP
+#define VEC_INTERACTION_REACTIONFIELDGENERALIZED_HPP
+
+#include <cmath>
+
+#include "interaction/ReactionFieldGeneralized.hpp"
+#include "VerletListKernelInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** SoA kernel of the generalized reaction field,
+    \f$ V(r) = C q_1 q_2 (1/r - B_1 r^2 / 2 - c_{rf}) \f$.
+*/
+struct ReactionFieldGeneralizedKernel
+{
+    typedef espressopp::interaction::ReactionFieldGeneralized Potential;
+    static constexpr bool charged = true;
+
+    struct Coefficients
+    {
+        real prefactor;
+        real B1, crf;
+    };
+
+    Coefficients coefficients(const Potential& p) const
+    {
+        return {p.getPrefactor(), p.getB1(), p.getCrf()};
+    }
+
+    static real cutoffSqr(const Potential& p) { return p.getCutoff() * p.getCutoff(); }
+
+    real forceFactor(const Coefficients& c, real distSqr, real qq) const
+    {
+        return c.prefactor * qq * (1.0 / (std::sqrt(distSqr) * distSqr) + c.B1);
+    }
+
+    real energy(const Coefficients& c, real distSqr, real qq) const
+    {
+        return c.prefactor * qq * (1.0 / std::sqrt(distSqr) - 0.5 * c.B1 * distSqr - c.crf);
+    }
+};
+
+class VerletListReactionFieldGeneralized
+    : public VerletListKernelInteractionTemplate<espressopp::interaction::ReactionFieldGeneralized,
+                                                 ReactionFieldGeneralizedKernel>
+{
+public:
+    VerletListReactionFieldGeneralized(std::shared_ptr<VerletList> _verletList)
+        : VerletListKernelInteractionTemplate(_verletList)
+    {
+    }
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_REACTIONFIELDGENERALIZED_HPP
@@ -0,0 +1,76 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+***************************************************
+espressopp.vec.interaction.ReactionFieldGeneralized
+***************************************************
+
+Generalized reaction field on the Verlet list of the vectorized storage, with the potentials of
+:class:`espressopp.interaction.ReactionFieldGeneralized`. The charges are taken from the
+particle arrays of the vectorization.
+
+.. py:class:: espressopp.vec.interaction.VerletListReactionFieldGeneralized(vl)
+
+    :param vl: Verlet list
+    :type vl: espressopp.vec.VerletList
+
+    .. py:method:: setPotential(type1, type2, potential)
+
+        :param int type1:
+        :param int type2:
+        :param potential: the potential between the particle types
+        :type potential: espressopp.interaction.ReactionFieldGeneralized
+
+    .. py:method:: getPotential(type1, type2)
+
+        :rtype: espressopp.interaction.ReactionFieldGeneralized
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+
+from _espressopp import \
+    vec_interaction_VerletListReactionFieldGeneralized
+
+class VerletListReactionFieldGeneralizedLocal(InteractionLocal, vec_interaction_VerletListReactionFieldGeneralized):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_VerletListReactionFieldGeneralized, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+if pmi.isController:
+    class VerletListReactionFieldGeneralized(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.VerletListReactionFieldGeneralizedLocal',
+            pmicall = ['setPotential', 'getPotential', 'getVerletList']
+            )
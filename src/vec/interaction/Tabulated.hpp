@@ -0,0 +1,202 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_TABULATED_HPP
+#define VEC_INTERACTION_TABULATED_HPP
+
+#include <algorithm>
+#include <cmath>
+
+#include "interaction/Tabulated.hpp"
+#include "interaction/Interpolation.hpp"
+#include "VerletListKernelInteractionTemplate.hpp"
+#include "FixedPairListInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** SoA kernel of tabulated pair potentials.
+
+    The linear, Akima and cubic spline interpolations of the tables are all cubic polynomials
+    of the distance within each interval of the table. They are stored as monomial coefficients
+    in t = (r - inner) / delta - bin, in separate arrays for the four powers, the tables of all
+    type pairs one after the other. The kernel then only needs the bin, four gathers from these
+    arrays and a Horner scheme, independent of the interpolation type.
+*/
+struct TabulatedKernel
+{
+    typedef espressopp::interaction::Tabulated Potential;
+    static constexpr bool charged = false;
+
+    struct Coefficients
+    {
+        real inner, invdelta;
+        int offset;  // of the first bin of the table
+        int maxBin;
+        real shift;
+    };
+
+    AlignedVector<real> f0, f1, f2, f3;
+    AlignedVector<real> e0, e1, e2, e3;
+
+    Coefficients coefficients(const Potential& p)
+    {
+        Coefficients c = {0.0, 0.0, static_cast<int>(f0.size()), 0, 0.0};
+
+        const auto table = p.getTable();
+        if (!table || p.getInterpolationType() == 0)
+        {
+            // the type pair is switched off by its cutoff, but the offset must stay valid
+            addBin(0.0, 0.0, 0.0, 0.0, f0, f1, f2, f3);
+            addBin(0.0, 0.0, 0.0, 0.0, e0, e1, e2, e3);
+            return c;
+        }
+
+        const int nbins = table->getN() - 1;
+        const real inner = table->getInner();
+        const real delta = (table->getOuter() - inner) / nbins;
+        c.inner = inner;
+        c.invdelta = 1.0 / delta;
+        c.maxBin = nbins - 1;
+        c.shift = p.getShift();
+
+        // a cubic is determined by four values, which are taken inside of the bin so that the
+        // table looks them up in this bin and not in a neighboring one
+        const real t[4] = {0.125, 0.375, 0.625, 0.875};
+        for (int bin = 0; bin < nbins; bin++)
+        {
+            real fv[4], ev[4];
+            for (int j = 0; j < 4; j++)
+            {
+                const real r = inner + (bin + t[j]) * delta;
+                fv[j] = table->getForce(r);
+                ev[j] = table->getEnergy(r);
+            }
+            fitCubic(t, fv, f0, f1, f2, f3);
+            fitCubic(t, ev, e0, e1, e2, e3);
+        }
+        return c;
+    }
+
+    static real cutoffSqr(const Potential& p)
+    {
+        if (!p.getTable() || p.getInterpolationType() == 0) return -1.0;
+        return p.getCutoff() * p.getCutoff();
+    }
+
+    real forceFactor(const Coefficients& c, real distSqr, real) const
+    {
+        const real r = std::sqrt(distSqr);
+        int i;
+        const real t = locate(c, r, i);
+        return (((f3[i] * t + f2[i]) * t + f1[i]) * t + f0[i]) / r;
+    }
+
+    real energy(const Coefficients& c, real distSqr, real) const
+    {
+        int i;
+        const real t = locate(c, std::sqrt(distSqr), i);
+        return ((e3[i] * t + e2[i]) * t + e1[i]) * t + e0[i] - c.shift;
+    }
+
+private:
+    // index of the bin of r and position of r in it; distances outside of the table are
+    // extrapolated from the first or the last bin
+    static real locate(const Coefficients& c, real r, int& i)
+    {
+        const real s = (r - c.inner) * c.invdelta;
+        const int bin = std::min(std::max(static_cast<int>(s), 0), c.maxBin);
+        i = c.offset + bin;
+        return s - bin;
+    }
+
+    static void addBin(real a0,
+                       real a1,
+                       real a2,
+                       real a3,
+                       AlignedVector<real>& c0,
+                       AlignedVector<real>& c1,
+                       AlignedVector<real>& c2,
+                       AlignedVector<real>& c3)
+    {
+        c0.push_back(a0);
+        c1.push_back(a1);
+        c2.push_back(a2);
+        c3.push_back(a3);
+    }
+
+    // monomial coefficients of the cubic through (t[j], y[j]), via Newton's divided differences
+    static void fitCubic(const real* t,
+                         const real* y,
+                         AlignedVector<real>& c0,
+                         AlignedVector<real>& c1,
+                         AlignedVector<real>& c2,
+                         AlignedVector<real>& c3)
+    {
+        real d[4] = {y[0], y[1], y[2], y[3]};
+        for (int k = 1; k < 4; k++)
+            for (int j = 3; j >= k; j--) d[j] = (d[j] - d[j - 1]) / (t[j] - t[j - k]);
+
+        // p(t) = d0 + (t - t0) (d1 + (t - t1) (d2 + (t - t2) d3)), expanded from the inside
+        real a[4] = {d[3], 0.0, 0.0, 0.0};
+        for (int k = 2; k >= 0; k--)
+        {
+            for (int j = 3; j > 0; j--) a[j] = a[j - 1] - t[k] * a[j];
+            a[0] = d[k] - t[k] * a[0];
+        }
+        addBin(a[0], a[1], a[2], a[3], c0, c1, c2, c3);
+    }
+};
+
+class VerletListTabulated
+    : public VerletListKernelInteractionTemplate<espressopp::interaction::Tabulated,
+                                                 TabulatedKernel>
+{
+public:
+    VerletListTabulated(std::shared_ptr<VerletList> _verletList)
+        : VerletListKernelInteractionTemplate(_verletList)
+    {
+    }
+
+    static void registerPython();
+};
+
+class FixedPairListTabulated
+    : public FixedPairListInteractionTemplate<espressopp::interaction::Tabulated>
+{
+public:
+    FixedPairListTabulated(std::shared_ptr<System> system,
+                           std::shared_ptr<FixedPairList> fpl,
+                           std::shared_ptr<espressopp::interaction::Tabulated> potential)
+        : FixedPairListInteractionTemplate(system, fpl, potential)
+    {
+    }
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_TABULATED_HPP
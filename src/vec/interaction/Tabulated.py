@@ -0,0 +1,117 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+************************************
+espressopp.vec.interaction.Tabulated
+************************************
+
+Tabulated pair interactions on the vectorized storage, with the potentials of
+:class:`espressopp.interaction.Tabulated`.
+
+On the Verlet list, the linear, Akima or cubic spline interpolation of each table is converted
+into one cubic polynomial per interval of the table, stored in separate arrays per coefficient.
+The forces are then evaluated by a SoA kernel, with the same values as the interpolation of the
+table up to rounding errors. The tables are converted again after a potential is set.
+
+.. py:class:: espressopp.vec.interaction.VerletListTabulated(vl)
+
+    :param vl: Verlet list
+    :type vl: espressopp.vec.VerletList
+
+    .. py:method:: setPotential(type1, type2, potential)
+
+        :param int type1:
+        :param int type2:
+        :param potential: the potential between the particle types
+        :type potential: espressopp.interaction.Tabulated
+
+    .. py:method:: getPotential(type1, type2)
+
+        :rtype: espressopp.interaction.Tabulated
+
+.. py:class:: espressopp.vec.interaction.FixedPairListTabulated(system, fpl, potential)
+
+    :param system: the system
+    :param fpl: the bonds
+    :type fpl: espressopp.vec.FixedPairList
+    :param potential: the potential of the bonds
+    :type potential: espressopp.interaction.Tabulated
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+
+from _espressopp import \
+    vec_interaction_VerletListTabulated, \
+    vec_interaction_FixedPairListTabulated
+
+class VerletListTabulatedLocal(InteractionLocal, vec_interaction_VerletListTabulated):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_VerletListTabulated, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+class FixedPairListTabulatedLocal(InteractionLocal, vec_interaction_FixedPairListTabulated):
+
+    def __init__(self, system, fixedpairlist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedPairListTabulated, system, fixedpairlist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedPairList(self, fixedpairlist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedPairList(self, fixedpairlist)
+
+    def getFixedPairList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedPairList(self)
+
+if pmi.isController:
+    class VerletListTabulated(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.VerletListTabulatedLocal',
+            pmicall = ['setPotential', 'getPotential', 'getVerletList']
+            )
+
+    class FixedPairListTabulated(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedPairListTabulatedLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedPairList', 'getFixedPairList']
+            )
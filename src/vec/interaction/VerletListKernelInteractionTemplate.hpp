@@ -0,0 +1,362 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_VERLETLISTKERNELINTERACTIONTEMPLATE_HPP
+#define VEC_INTERACTION_VERLETLISTKERNELINTERACTIONTEMPLATE_HPP
+
+#include "types.hpp"
+#include "Real3D.hpp"
+#include "Tensor.hpp"
+
+#include "VerletListInteractionTemplate.hpp"
+#include "vec/VerletList.hpp"
+#include "vec/Vectorization.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Verlet list interaction that evaluates the pair forces with a SoA kernel instead of the
+    Real3D interface of the potential, like VerletListLennardJones does for the LJ potential.
+
+    The potentials are set per type pair as usual. Before the force loop their parameters are
+    copied into a flat lookup table of Kernel::Coefficients, indexed by type1 * ntypes + type2,
+    so that the innermost loop only reads plain arrays. A kernel provides
+
+    - Coefficients coefficients(const Potential&), which may also fill tables of the kernel
+    - static real cutoffSqr(const Potential&), negative to switch a type pair off
+    - real forceFactor(const Coefficients&, real distSqr, real qq) const, the force divided by
+      the distance
+    - real energy(const Coefficients&, real distSqr, real qq) const
+    - static constexpr bool charged, whether qq is the product of the charges or 1
+
+    Kernels of potentials that depend on the charges replace the particle based interface of
+    the AoS potential, which the vec storage cannot call.
+*/
+template <typename _Potential, typename _Kernel>
+class VerletListKernelInteractionTemplate : public VerletListInteractionTemplate<_Potential>
+{
+protected:
+    typedef _Potential Potential;
+    typedef _Kernel Kernel;
+    typedef typename Kernel::Coefficients Coefficients;
+    typedef VerletListInteractionTemplate<_Potential> base;
+
+public:
+    VerletListKernelInteractionTemplate(std::shared_ptr<VerletList> _verletList)
+        : base(_verletList), np_types(0), p_types(0)
+    {
+    }
+
+    void setPotential(int type1, int type2, const Potential& potential)
+    {
+        base::setPotential(type1, type2, potential);
+        needRebuildPotential = true;
+    }
+
+    void rebuildPotential()
+    {
+        np_types = this->potentialArray.size_n();
+        p_types = this->potentialArray.size_m();
+        kernel = Kernel();
+        coeffs = AlignedVector<Coefficients>(np_types * p_types);
+        cutoffSqr = AlignedVector<real>(np_types * p_types);
+        auto it1 = coeffs.begin();
+        auto it2 = cutoffSqr.begin();
+        for (auto& p : this->potentialArray)
+        {
+            *(it1++) = kernel.coefficients(p);
+            *(it2++) = Kernel::cutoffSqr(p);
+        }
+        needRebuildPotential = false;
+    }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+    virtual void computeVirialTensor(Tensor& w, real z);
+    virtual void computeVirialTensor(Tensor* w, int n);
+
+    template <bool ONETYPE>
+    static void addForces_impl(ParticleArray& particles,
+                               VerletList::NeighborList const& neighborList,
+                               Kernel const& kernel,
+                               AlignedVector<Coefficients> const& coeffs,
+                               AlignedVector<real> const& cutoffSqr,
+                               size_t np_types);
+
+protected:
+    void updatePotential();
+
+    /// calls f(p1, p2, r21, distSqr, lookup, qq) for all pairs within the cutoff of their
+    /// potential
+    template <typename F>
+    void loopPairs(F&& f);
+
+    Kernel kernel;
+    size_t np_types, p_types;
+    AlignedVector<Coefficients> coeffs;
+    AlignedVector<real> cutoffSqr;
+    bool needRebuildPotential = true;
+};
+
+//////////////////////////////////////////////////
+// INLINE IMPLEMENTATION
+//////////////////////////////////////////////////
+template <typename _Potential, typename _Kernel>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::updatePotential()
+{
+    // the lookup of the largest type in the list resizes the potential array if needed
+    const auto vlmaxtype = this->verletList->getNeighborList().max_type;
+    Potential max_pot = this->getPotential(vlmaxtype, vlmaxtype);
+    if (needRebuildPotential || np_types != this->potentialArray.size_n() ||
+        p_types != this->potentialArray.size_m())
+    {
+        rebuildPotential();
+    }
+}
+
+template <typename _Potential, typename _Kernel>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::addForces()
+{
+    LOG4ESPP_DEBUG(_Potential::theLogger, "loop over verlet list pairs and add forces");
+
+    updatePotential();
+
+    auto& pa = this->verletList->getVectorization()->particles;
+    const auto& nl = this->verletList->getNeighborList();
+    if (np_types == 1 && p_types == 1)
+    {
+        addForces_impl<true>(pa, nl, kernel, coeffs, cutoffSqr, np_types);
+    }
+    else
+    {
+        addForces_impl<false>(pa, nl, kernel, coeffs, cutoffSqr, np_types);
+    }
+}
+
+template <typename _Potential, typename _Kernel>
+template <bool ONETYPE>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::addForces_impl(
+    ParticleArray& particles,
+    VerletList::NeighborList const& neighborList,
+    Kernel const& kernel,
+    AlignedVector<Coefficients> const& coeffs,
+    AlignedVector<real> const& cutoffSqr,
+    size_t np_types)
+{
+    Coefficients coeffs_;
+    real cutoffSqr_;
+    if (ONETYPE)
+    {
+        coeffs_ = coeffs[0];
+        cutoffSqr_ = cutoffSqr[0];
+    }
+
+    const size_t* __restrict pa_type = particles.type.data();
+    const real* __restrict pa_q = particles.q.data();
+    const real* __restrict pa_p_x = particles.p_x.data();
+    const real* __restrict pa_p_y = particles.p_y.data();
+    const real* __restrict pa_p_z = particles.p_z.data();
+    real* __restrict pa_f_x = particles.f_x.data();
+    real* __restrict pa_f_y = particles.f_y.data();
+    real* __restrict pa_f_z = particles.f_z.data();
+
+    const auto* __restrict plist = neighborList.plist.data();
+    const auto* __restrict prange = neighborList.prange.data();
+    const auto* __restrict nplist = neighborList.nplist.data();
+    const int ip_max = neighborList.plist.size();
+
+    for (int ip = 0; ip < ip_max; ip++)
+    {
+        int p = plist[ip];
+        int p_lookup;
+        if (!ONETYPE)
+        {
+            p_lookup = pa_type[p] * np_types;
+        }
+        const real p_x = pa_p_x[p];
+        const real p_y = pa_p_y[p];
+        const real p_z = pa_p_z[p];
+        const real p_q = Kernel::charged ? pa_q[p] : 1.0;
+
+        real f_x = 0.0;
+        real f_y = 0.0;
+        real f_z = 0.0;
+
+        const int in_min = prange[ip].first;
+        const int in_max = prange[ip].second;
+
+        ESPP_VEC_PRAGMAS
+        for (int in = in_min; in < in_max; in++)
+        {
+            auto np_ii = nplist[in];
+
+            const real dist_x = p_x - pa_p_x[np_ii];
+            const real dist_y = p_y - pa_p_y[np_ii];
+            const real dist_z = p_z - pa_p_z[np_ii];
+            const real distSqr = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
+
+            int np_lookup;
+            if (!ONETYPE)
+            {
+                np_lookup = pa_type[np_ii] + p_lookup;
+                cutoffSqr_ = cutoffSqr[np_lookup];
+            }
+
+            if (distSqr <= cutoffSqr_)
+            {
+                const real qq = Kernel::charged ? p_q * pa_q[np_ii] : 1.0;
+                const real ffactor =
+                    kernel.forceFactor(ONETYPE ? coeffs_ : coeffs[np_lookup], distSqr, qq);
+
+                f_x += dist_x * ffactor;
+                f_y += dist_y * ffactor;
+                f_z += dist_z * ffactor;
+
+                pa_f_x[np_ii] -= dist_x * ffactor;
+                pa_f_y[np_ii] -= dist_y * ffactor;
+                pa_f_z[np_ii] -= dist_z * ffactor;
+            }
+        }
+
+        pa_f_x[p] += f_x;
+        pa_f_y[p] += f_y;
+        pa_f_z[p] += f_z;
+    }
+}
+
+template <typename _Potential, typename _Kernel>
+template <typename F>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::loopPairs(F&& f)
+{
+    updatePotential();
+
+    const auto& particles = this->verletList->getVectorization()->particles;
+    const auto& neighborList = this->verletList->getNeighborList();
+    const auto* __restrict plist = neighborList.plist.data();
+    const auto* __restrict prange = neighborList.prange.data();
+    const auto* __restrict nplist = neighborList.nplist.data();
+
+    const int ip_max = neighborList.plist.size();
+    for (int ip = 0; ip < ip_max; ip++)
+    {
+        const int p1 = plist[ip];
+        const size_t p_lookup = particles.type[p1] * np_types;
+        const real p_q = Kernel::charged ? particles.q[p1] : 1.0;
+
+        const int in_min = prange[ip].first;
+        const int in_max = prange[ip].second;
+        for (int in = in_min; in < in_max; in++)
+        {
+            const int p2 = nplist[in];
+            const size_t lookup = particles.type[p2] + p_lookup;
+
+            const real dist_x = particles.p_x[p1] - particles.p_x[p2];
+            const real dist_y = particles.p_y[p1] - particles.p_y[p2];
+            const real dist_z = particles.p_z[p1] - particles.p_z[p2];
+            const real distSqr = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
+            if (distSqr > cutoffSqr[lookup]) continue;
+
+            const real qq = Kernel::charged ? p_q * particles.q[p2] : 1.0;
+            f(p1, p2, Real3D(dist_x, dist_y, dist_z), distSqr, lookup, qq);
+        }
+    }
+}
+
+template <typename _Potential, typename _Kernel>
+inline real VerletListKernelInteractionTemplate<_Potential, _Kernel>::computeEnergy()
+{
+    real es = 0.0;
+    loopPairs([&](int, int, const Real3D&, real distSqr, size_t lookup, real qq)
+              { es += kernel.energy(coeffs[lookup], distSqr, qq); });
+
+    // reduce over all CPUs
+    real esum;
+    boost::mpi::all_reduce(*this->verletList->getSystem()->comm, es, esum, std::plus<real>());
+    return esum;
+}
+
+template <typename _Potential, typename _Kernel>
+inline real VerletListKernelInteractionTemplate<_Potential, _Kernel>::computeVirial()
+{
+    real w = 0.0;
+    loopPairs([&](int, int, const Real3D& r21, real distSqr, size_t lookup, real qq)
+              { w += distSqr * kernel.forceFactor(coeffs[lookup], distSqr, qq); });
+
+    // reduce over all CPUs
+    real wsum;
+    boost::mpi::all_reduce(*mpiWorld, w, wsum, std::plus<real>());
+    return wsum;
+}
+
+template <typename _Potential, typename _Kernel>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::computeVirialTensor(
+    Tensor& w)
+{
+    Tensor wlocal(0.0);
+    loopPairs(
+        [&](int, int, const Real3D& r21, real distSqr, size_t lookup, real qq)
+        { wlocal += Tensor(r21, r21 * kernel.forceFactor(coeffs[lookup], distSqr, qq)); });
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+// the layer resolved virials call the potentials directly, which only works for potentials
+// that do not depend on the charges
+template <typename _Potential, typename _Kernel>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::computeVirialTensor(
+    Tensor& w, real z)
+{
+    if (Kernel::charged)
+    {
+        LOG4ESPP_WARN(_Potential::theLogger,
+                      "Warning! computeVirialTensor(Tensor& w, real z) is not implemented "
+                      "for charged potentials.");
+        return;
+    }
+    base::computeVirialTensor(w, z);
+}
+
+template <typename _Potential, typename _Kernel>
+inline void VerletListKernelInteractionTemplate<_Potential, _Kernel>::computeVirialTensor(
+    Tensor* w, int n)
+{
+    if (Kernel::charged)
+    {
+        LOG4ESPP_WARN(_Potential::theLogger,
+                      "Warning! computeVirialTensor(Tensor* w, int n) is not implemented "
+                      "for charged potentials.");
+        return;
+    }
+    base::computeVirialTensor(w, n);
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_VERLETLISTKERNELINTERACTIONTEMPLATE_HPP
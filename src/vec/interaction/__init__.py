@@ -23,3 +23,10 @@ from espressopp.vec.interaction.LennardJones import *
 from espressopp.vec.interaction.LennardJonesCapped import *
 from espressopp.vec.interaction.FENE import *
 from espressopp.vec.interaction.Cosine import *
+from espressopp.vec.interaction.Morse import *
+from espressopp.vec.interaction.Tabulated import *
+from espressopp.vec.interaction.CoulombRSpace import *
+from espressopp.vec.interaction.ReactionFieldGeneralized import *
+from espressopp.vec.interaction.Harmonic import *
+from espressopp.vec.interaction.Angular import *
+from espressopp.vec.interaction.Dihedral import *
@@ -25,6 +25,13 @@
 #include "LennardJonesCapped.hpp"
 #include "FENE.hpp"
 #include "Cosine.hpp"
+#include "Morse.hpp"
+#include "Tabulated.hpp"
+#include "CoulombRSpace.hpp"
+#include "ReactionFieldGeneralized.hpp"
+#include "Harmonic.hpp"
+#include "Angular.hpp"
+#include "Dihedral.hpp"
 
 namespace espressopp
 {
@@ -38,6 +45,20 @@ void registerPython()
     LennardJonesCapped::registerPython();
     FENE::registerPython();
     Cosine::registerPython();
+    VerletListMorse::registerPython();
+    VerletListTabulated::registerPython();
+    FixedPairListTabulated::registerPython();
+    VerletListCoulombRSpace::registerPython();
+    VerletListReactionFieldGeneralized::registerPython();
+    FixedPairListHarmonic::registerPython();
+    FixedTripleListAngularHarmonic::registerPython();
+    FixedTripleListAngularCosineSquared::registerPython();
+    FixedTripleListTabulatedAngular::registerPython();
+    FixedQuadrupleListDihedralHarmonic::registerPython();
+    FixedQuadrupleListDihedralHarmonicCos::registerPython();
+    FixedQuadrupleListDihedralHarmonicNCos::registerPython();
+    FixedQuadrupleListDihedralRB::registerPython();
+    FixedQuadrupleListTabulatedDihedral::registerPython();
 }
 }  // namespace interaction
 }  // namespace vec
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+import numpy as np
+
+import unittest
+
+class TestConfigurations(unittest.TestCase):
+    def setUp(self):
+        box = (10.0, 10.0, 10.0)
+        self.system = espressopp.System()
+        self.system.rng = espressopp.esutil.RNG()
+        self.system.bc = espressopp.bc.OrthorhombicBC(self.system.rng, box)
+        nodeGrid = espressopp.tools.decomp.nodeGrid(MPI.COMM_WORLD.size)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=1.5, skin=0.3)
+        self.system.storage = espressopp.storage.DomainDecomposition(self.system, nodeGrid, cellGrid)
+
+        # sparse ids close to the largest one, the memory must not grow with them
+        rng = np.random.RandomState(3)
+        self.ids = 2000000000 - 1000 * rng.permutation(300)
+        self.pos = rng.uniform(0.0, 10.0, (300, 3))
+        self.vel = rng.normal(size=(300, 3))
+        particles = [(int(self.ids[i]), espressopp.Real3D(*self.pos[i]), espressopp.Real3D(*self.vel[i]))
+                     for i in range(300)]
+        self.system.storage.addParticles(particles, 'id', 'pos', 'v')
+        self.system.storage.decompose()
+
+    def test_configuration(self):
+        configurations = espressopp.analysis.Configurations(self.system, pos=True, vel=True)
+        configurations.gather()
+        config = configurations[0]
+        self.assertEqual(config.size, 300)
+        self.assertEqual(list(config.getIds()), sorted(self.ids))
+        for i in range(300):
+            np.testing.assert_allclose(list(config.getCoordinates(int(self.ids[i]))), self.pos[i])
+            np.testing.assert_allclose(list(config.getVelocities(int(self.ids[i]))), self.vel[i])
+        self.assertEqual(list(config.getCoordinates(5)), [0.0, 0.0, 0.0])
+
+    def test_configuration_ext(self):
+        configurations = espressopp.analysis.ConfigurationsExt(self.system)
+        configurations.gather()
+        config = configurations[0]
+        self.assertEqual(config.size, 300)
+        self.assertEqual(list(config), sorted(self.ids))
+        for i in range(300):
+            props = config[int(self.ids[i])]
+            np.testing.assert_allclose([props[k] for k in range(6)],
+                                       np.concatenate((self.pos[i], self.vel[i])))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+import numpy as np
+
+import unittest
+
+class TestMeanSquareDispl(unittest.TestCase):
+    def setUp(self):
+        box = (10.0, 10.0, 10.0)
+        self.system = espressopp.System()
+        self.system.rng = espressopp.esutil.RNG()
+        self.system.bc = espressopp.bc.OrthorhombicBC(self.system.rng, box)
+        self.system.skin = 0.3
+        nodeGrid = espressopp.tools.decomp.nodeGrid(MPI.COMM_WORLD.size)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=1.5, skin=0.3)
+        self.system.storage = espressopp.storage.DomainDecomposition(self.system, nodeGrid, cellGrid)
+
+        rng = np.random.RandomState(3)
+        pos = rng.uniform(0.0, 10.0, (50, 3))
+        vel = rng.normal(0.0, 1.0, (50, 3))
+        self.v2 = (vel * vel).sum(axis=1).mean()
+        particle_list = [(i, espressopp.Real3D(*pos[i]), espressopp.Real3D(*vel[i])) for i in range(50)]
+        self.system.storage.addParticles(particle_list, 'id', 'pos', 'v')
+        self.system.storage.decompose()
+
+        # free flight, so that r(t) - r(0) = v t
+        self.integrator = espressopp.integrator.VelocityVerlet(self.system)
+        self.integrator.dt = 0.01
+
+    def test_fft(self):
+        msd = espressopp.analysis.MeanSquareDispl(self.system)
+        msd.print_progress = False
+        for i in range(30):
+            msd.gather()
+            self.integrator.run(5)
+        fft = np.array(msd.compute())
+        msd.useFFT = False
+        np.testing.assert_allclose(fft, np.array(msd.compute()), rtol=1e-8, atol=1e-10)
+        tau = np.arange(30) * 0.05
+        np.testing.assert_allclose(fft, self.v2 * tau * tau / 6.0, rtol=1e-8, atol=1e-10)
+
+    def test_autocorrelation_fft(self):
+        rng = np.random.RandomState(5)
+        values = rng.normal(0.0, 1.0, (40, 3))
+        acf = espressopp.analysis.Autocorrelation(self.system)
+        for v in values:
+            acf.gather(espressopp.Real3D(*v))
+        fft = np.array(acf.compute())
+        acf.useFFT = False
+        np.testing.assert_allclose(fft, np.array(acf.compute()), rtol=1e-8, atol=1e-10)
+        exact = [(values[m:] * values[:40 - m]).sum() / (3.0 * (40 - m)) for m in range(40)]
+        np.testing.assert_allclose(fft, exact, rtol=1e-8, atol=1e-10)
+
+    def test_multiple_tau(self):
+        msd = espressopp.analysis.MultipleTauCorrelator(self.system, self.integrator, 'msd', p=8, m=2, levels=4)
+        vacf = espressopp.analysis.MultipleTauCorrelator(self.system, self.integrator, 'vacf', p=8, m=2, levels=4)
+        self.integrator.addExtension(espressopp.integrator.ExtAnalyze(msd, interval=2))
+        self.integrator.addExtension(espressopp.integrator.ExtAnalyze(vacf, interval=2))
+        self.integrator.run(200)
+        self.assertEqual(msd.numSamples, vacf.numSamples)
+
+        # block averages of a linear motion are still linear, so every level is exact
+        result = np.array(msd.compute())
+        self.assertAlmostEqual(result[-1][0], 8 * 0.02 * 7, places=10)
+        np.testing.assert_allclose(result[:, 1], self.v2 * result[:, 0]**2, rtol=1e-8, atol=1e-10)
+        result = np.array(vacf.compute())
+        np.testing.assert_allclose(result[:, 1], self.v2, rtol=1e-8)
+
+
+if __name__ == '__main__':
+    unittest.main()
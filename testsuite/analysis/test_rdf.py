@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+import numpy as np
+
+import unittest
+
+class TestRadialDistrF(unittest.TestCase):
+    def setUp(self):
+        self.box = np.array([8.0, 9.0, 10.0])
+        self.system = espressopp.System()
+        self.system.rng = espressopp.esutil.RNG()
+        self.system.bc = espressopp.bc.OrthorhombicBC(self.system.rng, self.box)
+        nodeGrid = espressopp.tools.decomp.nodeGrid(MPI.COMM_WORLD.size)
+        cellGrid = espressopp.tools.decomp.cellGrid(self.box, nodeGrid, rc=1.5, skin=0.3)
+        self.system.storage = espressopp.storage.DomainDecomposition(self.system, nodeGrid, cellGrid)
+
+        rng = np.random.RandomState(7)
+        self.pos = rng.uniform(0.0, 1.0, (400, 3)) * self.box
+        self.types = rng.randint(0, 2, 400)
+        particle_list = [(i, int(self.types[i]), espressopp.Real3D(*self.pos[i])) for i in range(400)]
+        self.system.storage.addParticles(particle_list, 'id', 'type', 'pos')
+        self.system.storage.decompose()
+
+    def reference(self, rdfN, rMax, type1=-1, type2=-1):
+        d = self.pos[:, None, :] - self.pos[None, :, :]
+        d -= self.box * np.round(d / self.box)
+        dist = np.sqrt((d * d).sum(axis=2))
+        i, j = np.triu_indices(len(self.pos), 1)
+        if type1 < 0:
+            sel = np.ones(len(i), dtype=bool)
+            n1 = n2 = len(self.pos)
+        else:
+            ti, tj = self.types[i], self.types[j]
+            sel = ((ti == type1) & (tj == type2)) | ((ti == type2) & (tj == type1))
+            n1, n2 = (self.types == type1).sum(), (self.types == type2).sum()
+        dr = rMax / rdfN
+        hist = np.histogram(dist[i, j][sel], bins=rdfN, range=(0.0, rMax))[0].astype(float)
+        pairs = n1 * n2 * (0.5 if type1 == type2 else 1.0)
+        r = (np.arange(rdfN) + 0.5) * dr
+        return hist * self.box.prod() / (pairs * 4.0 * np.pi * dr * (r * r + dr * dr / 12.0))
+
+    def test_total(self):
+        rdf = espressopp.analysis.RadialDistrF(self.system)
+        rdf.print_progress = False
+        g = rdf.compute(40)
+        np.testing.assert_allclose(g, self.reference(40, 4.0), atol=1e-10)
+
+    def test_partial(self):
+        rdf = espressopp.analysis.RadialDistrF(self.system, type1=0, type2=1)
+        rdf.print_progress = False
+        rdf.rMax = 2.5
+        g = rdf.compute(25)
+        np.testing.assert_allclose(g, self.reference(25, 2.5, 0, 1), atol=1e-10)
+
+    def test_accumulate(self):
+        rdf = espressopp.analysis.RadialDistrF(self.system, type1=1, type2=1)
+        rdf.print_progress = False
+        rdf.rMax = 3.0
+        rdf.accumulate(30)
+        rdf.accumulate(30)
+        self.assertEqual(rdf.numFrames, 2)
+        np.testing.assert_allclose(rdf.getAverage(), self.reference(30, 3.0, 1, 1), atol=1e-10)
+        rdf.reset()
+        self.assertEqual(rdf.numFrames, 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+import numpy as np
+
+import unittest
+
+class TestStaticStructF(unittest.TestCase):
+    def setUp(self):
+        self.box = np.array([8.0, 9.0, 10.0])
+        self.system = espressopp.System()
+        self.system.rng = espressopp.esutil.RNG()
+        self.system.bc = espressopp.bc.OrthorhombicBC(self.system.rng, self.box)
+        self.system.skin = 0.3
+        nodeGrid = espressopp.tools.decomp.nodeGrid(MPI.COMM_WORLD.size)
+        cellGrid = espressopp.tools.decomp.cellGrid(self.box, nodeGrid, rc=1.5, skin=0.3)
+        self.system.storage = espressopp.storage.DomainDecomposition(self.system, nodeGrid, cellGrid)
+
+        rng = np.random.RandomState(5)
+        self.pos = rng.uniform(0.0, 1.0, (300, 3)) * self.box
+        particle_list = [(i, espressopp.Real3D(*self.pos[i])) for i in range(300)]
+        self.system.storage.addParticles(particle_list, 'id', 'pos')
+        self.system.storage.decompose()
+
+    def reference(self, nq, bin_factor, chainlength=None):
+        dq = 2.0 * np.pi / self.box
+        h = np.array([(x, y, z) for x in range(-nq[0], nq[0] + 1)
+                      for y in range(-nq[1], nq[1] + 1) for z in range(nq[2] + 1)])
+        q = h * dq
+        phase = np.exp(1j * self.pos.dot(q.T))
+        if chainlength is None:
+            sq = np.abs(phase.sum(axis=0))**2 / len(self.pos)
+        else:
+            chains = phase.reshape(-1, chainlength, len(q)).sum(axis=1)
+            sq = (np.abs(chains)**2).sum(axis=0) / (len(self.pos) * chainlength)
+        qabs = np.sqrt((q * q).sum(axis=1))
+        bins = np.floor(qabs / (bin_factor * dq.min())).astype(int)
+        res = []
+        for b in range(1, bins.max() + 1):
+            sel = bins == b
+            res.append((qabs[sel].mean(), sq[sel].mean()) if sel.any() else (0.0, 0.0))
+        return np.array(res)
+
+    def test_direct(self):
+        sq = espressopp.analysis.StaticStructF(self.system)
+        np.testing.assert_allclose(np.array(sq.compute(3, 4, 5, 1.0)),
+                                   self.reference((3, 4, 5), 1.0), atol=1e-9)
+
+    def test_single_chain(self):
+        sq = espressopp.analysis.StaticStructF(self.system)
+        np.testing.assert_allclose(np.array(sq.computeSingleChain(3, 3, 3, 1.0, 10)),
+                                   self.reference((3, 3, 3), 1.0, 10), atol=1e-9)
+
+    def test_mesh(self):
+        sq = espressopp.analysis.StaticStructF(self.system)
+        result = np.array(sq.compute(3, 4, 5, 1.0, oversampling=4))
+        ref = self.reference((3, 4, 5), 1.0)
+        np.testing.assert_allclose(result[:, 0], ref[:, 0], atol=1e-9)
+        np.testing.assert_allclose(result[:, 1], ref[:, 1], atol=0.02)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+
+import unittest
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp, velocities
+
+rc = 2.5
+skin = 0.3
+# (type1, type2): (epsilon, sigma), so that the tally sums over several potentials
+mixing = {(0, 0): (1.0, 1.0), (0, 1): (1.2, 0.9), (1, 1): (0.8, 0.8)}
+
+def create_mixture():
+    # a binary LJ mixture on a simple cubic lattice, the types alternate along each row
+    n = 6
+    a = 1.1
+    box = (n * a, n * a, n * a)
+
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(1)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    vx, vy, vz = velocities.gaussian(T=0.8, N=n**3, zero_momentum=True, seed=3)
+    particles = []
+    for i in range(n**3):
+        pos = Real3D((i % n + 0.5) * a, (i // n % n + 0.5) * a, (i // n // n + 0.5) * a)
+        particles.append((i, i % 2, pos, Real3D(vx[i], vy[i], vz[i])))
+    system.storage.addParticles(particles, 'id', 'type', 'pos', 'v')
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    for (type1, type2), (epsilon, sigma) in mixing.items():
+        interLJ.setPotential(type1=type1, type2=type2,
+            potential=espressopp.interaction.LennardJones(epsilon, sigma, cutoff=rc, shift='auto'))
+    system.addInteraction(interLJ)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.005
+    integrator.tally = True
+    return system, integrator, interLJ
+
+def observables(system):
+    epot = espressopp.analysis.PotentialEnergy(system, system.getInteraction(0)).compute()
+    pressure = espressopp.analysis.Pressure(system).compute()
+    pressureTensor = espressopp.analysis.PressureTensor(system).compute()
+    return [epot, pressure] + list(pressureTensor)
+
+def separate_passes(system, integrator):
+    # a force pass without tally leaves the analysis to its own loops over the pairs
+    integrator.tally = False
+    integrator.run(0)
+    values = observables(system)
+    integrator.tally = True
+    return values
+
+class TestTally(unittest.TestCase):
+    def test_tally(self):
+        system, integrator, interLJ = create_mixture()
+        self.assertTrue(integrator.tally)
+
+        for nsteps in (0, 10, 25):
+            integrator.run(nsteps)
+            tallied = observables(system)
+            for value, refValue in zip(tallied, separate_passes(system, integrator)):
+                self.assertAlmostEqual(value, refValue, places=10)
+
+    def test_outdated(self):
+        system, integrator, interLJ = create_mixture()
+        integrator.run(10)
+        before = observables(system)
+
+        # a change after run() must not return the tally of the last force pass
+        pos = system.storage.getParticle(0).pos
+        system.storage.modifyParticle(0, 'pos', pos + Real3D(0.1, 0.0, 0.0))
+        after = observables(system)
+        self.assertNotAlmostEqual(after[0], before[0], places=6)
+        for value, refValue in zip(after, separate_passes(system, integrator)):
+            self.assertAlmostEqual(value, refValue, places=10)
+
+        integrator.run(0)
+        before = observables(system)
+        interLJ.setPotential(type1=0, type2=1,
+            potential=espressopp.interaction.LennardJones(1.5, 0.9, cutoff=rc, shift='auto'))
+        after = observables(system)
+        self.assertNotAlmostEqual(after[0], before[0], places=6)
+        for value, refValue in zip(after, separate_passes(system, integrator)):
+            self.assertAlmostEqual(value, refValue, places=10)
+
+
+if __name__ == '__main__':
+    unittest.main()
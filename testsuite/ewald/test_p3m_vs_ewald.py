@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import random
+import unittest
+
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Int3D, Real3D
+
+box = (10.0, 10.0, 10.0)
+alpha = 1.0
+rc = 3.0
+skin = 0.3
+num_particles = 40
+
+
+def charged_particles():
+    rng = random.Random(11)
+    particles = []
+    for pid in range(num_particles):
+        pos = Real3D(*[rng.uniform(0.0, L) for L in box])
+        particles.append([pid, pos, 0, 1.0 if pid % 2 == 0 else -1.0])
+    return particles
+
+
+def kspace_forces(kspace_potential, kspace_interaction):
+    nodeGrid = espressopp.tools.decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc, skin)
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG()
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+    system.storage.addParticles(charged_particles(), 'id', 'pos', 'type', 'q')
+    system.storage.decompose()
+
+    potential = kspace_potential(system)
+    interaction = kspace_interaction(system.storage, potential)
+    system.addInteraction(interaction)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.001
+    integrator.run(0)
+
+    forces = [system.storage.getParticle(pid).f for pid in range(num_particles)]
+    return interaction.computeEnergy(), forces
+
+
+class TestP3MvsEwald(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.energyRef, cls.forcesRef = kspace_forces(
+            lambda system: espressopp.interaction.CoulombKSpaceEwald(system, 1.0, alpha, 15),
+            espressopp.interaction.CellListCoulombKSpaceEwald)
+        cls.forceRms = (sum(f.sqr() for f in cls.forcesRef) / num_particles) ** 0.5
+
+    def compare(self, differentiation):
+        energy, forces = kspace_forces(
+            lambda system: espressopp.interaction.CoulombKSpaceP3M(
+                system, 1.0, alpha, Int3D(32, 32, 32), 7, rc,
+                differentiation=differentiation),
+            espressopp.interaction.CellListCoulombKSpaceP3M)
+        self.assertAlmostEqual(energy / self.energyRef, 1.0, places=3)
+        for f, fRef in zip(forces, self.forcesRef):
+            self.assertLess((f - fRef).abs(), 1e-2 * self.forceRms)
+
+    def test_ik(self):
+        self.compare('ik')
+
+    def test_ad(self):
+        self.compare('ad')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+
+import unittest
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp, velocities
+
+rc = 2.5
+skin = 0.1
+
+def create_hot_gas():
+    # a dilute, hot LJ gas, so that the particles cross the small skin often
+    n = 7
+    a = 1.3
+    box = (n * a, n * a, n * a)
+
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(4)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    vx, vy, vz = velocities.gaussian(T=3.0, N=n**3, zero_momentum=True, seed=11)
+    particles = []
+    for i in range(n**3):
+        pos = Real3D((i % n + 0.5) * a, (i // n % n + 0.5) * a, (i // n // n + 0.5) * a)
+        particles.append((i, pos, Real3D(vx[i], vy[i], vz[i])))
+    system.storage.addParticles(particles, 'id', 'pos', 'v')
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    interLJ.setPotential(type1=0, type2=0,
+                         potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+    system.addInteraction(interLJ)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.005
+    return system, integrator, vl, n**3
+
+def pairs_within_cutoff(system, numParticles):
+    box = system.bc.boxL
+    pos = [system.storage.getParticle(pid).pos for pid in range(numParticles)]
+    pairs = set()
+    for i in range(numParticles):
+        for j in range(i + 1, numParticles):
+            d = [pos[i][k] - pos[j][k] for k in range(3)]
+            d = [dk - box[k] * round(dk / box[k]) for k, dk in enumerate(d)]
+            if sum(dk * dk for dk in d) < rc * rc:
+                pairs.add((i, j))
+    return pairs
+
+class TestVerletListRebuild(unittest.TestCase):
+    def test_rebuild(self):
+        system, integrator, vl, numParticles = create_hot_gas()
+        integrator.run(100)
+
+        timers = integrator.getTimers()
+        self.assertEqual(len(timers[0]), 11)
+        numRebuilds = integrator.getNumResorts()
+        self.assertEqual(timers[0][10], numRebuilds)
+        self.assertGreater(numRebuilds, 0)
+
+        # rebuilding only when a particle has moved half the skin misses no pair
+        listed = set(tuple(sorted(pair)) for rank in vl.getAllPairs() for pair in rank)
+        missing = pairs_within_cutoff(system, numParticles) - listed
+        self.assertEqual(missing, set())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import json
+import os
+import random
+import subprocess
+import sys
+import unittest
+
+n = 6
+spacing = 1.1
+rc = 2.5
+skin = 0.2
+
+
+def run_and_dump():
+    """Integrate a perturbed LJ crystal through several list rebuilds and print the final
+    pair list and forces as JSON."""
+    import mpi4py.MPI as MPI
+    import espressopp
+    from espressopp import Real3D
+    from espressopp.tools import decomp
+
+    box = (n * spacing, n * spacing, n * spacing)
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(3)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    rng = random.Random(5)
+    particles = []
+    for i in range(n**3):
+        pos = Real3D(*[(k + 0.5 + rng.uniform(-0.05, 0.05)) * spacing
+                       for k in (i % n, i // n % n, i // n // n)])
+        v = Real3D(*[rng.gauss(0.0, 1.0) for _ in range(3)])
+        particles.append((i, pos, v))
+    system.storage.addParticles(particles, 'id', 'pos', 'v')
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    interLJ.setPotential(type1=0, type2=0,
+                         potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+    system.addInteraction(interLJ)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.005
+    integrator.run(200)
+
+    pairs = sorted(sorted(pair) for rank in vl.getAllPairs() for pair in rank)
+    forces = []
+    for pid in range(n**3):
+        f = system.storage.getParticle(pid).f
+        forces.append([f[0], f[1], f[2]])
+    print(json.dumps({'builds': vl.builds, 'pairs': pairs, 'forces': forces}))
+
+
+class TestVerletListThreads(unittest.TestCase):
+    def run_with(self, **env):
+        out = subprocess.check_output([sys.executable, __file__, '--dump'],
+                                      env=dict(os.environ, **env))
+        return json.loads(out.decode().strip().splitlines()[-1])
+
+    def compare(self, result, ref):
+        self.assertEqual(result['builds'], ref['builds'])
+        self.assertEqual(result['pairs'], ref['pairs'])
+        for f, fRef in zip(result['forces'], ref['forces']):
+            for fk, fRefk in zip(f, fRef):
+                self.assertAlmostEqual(fk, fRefk, places=6)
+
+    def test_threads(self):
+        ref = self.run_with(OMP_NUM_THREADS='1')
+        self.assertGreater(ref['builds'], 1)
+        self.compare(self.run_with(OMP_NUM_THREADS='4'), ref)
+        # a dynamic team may get fewer threads than requested between rebuilds
+        self.compare(self.run_with(OMP_NUM_THREADS='4', OMP_DYNAMIC='true'), ref)
+
+
+if __name__ == '__main__':
+    if '--dump' in sys.argv:
+        run_and_dump()
+    else:
+        unittest.main()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+
+import unittest
+import random
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp
+
+rc = 2.5
+skin = 0.3
+box = (8.0, 8.0, 8.0)
+
+def create_system():
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(42)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    # a jittered lattice of particles of two types with alternating charges
+    rng = random.Random(7)
+    particles = []
+    n = 6
+    for i in range(n**3):
+        pos = Real3D(*[(c + 0.5 + rng.uniform(-0.2, 0.2)) * box[0] / n
+                       for c in (i % n, i // n % n, i // n // n)])
+        particles.append((i, i % 2, pos, 1.0 if i % 2 else -1.0))
+    system.storage.addParticles(particles, 'id', 'type', 'pos', 'q')
+    system.storage.decompose()
+    return system, espressopp.VerletList(system, cutoff=rc)
+
+def forces(system):
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.001
+    integrator.run(0)
+    return [system.storage.getParticle(pid).f for pid in range(6**3)]
+
+class TestVerletListMultiInteraction(unittest.TestCase):
+    def test_lj_coulomb(self):
+        ljs = {(0, 0): espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc),
+               (0, 1): espressopp.interaction.LennardJones(0.5, 1.1, cutoff=rc)}
+        coulomb = espressopp.interaction.CoulombRSpace(1.0, 1.2, rc)
+
+        # one interaction per potential
+        ref, vl = create_system()
+        interLJ = espressopp.interaction.VerletListLennardJones(vl)
+        interC = espressopp.interaction.VerletListCoulombRSpace(vl)
+        for (t1, t2), lj in ljs.items():
+            interLJ.setPotential(type1=t1, type2=t2, potential=lj)
+        for t1, t2 in ((0, 0), (0, 1), (1, 1)):
+            interC.setPotential(type1=t1, type2=t2, potential=coulomb)
+        ref.addInteraction(interLJ)
+        ref.addInteraction(interC)
+        eRef = interLJ.computeEnergy() + interC.computeEnergy()
+        fRef = forces(ref)
+
+        # both in one loop, no Lennard-Jones between the particles of type 1
+        system, vl = create_system()
+        inter = espressopp.interaction.VerletListLennardJonesCoulombRSpace(vl)
+        for (t1, t2), lj in ljs.items():
+            inter.setPotential1(t1, t2, lj)
+        for t1, t2 in ((0, 0), (0, 1), (1, 1)):
+            inter.setPotential2(t1, t2, coulomb)
+        system.addInteraction(inter)
+        self.assertAlmostEqual(inter.computeEnergy() / eRef, 1.0, places=10)
+        self.assertAlmostEqual(system.maxCutoff, ref.maxCutoff, places=10)
+
+        for f, fr in zip(forces(system), fRef):
+            for d in range(3):
+                self.assertAlmostEqual(f[d], fr[d], places=8)
+
+
+if __name__ == '__main__':
+    unittest.main()
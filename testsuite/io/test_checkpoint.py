@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import h5py
+import mpi4py.MPI as MPI
+import numpy as np
+import unittest
+
+from espressopp.tools import decomp
+
+
+def create_system():
+    """LJ system with harmonic bonds, Langevin thermostat and barostat, without particles"""
+    n, a, rc, skin = 5, 1.2, 2.5, 0.3
+    box = (n * a, n * a, n * a)
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(17)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    interLJ.setPotential(type1=0, type2=0,
+                         potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc, shift='auto'))
+    system.addInteraction(interLJ)
+
+    fpl = espressopp.FixedPairList(system.storage)
+    interBond = espressopp.interaction.FixedPairListHarmonic(
+        system, fpl, espressopp.interaction.Harmonic(K=10.0, r0=a))
+    system.addInteraction(interBond)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.005
+    thermostat = espressopp.integrator.LangevinThermostat(system)
+    thermostat.gamma = 1.0
+    thermostat.temperature = 1.0
+    integrator.addExtension(thermostat)
+    barostat = espressopp.integrator.LangevinBarostat(system, system.rng, 1.0)
+    barostat.gammaP = 0.5
+    barostat.pressure = 1.0
+    barostat.mass = 100.0
+    integrator.addExtension(barostat)
+    return system, integrator, fpl, barostat, n, a
+
+
+def positions(system, num):
+    return np.array([list(system.storage.getParticle(pid).pos) for pid in range(num)])
+
+
+class TestCheckpoint(unittest.TestCase):
+    def test_restart(self):
+        system, integrator, fpl, barostat, n, a = create_system()
+        particles = [(i, espressopp.Real3D((i % n + 0.5) * a, (i // n % n + 0.5) * a,
+                                           (i // n // n + 0.5) * a)) for i in range(n**3)]
+        system.storage.addParticles(particles, 'id', 'pos')
+        system.storage.decompose()
+        fpl.addBonds([(i, i + 1) for i in range(n**3) if i % n != n - 1])
+
+        integrator.run(50)
+        checkpoint = espressopp.io.Checkpoint(system, integrator, 'checkpoint.h5')
+        checkpoint.addPairs(fpl, 'bonds')
+        checkpoint.addObject('barostat', barostat, ['momentum'])
+        checkpoint.write()
+        integrator.run(50)
+        reference = positions(system, n**3)
+        referenceBox = list(system.bc.boxL)
+
+        with h5py.File('checkpoint.h5', 'r') as h5:
+            self.assertEqual(h5['/checkpoint'].attrs['step'], 50)
+            self.assertEqual(h5['/connectivity/bonds'].shape, (n * n * (n - 1), 2))
+
+        system, integrator, fpl, barostat, n, a = create_system()
+        checkpoint = espressopp.io.Checkpoint(system, integrator, 'checkpoint.h5')
+        checkpoint.addPairs(fpl, 'bonds')
+        checkpoint.addObject('barostat', barostat, ['momentum'])
+        checkpoint.restore()
+        self.assertEqual(integrator.step, 50)
+        self.assertEqual(fpl.totalSize(), n * n * (n - 1))
+        integrator.run(50)
+
+        np.testing.assert_allclose(list(system.bc.boxL), referenceBox, rtol=1e-12)
+        np.testing.assert_allclose(positions(system, n**3), reference, rtol=1e-12)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -21,6 +21,7 @@
 
 import espressopp
 import h5py
+import numpy as np
 import subprocess
 import unittest
 
@@ -85,6 +86,50 @@ class TestH5MD(unittest.TestCase):
 
         self.compare_hdf5_structure('reference.h5', 'dump2.h5')
 
+    def test_restore_connectivity(self):
+        n = 30
+        rng = np.random.RandomState(3)
+        pos = rng.uniform(0.0, 10.0, (n, 3))
+        vel = rng.normal(0.0, 1.0, (n, 3))
+        ids = rng.permutation(n) + 1
+        pairs = np.array([(ids[i], ids[i + 1]) for i in range(n - 1)] + [(-1, -1)] * 3)
+        triples = np.array([(ids[i], ids[i + 1], ids[i + 2]) for i in range(n - 2)])
+        quadruples = np.array([(ids[i], ids[i + 1], ids[i + 2], ids[i + 3]) for i in range(n - 3)])
+        with h5py.File('connectivity.h5', 'w') as f:
+            atoms = f.create_group('particles/atoms')
+            atoms['id/value'] = ids.reshape(1, n)
+            atoms['type/value'] = (ids % 2).reshape(1, n)
+            atoms['mass/value'] = np.full((1, n), 2.0)
+            atoms['charge/value'] = np.zeros((1, n))
+            atoms['position/value'] = pos.reshape(1, n, 3)
+            atoms['velocity/value'] = vel.reshape(1, n, 3)
+            atoms['force/value'] = np.zeros((1, n, 3))
+            f['connectivity/bonds'] = pairs
+            f['connectivity/angles/value'] = triples.reshape(1, -1, 3)
+            f['connectivity/dihedrals'] = quadruples
+
+        self.system, self.integrator = espressopp.standard_system.Default((10., 10., 10.))
+        restore = espressopp.io.RestoreH5MDParallel(self.system, 'connectivity.h5')
+        restore.restore()
+        fpl = espressopp.FixedPairList(self.system.storage)
+        ftl = espressopp.FixedTripleList(self.system.storage)
+        fql = espressopp.FixedQuadrupleList(self.system.storage)
+        restore.restorePairs(fpl, 'bonds')
+        restore.restoreTriples(ftl, 'angles')
+        restore.restoreQuadruples(fql, 'dihedrals')
+
+        for i in range(n):
+            p = self.system.storage.getParticle(int(ids[i]))
+            np.testing.assert_allclose(list(p.pos), pos[i])
+            np.testing.assert_allclose(list(p.v), vel[i])
+            self.assertEqual(p.type, ids[i] % 2)
+            self.assertEqual(p.mass, 2.0)
+
+        bonds = sorted(tuple(b) for b in sum(fpl.getBonds(), []))
+        self.assertEqual(bonds, sorted((min(a, b), max(a, b)) for a, b in pairs[:n - 1]))
+        self.assertEqual(sorted(sum(ftl.getTriples(), [])), sorted(map(tuple, triples)))
+        self.assertEqual(sorted(sum(fql.getQuadruples(), [])), sorted(map(tuple, quadruples)))
+
 
 if __name__ == '__main__':
     unittest.main()
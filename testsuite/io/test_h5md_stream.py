@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import espressopp
+import h5py
+import numpy as np
+import unittest
+
+
+class TestH5MDStream(unittest.TestCase):
+    def setUp(self):
+        self.system, self.integrator = espressopp.standard_system.Default((10., 10., 10.))
+        self.system.rng = espressopp.esutil.RNG(42)
+        self.positions = {}
+        for pid in range(34):
+            pos = self.system.bc.getRandomPos()
+            self.system.storage.addParticle(pid, pos)
+            self.positions[pid] = pos
+        self.system.storage.decompose()
+
+    def test_frames(self):
+        traj = espressopp.io.DumpH5MDStream(self.system, self.integrator, 'stream.h5',
+                                            compression=4)
+        for _ in range(3):
+            traj.dump()
+            self.integrator.step += 10
+        traj.close()
+
+        with h5py.File('stream.h5', 'r') as f:
+            atoms = f['particles/atoms']
+            self.assertTupleEqual(atoms['position/value'].shape, (3, 34, 3))
+            self.assertTupleEqual(atoms['mass/value'].shape, (3, 34))
+            self.assertTupleEqual(atoms['box/edges/value'].shape, (3, 3))
+            self.assertListEqual(list(atoms['position/step']), [0, 10, 20])
+            self.assertListEqual(list(atoms['id/value'][0]), list(range(34)))
+            for pid in range(34):
+                np.testing.assert_allclose(atoms['position/value'][2, pid],
+                                           list(self.positions[pid]))
+            self.assertNotIn('force', atoms)
+
+    def test_append(self):
+        traj = espressopp.io.DumpH5MDStream(self.system, self.integrator, 'append.h5')
+        traj.dump()
+        traj.close()
+        self.integrator.step = 5
+        traj.dump()
+        traj.close()
+
+        traj = espressopp.io.DumpH5MDStream(self.system, self.integrator, 'append.h5',
+                                            append=True)
+        self.integrator.step = 7
+        traj.dump()
+        traj.close()
+
+        with h5py.File('append.h5', 'r') as f:
+            self.assertListEqual(list(f['particles/atoms/velocity/step']), [0, 5, 7])
+            self.assertTupleEqual(f['particles/atoms/velocity/value'].shape, (3, 34, 3))
+
+    def test_write_error(self):
+        traj = espressopp.io.DumpH5MDStream(self.system, self.integrator,
+                                            'no_such_directory/stream.h5')
+        # raised by the failing dump() itself or, with the background thread, by a later call
+        with self.assertRaises(RuntimeError):
+            traj.dump()
+            traj.dump()
+            traj.close()
+        traj.close()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+from espressopp import Int3D
+from espressopp import Real3D
+
+import unittest
+
+Nx = 16
+Ny = Nz = 8
+runSteps = 50
+
+def create_lb(overlapHalo):
+    system, integrator = espressopp.standard_system.LennardJones(0, box=(Nx, Ny, Nz))
+    nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size)
+
+    # an athermal fluid with a sine wave of the velocity, so that the result is deterministic
+    lb = espressopp.integrator.LatticeBoltzmann(system, nodeGrid)
+    lb.overlapHalo = overlapHalo
+    integrator.addExtension(lb)
+    initPop = espressopp.integrator.LBInitPopWave(system, lb)
+    initPop.createDenVel(1.0, Real3D(0., 0., 0.1))
+    return integrator, lb
+
+class TestLBHaloOverlap(unittest.TestCase):
+    def test_overlap(self):
+        refIntegrator, ref = create_lb(False)
+        integrator, lb = create_lb(True)
+        refIntegrator.run(runSteps)
+        integrator.run(runSteps)
+
+        # hiding the halo exchange behind the interior gives the same moments as the plain
+        # collide-stream of the whole lattice followed by the halo exchange
+        halo = 1
+        myNi = lb.getMyNi
+        for i in range(halo, myNi[0] - halo):
+            for j in range(halo, myNi[1] - halo):
+                for k in range(halo, myNi[2] - halo):
+                    for mom in range(4):
+                        self.assertAlmostEqual(lb.getLBMom(Int3D(i, j, k), mom),
+                                               ref.getLBMom(Int3D(i, j, k), mom), places=12)
+
+        # the timers count the LB steps of all runs until they are reset explicitly
+        timers = lb.getTimers()[0]
+        self.assertEqual(timers[4], runSteps)
+        integrator.run(runSteps)
+        self.assertEqual(lb.getTimers()[0][4], 2 * runSteps)
+        lb.resetTimers()
+        self.assertEqual(lb.getTimers()[0][4], 0)
+
+if __name__ == '__main__':
+    unittest.main()
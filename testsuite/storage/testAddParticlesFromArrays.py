@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+import unittest
+import numpy as np
+from mpi4py import MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp
+
+N = 2000
+L = 12.0
+
+def generate_system():
+    rc = 2.5
+    skin = 0.3
+    size = (L, L, L)
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG()
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, size)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, size, rc, skin)
+    cellGrid = decomp.cellGrid(size, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+    return system
+
+def generate_arrays():
+    rng = np.random.RandomState(3)
+    return {'id': np.arange(1, N + 1),
+            # some particles outside of the box, which are folded
+            'pos': rng.uniform(-0.5 * L, 1.5 * L, (N, 3)),
+            'v': rng.normal(size=(N, 3)),
+            'type': rng.randint(0, 3, N),
+            'mass': rng.uniform(1.0, 2.0, N),
+            'q': rng.choice([-1.0, 1.0], N)}
+
+def gather(system):
+    conf = espressopp.analysis.Configurations(system, pos=True, vel=True)
+    conf.gather()
+    c = conf[0]
+    ids = sorted(c.getIds())
+    return np.array([list(c.getCoordinates(i)) + list(c.getVelocities(i)) for i in ids])
+
+class TestAddParticlesFromArrays(unittest.TestCase):
+
+    def test_same_as_addParticles(self):
+        a = generate_arrays()
+
+        system0 = generate_system()
+        system0.storage.addParticles([[int(a['id'][i]), Real3D(*a['pos'][i]), Real3D(*a['v'][i]),
+                                       int(a['type'][i]), a['mass'][i], a['q'][i]]
+                                      for i in range(N)], 'id', 'pos', 'v', 'type', 'mass', 'q')
+        system0.storage.decompose()
+
+        system1 = generate_system()
+        self.assertEqual(system1.storage.addParticlesFromArrays(a), N)
+        system1.storage.decompose()
+
+        np.testing.assert_allclose(gather(system1), gather(system0), rtol=0.0, atol=1e-12)
+        for pid in (1, N // 2, N):
+            p0 = system0.storage.getParticle(pid)
+            p1 = system1.storage.getParticle(pid)
+            self.assertEqual(p1.type, p0.type)
+            self.assertEqual(p1.mass, p0.mass)
+            self.assertEqual(p1.q, p0.q)
+
+    def test_duplicates(self):
+        a = generate_arrays()
+        system = generate_system()
+        self.assertEqual(system.storage.addParticlesFromArrays(a), N)
+        system.storage.decompose()
+
+        # an existing id
+        b = {'id': np.array([N + 1, 5]), 'pos': np.zeros((2, 3))}
+        self.assertEqual(system.storage.addParticlesFromArrays(b), 0)
+        # an id given twice
+        b = {'id': np.array([N + 1, N + 1]), 'pos': np.zeros((2, 3))}
+        self.assertEqual(system.storage.addParticlesFromArrays(b), 0)
+
+        b = {'id': np.array([N + 1, N + 2]), 'pos': np.zeros((2, 3))}
+        self.assertEqual(system.storage.addParticlesFromArrays(b), 2)
+
+    def test_invalid(self):
+        system = generate_system()
+        with self.assertRaises(RuntimeError):
+            system.storage.addParticlesFromArrays({'id': np.arange(3), 'pos': np.zeros(3)})
+        with self.assertRaises(RuntimeError):
+            system.storage.addParticlesFromArrays({'id': np.arange(3), 'pos': np.zeros((3, 3)),
+                                                   'velocity': np.zeros((3, 3))})
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+
+import unittest
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp, velocities
+
+rc = 2.5
+skin = 0.3
+
+def create_system(storage):
+    a = 1.1
+    n = 8
+    box = (n * a, n * a, n * a)
+
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(42)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = storage(system, nodeGrid, cellGrid)
+
+    vx, vy, vz = velocities.gaussian(T=1.0, N=n**3, zero_momentum=True, seed=7)
+    particles = []
+    for i in range(n**3):
+        pos = Real3D((i % n + 0.5) * a, (i // n % n + 0.5) * a, (i // n // n + 0.5) * a)
+        particles.append((i, pos, Real3D(vx[i], vy[i], vz[i])))
+    system.storage.addParticles(particles, 'id', 'pos', 'v')
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    interLJ.setPotential(type1=0, type2=0,
+                         potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc, shift='auto'))
+    system.addInteraction(interLJ)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.005
+    return system, integrator
+
+class TestDomainDecompositionNonBlocking(unittest.TestCase):
+    def test_trajectory(self):
+        """the 26 neighbor ghost exchange gives the trajectory of DomainDecomposition"""
+        ref, refIntegrator = create_system(espressopp.storage.DomainDecomposition)
+        system, integrator = create_system(espressopp.storage.DomainDecompositionNonBlocking)
+        refIntegrator.run(200)
+        integrator.run(200)
+
+        self.assertEqual(int(espressopp.analysis.NPart(system).compute()), 512)
+        epot = espressopp.analysis.PotentialEnergy(system, system.getInteraction(0)).compute()
+        epotRef = espressopp.analysis.PotentialEnergy(ref, ref.getInteraction(0)).compute()
+        self.assertAlmostEqual(epot / epotRef, 1.0, places=8)
+        for pid in (0, 100, 511):
+            pos = system.storage.getParticle(pid).pos
+            posRef = ref.storage.getParticle(pid).pos
+            for i in range(3):
+                self.assertAlmostEqual(pos[i], posRef[i], places=8)
+
+
+if __name__ == '__main__':
+    unittest.main()
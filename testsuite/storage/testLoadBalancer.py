@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import unittest
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp
+
+rc = 2.5
+skin = 0.3
+n = 8
+
+def create_slab():
+    # a cold, dense slab in the first third of the box along x, the rest is empty,
+    # so that all the force work lies on the CPUs of the first node layer
+    a = 1.1
+    box = (3 * n * a, n * a, n * a)
+
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(8)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    particles = []
+    for i in range(n**3):
+        pos = Real3D((i % n + 0.5) * a, (i // n % n + 0.5) * a, (i // n // n + 0.5) * a)
+        particles.append((i, pos))
+    system.storage.addParticles(particles, 'id', 'pos')
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    interLJ.setPotential(type1=0, type2=0,
+                         potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+    system.addInteraction(interLJ)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.002
+    return system, integrator, cellGrid
+
+class TestLoadBalancer(unittest.TestCase):
+    def test_balance(self):
+        system, integrator, cellGrid = create_slab()
+        # an infinite threshold only measures the imbalance
+        lb = espressopp.integrator.LoadBalancer(system, interval=10, threshold=float('inf'))
+        integrator.addExtension(lb)
+        integrator.run(20)
+        imbalanceBefore = lb.imbalance
+        self.assertEqual(lb.numRebalances, 0)
+
+        lb.threshold = 1.0
+        integrator.run(100)
+        lb.threshold = float('inf')
+        integrator.run(20)
+        imbalanceAfter = lb.imbalance
+
+        nodeGrid = system.storage.getNodeGrid()
+        if nodeGrid[0] > 1:
+            # the borders moved towards the slab and spread its work over the CPUs
+            self.assertGreater(lb.numRebalances, 0)
+            self.assertLess(imbalanceAfter, imbalanceBefore)
+        allBorders = system.storage.getCellBorders()
+        for axis in range(3):
+            borders = allBorders[axis]
+            self.assertEqual(len(borders), nodeGrid[axis] + 1)
+            self.assertEqual(borders[0], 0)
+            self.assertEqual(borders[-1], nodeGrid[axis] * cellGrid[axis])
+            self.assertTrue(all(b < c for b, c in zip(borders[:-1], borders[1:])))
+
+        # no particle is lost when it migrates to its new CPU
+        self.assertEqual(int(espressopp.analysis.NPart(system).compute()), n**3)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import unittest
+import numpy as np
+from mpi4py import MPI
+import espressopp
+from espressopp.tools import decomp
+
+N = 1000
+L = 10.0
+
+
+class TestParticleArrays(unittest.TestCase):
+
+    def setUp(self):
+        rc, skin = 2.5, 0.3
+        size = (L, L, L)
+        system = espressopp.System()
+        system.rng = espressopp.esutil.RNG()
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, size)
+        system.skin = skin
+        nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, size, rc, skin)
+        cellGrid = decomp.cellGrid(size, nodeGrid, rc, skin)
+        system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+        rng = np.random.RandomState(5)
+        self.arrays = {'id': rng.permutation(N) + 1,
+                       'pos': rng.uniform(0.0, L, (N, 3)),
+                       'image': rng.randint(-2, 3, (N, 3)),
+                       'v': rng.normal(size=(N, 3)),
+                       'f': rng.normal(size=(N, 3)),
+                       'type': rng.randint(0, 3, N),
+                       'mass': rng.uniform(1.0, 2.0, N),
+                       'q': rng.choice([-1.0, 1.0], N)}
+        system.storage.addParticlesFromArrays(self.arrays)
+        system.storage.decompose()
+        self.system = system
+
+    def check(self, arrays):
+        order = np.argsort(self.arrays['id'])
+        self.assertEqual(set(arrays.keys()), set(self.arrays.keys()))
+        for name, expected in self.arrays.items():
+            np.testing.assert_array_equal(arrays[name], expected[order], err_msg=name)
+
+    def test_gather(self):
+        arrays = self.system.storage.gatherArrays()
+        self.assertEqual(arrays['pos'].shape, (N, 3))
+        self.assertEqual(arrays['id'].shape, (N,))
+        self.check(arrays)
+
+    def test_local(self):
+        local = self.system.storage.getLocalArrays()
+        self.assertEqual(sum(len(a['id']) for a in local), N)
+        arrays = dict((name, np.concatenate([a[name] for a in local])) for name in local[0])
+        order = np.argsort(arrays['id'])
+        self.check(dict((name, a[order]) for name, a in arrays.items()))
+
+
+if __name__ == '__main__':
+    unittest.main()
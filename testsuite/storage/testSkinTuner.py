@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+
+import random
+import unittest
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp import Real3D
+from espressopp.tools import decomp, lattice
+
+rc = 2.5
+numParticles = 512
+
+def create_liquid(skin):
+    # a dense LJ liquid from a perturbed lattice, started at rest
+    rng = random.Random(2)
+    x, y, z, Lx, Ly, Lz = lattice.createCubic(numParticles, rho=0.8, perfect=False, RNG=rng.random)
+    box = (Lx, Ly, Lz)
+
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(5)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = skin
+    nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+    cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    particles = [(i, Real3D(x[i], y[i], z[i])) for i in range(numParticles)]
+    system.storage.addParticles(particles, 'id', 'pos')
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    interLJ = espressopp.interaction.VerletListLennardJones(vl)
+    interLJ.setPotential(type1=0, type2=0,
+                         potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+    system.addInteraction(interLJ)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.002
+    return system, integrator
+
+class TestSkinTuner(unittest.TestCase):
+    def test_tune(self):
+        ref, refIntegrator = create_liquid(0.3)
+        system, integrator = create_liquid(0.3)
+        tuner = espressopp.integrator.SkinTuner(system, interval=10, minSkin=0.1, maxSkin=0.8,
+                                                precision=0.1)
+        integrator.addExtension(tuner)
+        refIntegrator.run(200)
+        integrator.run(200)
+
+        self.assertTrue(tuner.converged)
+        self.assertGreaterEqual(system.skin, tuner.minSkin)
+        self.assertLessEqual(system.skin, tuner.maxSkin)
+        history = tuner.getHistory()
+        self.assertGreater(len(history), 2)
+        for skin, cellGrid, time in history:
+            self.assertGreater(time, 0.0)
+
+        # the skin only changes the performance, not the trajectory
+        for pid in range(numParticles):
+            pos = system.storage.getParticle(pid).pos
+            refPos = ref.storage.getParticle(pid).pos
+            for k in range(3):
+                self.assertAlmostEqual(pos[k], refPos[k], places=6)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import unittest
+import numpy as np
+import mpi4py.MPI as MPI
+import espressopp
+from espressopp.tools import decomp
+
+
+class TestVecParticleArrays(unittest.TestCase):
+    def test_arrays(self):
+        box = (8.0, 8.0, 8.0)
+        rc, skin = 1.5, 0.3
+        system = espressopp.System()
+        system.rng = espressopp.esutil.RNG()
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = skin
+        nodeGrid = decomp.nodeGrid(MPI.COMM_WORLD.size, box, rc, skin)
+        cellGrid = decomp.cellGrid(box, nodeGrid, rc, skin)
+        system.vectorization = espressopp.vec.Vectorization(system)
+        system.storage = espressopp.vec.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+        rng = np.random.RandomState(11)
+        n = 200
+        pos = rng.uniform(0.0, 8.0, (n, 3))
+        system.storage.addParticlesFromArrays({'id': np.arange(n), 'pos': pos,
+                                               'type': rng.randint(0, 2, n)})
+        system.storage.decompose()
+        integrator = espressopp.vec.integrator.VelocityVerlet(system)
+        integrator.dt = 0.0
+        integrator.run(1)
+
+        arrays = system.vectorization.getParticleArrays()
+        ids = np.concatenate([a['id'][a['real']] for a in arrays])
+        self.assertEqual(sorted(ids), list(range(n)))
+        for a in arrays:
+            real = a['real']
+            xyz = np.stack([a['p_x'][real], a['p_y'][real], a['p_z'][real]], axis=1)
+            np.testing.assert_array_equal(xyz, pos[a['id'][real].astype(int)])
+            self.assertEqual(len(a['p_x']), len(real))
+
+        # copies by default, so that a later resort cannot leave them dangling
+        again = system.vectorization.getParticleArrays()
+        views = system.vectorization.getParticleArrays(copy=False)
+        viewsAgain = system.vectorization.getParticleArrays(copy=False)
+        if MPI.COMM_WORLD.size == 1:
+            self.assertFalse(np.shares_memory(arrays[0]['p_x'], again[0]['p_x']))
+            self.assertTrue(np.shares_memory(views[0]['p_x'], viewsAgain[0]['p_x']))
+        for a, v in zip(arrays, views):
+            np.testing.assert_array_equal(a['p_x'], v['p_x'])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import tempfile
+import unittest
+
+import numpy as np
+import espressopp
+
+L = 7.0
+RC = 2.5
+
+def positions():
+    # jittered simple cubic lattice, two types and alternating charges
+    rng = np.random.RandomState(11)
+    g = np.arange(5) * L / 5
+    x = np.array(np.meshgrid(g, g, g, indexing='ij')).reshape(3, -1).T
+    return x + rng.uniform(-0.2, 0.2, x.shape)
+
+def setup(use_vec, build):
+    if use_vec:
+        Default = espressopp.vec.standard_system.Default
+    else:
+        Default = espressopp.standard_system.Default
+    system, integrator = Default(box=(L, L, L), rc=RC, skin=0.3, dt=0.001)
+    x = positions()
+    particles = [(i, i % 2, 1.0, 1.0 - 2.0 * (i % 2), espressopp.Real3D(*x[i]))
+                 for i in range(len(x))]
+    system.storage.addParticles(particles, 'id', 'type', 'mass', 'q', 'pos')
+    system.storage.decompose()
+    inter = build(system, use_vec)
+    system.addInteraction(inter)
+    integrator.run(0)
+    conf = espressopp.analysis.Configurations(system, pos=False, force=True)
+    conf.gather()
+    forces = np.array([list(conf[0][i]) for i in range(len(x))])
+    return inter.computeEnergy(), forces
+
+def verletList(system, use_vec):
+    return (espressopp.vec.VerletList if use_vec else espressopp.VerletList)(system, cutoff=RC)
+
+def pairs(system, use_vec, interaction, potentials):
+    mod = espressopp.vec.interaction if use_vec else espressopp.interaction
+    inter = getattr(mod, interaction)(verletList(system, use_vec))
+    for (t1, t2), pot in potentials.items():
+        inter.setPotential(type1=t1, type2=t2, potential=pot)
+    return inter
+
+def bonded(system, use_vec, interaction, listType, add, tuples, potential):
+    vec = espressopp.vec if use_vec else espressopp
+    mod = espressopp.vec.interaction if use_vec else espressopp.interaction
+    fl = getattr(vec, listType)(system.storage)
+    getattr(fl, add)(tuples)
+    return getattr(mod, interaction)(system, fl, potential)
+
+class TestVecPotentials(unittest.TestCase):
+
+    def compare(self, build, places=6):
+        e0, f0 = setup(True, build)
+        e1, f1 = setup(False, build)
+        self.assertAlmostEqual(e0, e1, places)
+        np.testing.assert_allclose(f0, f1, atol=10.0 ** -places)
+
+    def test_morse(self):
+        pots = {(0, 0): espressopp.interaction.Morse(epsilon=1.0, alpha=2.0, rMin=1.2, cutoff=RC),
+                (0, 1): espressopp.interaction.Morse(epsilon=0.5, alpha=1.5, rMin=1.0, cutoff=RC),
+                (1, 1): espressopp.interaction.Morse(epsilon=2.0, alpha=1.0, rMin=1.4, cutoff=RC)}
+        self.compare(lambda s, v: pairs(s, v, 'VerletListMorse', pots))
+
+    def test_tabulated(self):
+        r = np.linspace(0.05, RC, 400)
+        with tempfile.TemporaryDirectory() as d:
+            name = os.path.join(d, 'table.tab')
+            np.savetxt(name, np.c_[r, 4.0 * (r**-12 - r**-6), 4.0 * (12.0 * r**-13 - 6.0 * r**-7)])
+            for itype in (1, 2, 3):
+                pots = {(0, 0): espressopp.interaction.Tabulated(itype, name, cutoff=RC),
+                        (1, 1): espressopp.interaction.Tabulated(itype, name, cutoff=2.0)}
+                self.compare(lambda s, v: pairs(s, v, 'VerletListTabulated', pots))
+                pot = espressopp.interaction.Tabulated(itype, name, cutoff=RC)
+                bonds = [(i, i + 1) for i in range(0, 124, 2)]
+                self.compare(lambda s, v: bonded(s, v, 'FixedPairListTabulated', 'FixedPairList',
+                                                 'addBonds', bonds, pot))
+
+    def test_reaction_field(self):
+        pot = espressopp.interaction.ReactionFieldGeneralized(prefactor=1.0, kappa=0.5,
+                                                              epsilon1=1.0, epsilon2=80.0,
+                                                              cutoff=RC)
+        self.compare(lambda s, v: pairs(s, v, 'VerletListReactionFieldGeneralized',
+                                        {(0, 0): pot, (0, 1): pot, (1, 1): pot}))
+
+    def test_coulomb_rspace(self):
+        # the standard Verlet list interaction does not apply the cutoff, so alpha is chosen
+        # large enough that the pairs within the skin do not contribute
+        pot = espressopp.interaction.CoulombRSpace(prefactor=1.0, alpha=2.0, cutoff=RC)
+        self.compare(lambda s, v: pairs(s, v, 'VerletListCoulombRSpace',
+                                        {(0, 0): pot, (0, 1): pot, (1, 1): pot}), places=5)
+
+    def test_bonded(self):
+        bonds = [(i, i + 1) for i in range(0, 124, 2)]
+        triples = [(i, i + 1, i + 2) for i in range(0, 123, 3)]
+        quadruples = [(i, i + 1, i + 2, i + 3) for i in range(0, 121, 4)]
+        I = espressopp.interaction
+        self.compare(lambda s, v: bonded(s, v, 'FixedPairListHarmonic', 'FixedPairList', 'addBonds',
+                                         bonds, I.Harmonic(K=10.0, r0=1.0)))
+        for name, pot in [('FixedTripleListAngularHarmonic', I.AngularHarmonic(K=5.0, theta0=2.0)),
+                          ('FixedTripleListAngularCosineSquared',
+                           I.AngularCosineSquared(K=5.0, theta0=2.0))]:
+            self.compare(lambda s, v: bonded(s, v, name, 'FixedTripleList', 'addTriples',
+                                             triples, pot))
+        for name, pot in [('FixedQuadrupleListDihedralHarmonic',
+                           I.DihedralHarmonic(K=3.0, phi0=1.0)),
+                          ('FixedQuadrupleListDihedralRB',
+                           I.DihedralRB(K0=1.0, K1=2.0, K2=0.5, K3=0.3, K4=0.0, K5=0.0))]:
+            self.compare(lambda s, v: bonded(s, v, name, 'FixedQuadrupleList', 'addQuadruples',
+                                             quadruples, pot))
+
+if __name__ == "__main__":
+    unittest.main()